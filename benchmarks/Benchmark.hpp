@@ -0,0 +1,83 @@
+/**
+ * @file      Benchmark.hpp
+ * @author    Elise MASSA
+ * @author    Mattéo LECLERCQ
+ * @date      2022
+ * @brief     Minimal benchmark harness (no dependency): register with ARKULIB_BENCHMARK, run with main.cpp
+ * @copyright WTFPL
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace Arkulib::Benchmarks {
+    /**
+     * @brief A registered benchmark. The body runs the measured operation `iterations` times.
+     */
+    struct Benchmark {
+        std::string name;
+        std::size_t iterations;
+        std::function<void(std::size_t)> body;
+    };
+
+    /**
+     * @return Every benchmark registered by ARKULIB_BENCHMARK
+     */
+    inline std::vector<Benchmark> &registry() {
+        static std::vector<Benchmark> benchmarks;
+        return benchmarks;
+    }
+
+    /**
+     * @brief Register a benchmark at static initialization time
+     */
+    struct Registrar {
+        inline Registrar(std::string name, std::size_t iterations, std::function<void(std::size_t)> body) {
+            registry().push_back({std::move(name), iterations, std::move(body)});
+        }
+    };
+
+    /**
+     * @brief Prevent the compiler from optimizing away a computed value
+     * @tparam Type
+     * @param value
+     */
+    template<typename Type>
+    inline void doNotOptimize(const Type &value) {
+#if defined(__GNUC__) || defined(__clang__)
+        asm volatile("" : : "r,m"(value) : "memory");
+#else
+        static volatile const Type *sink;
+        sink = &value;
+#endif
+    }
+
+    /**
+     * @brief Run a benchmark
+     * @return The mean duration of one iteration in nanoseconds
+     */
+    inline double run(const Benchmark &benchmark) {
+        const auto start = std::chrono::steady_clock::now();
+        benchmark.body(benchmark.iterations);
+        const auto end = std::chrono::steady_clock::now();
+
+        return std::chrono::duration<double, std::nano>(end - start).count() / double(benchmark.iterations);
+    }
+}
+
+#define ARKULIB_BENCHMARK_CONCAT_IMPL(a, b) a##b
+#define ARKULIB_BENCHMARK_CONCAT(a, b) ARKULIB_BENCHMARK_CONCAT_IMPL(a, b)
+
+/**
+ * @brief Register a benchmark running `count` iterations. The body receives `std::size_t iterations`.
+ */
+#define ARKULIB_BENCHMARK(name, count)                                                                       \
+    static void ARKULIB_BENCHMARK_CONCAT(arkulibBenchmark_, __LINE__)(std::size_t);                           \
+    static const Arkulib::Benchmarks::Registrar ARKULIB_BENCHMARK_CONCAT(arkulibRegistrar_, __LINE__)(        \
+            name, count, ARKULIB_BENCHMARK_CONCAT(arkulibBenchmark_, __LINE__));                              \
+    static void ARKULIB_BENCHMARK_CONCAT(arkulibBenchmark_, __LINE__)(std::size_t iterations)
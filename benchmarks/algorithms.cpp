@@ -0,0 +1,42 @@
+#include <random>
+#include <vector>
+#include "Benchmark.hpp"
+#include "../include/Algorithms.hpp"
+
+namespace {
+    // Prices in 1/256ths, and ticks on a few usual denominators
+    std::vector<Arkulib::Rational<long long>> randomRationals(const std::vector<int> &denominators) {
+        std::mt19937 generator(42);
+        std::uniform_int_distribution<int> numerators(-(1 << 20), 1 << 20);
+        std::uniform_int_distribution<std::size_t> index(0, denominators.size() - 1);
+        std::vector<Arkulib::Rational<long long>> rationals;
+        rationals.reserve(4096);
+        for (std::size_t i = 0; i < 4096; ++i) rationals.emplace_back(numerators(generator), denominators[index(generator)]);
+        return rationals;
+    }
+
+    void fold(const std::size_t iterations, const std::vector<Arkulib::Rational<long long>> &rationals) {
+        for (std::size_t i = 0; i < iterations; ++i) {
+            Arkulib::Rational<long long> sum;
+            for (const auto &rational: rationals) sum += rational;
+            Arkulib::Benchmarks::doNotOptimize(sum);
+        }
+    }
+
+    void sum(const std::size_t iterations, const std::vector<Arkulib::Rational<long long>> &rationals) {
+        for (std::size_t i = 0; i < iterations; ++i) Arkulib::Benchmarks::doNotOptimize(Arkulib::sum(rationals));
+    }
+}
+
+ARKULIB_BENCHMARK("Sum/SameDenominator/Fold", 1 << 8) { fold(iterations, randomRationals({256})); }
+
+ARKULIB_BENCHMARK("Sum/SameDenominator/Sum", 1 << 10) { sum(iterations, randomRationals({256})); }
+
+ARKULIB_BENCHMARK("Sum/FewDenominators/Fold", 1 << 8) { fold(iterations, randomRationals({2, 3, 4, 5, 8, 10, 12, 16, 100})); }
+
+ARKULIB_BENCHMARK("Sum/FewDenominators/Sum", 1 << 10) { sum(iterations, randomRationals({2, 3, 4, 5, 8, 10, 12, 16, 100})); }
+
+ARKULIB_BENCHMARK("Sum/Dot", 1 << 10) {
+    const std::vector<Arkulib::Rational<long long>> a = randomRationals({256}), b = randomRationals({2, 4, 8});
+    for (std::size_t i = 0; i < iterations; ++i) Arkulib::Benchmarks::doNotOptimize(Arkulib::dot(a, b));
+}
@@ -0,0 +1,53 @@
+#include <random>
+#include <string>
+#include "Benchmark.hpp"
+#include "../include/BigInt.hpp"
+#include "../include/Rational.hpp"
+
+namespace {
+    Arkulib::BigInt randomBigInt(const std::size_t digits, const unsigned int seed) {
+        std::mt19937_64 generator(seed);
+        std::string decimal(1, static_cast<char>('1' + generator() % 9));
+        for (std::size_t i = 1; i < digits; ++i) decimal.push_back(static_cast<char>('0' + generator() % 10));
+        return Arkulib::BigInt(decimal);
+    }
+}
+
+ARKULIB_BENCHMARK("BigInt/Multiply/300Digits", 1 << 14) {
+    const Arkulib::BigInt a = randomBigInt(300, 1), b = randomBigInt(300, 2);
+    for (std::size_t i = 0; i < iterations; ++i) Arkulib::Benchmarks::doNotOptimize(a * b);
+}
+
+ARKULIB_BENCHMARK("BigInt/Multiply/10000Digits", 1 << 6) {
+    const Arkulib::BigInt a = randomBigInt(10000, 1), b = randomBigInt(10000, 2);
+    for (std::size_t i = 0; i < iterations; ++i) Arkulib::Benchmarks::doNotOptimize(a * b);
+}
+
+ARKULIB_BENCHMARK("BigInt/Gcd/1000Digits/Euclidean", 1 << 6) {
+    const Arkulib::BigInt a = randomBigInt(1000, 1), b = randomBigInt(1000, 2);
+    for (std::size_t i = 0; i < iterations; ++i) Arkulib::Benchmarks::doNotOptimize(Arkulib::Tools::euclideanGcd(a, b));
+}
+
+ARKULIB_BENCHMARK("BigInt/Gcd/1000Digits/Lehmer", 1 << 8) {
+    const Arkulib::BigInt a = randomBigInt(1000, 1), b = randomBigInt(1000, 2);
+    for (std::size_t i = 0; i < iterations; ++i) Arkulib::Benchmarks::doNotOptimize(Arkulib::BigInt::gcd(a, b));
+}
+
+ARKULIB_BENCHMARK("BigInt/Gcd/30000Digits/Euclidean", 1) {
+    const Arkulib::BigInt a = randomBigInt(30000, 1), b = randomBigInt(30000, 2);
+    for (std::size_t i = 0; i < iterations; ++i) Arkulib::Benchmarks::doNotOptimize(Arkulib::Tools::euclideanGcd(a, b));
+}
+
+ARKULIB_BENCHMARK("BigInt/Gcd/30000Digits/HalfGcd", 4) {
+    const Arkulib::BigInt a = randomBigInt(30000, 1), b = randomBigInt(30000, 2);
+    for (std::size_t i = 0; i < iterations; ++i) Arkulib::Benchmarks::doNotOptimize(Arkulib::BigInt::gcd(a, b));
+}
+
+ARKULIB_BENCHMARK("BigInt/Rational/HarmonicSum", 16) {
+    // 1 + 1/2 + ... + 1/300: the denominators grow far beyond 64 bits
+    for (std::size_t i = 0; i < iterations; ++i) {
+        Arkulib::Rational<Arkulib::BigInt> sum;
+        for (int k = 1; k <= 300; ++k) sum += Arkulib::Rational<Arkulib::BigInt>(1, k);
+        Arkulib::Benchmarks::doNotOptimize(sum);
+    }
+}
@@ -0,0 +1,43 @@
+#include <random>
+#include <vector>
+#include "Benchmark.hpp"
+#include "../include/ERational.hpp"
+
+namespace {
+    std::vector<double> randomPrices(const std::size_t count) {
+        // Market-data like values: a few digits after the decimal point
+        std::mt19937_64 generator(7);
+        std::uniform_int_distribution<int> cents(1, 1000000);
+        std::vector<double> prices(count);
+        for (double &price: prices) price = cents(generator) / 100.;
+        return prices;
+    }
+}
+
+ARKULIB_BENCHMARK("Conversion/FromFloatingPoint/ContinuedFraction", 1 << 8) {
+    const std::vector<double> prices = randomPrices(1024);
+    for (std::size_t i = 0; i < iterations; ++i) {
+        for (const double price: prices) Arkulib::Benchmarks::doNotOptimize(Arkulib::Rational<long long>::fromFloatingPoint(price));
+    }
+}
+
+ARKULIB_BENCHMARK("Conversion/FromFloatingPoint/Exact", 1 << 12) {
+    const std::vector<double> prices = randomPrices(1024);
+    for (std::size_t i = 0; i < iterations; ++i) {
+        for (const double price: prices) Arkulib::Benchmarks::doNotOptimize(Arkulib::Rational<long long>(price, Arkulib::Exact));
+    }
+}
+
+ARKULIB_BENCHMARK("Conversion/ERational/FromFloatingPoint", 1 << 8) {
+    const std::vector<double> prices = randomPrices(1024);
+    for (std::size_t i = 0; i < iterations; ++i) {
+        for (const double price: prices) Arkulib::Benchmarks::doNotOptimize(Arkulib::ERational<>(price));
+    }
+}
+
+ARKULIB_BENCHMARK("Conversion/BestApproximation/MaxDenominator1000", 1 << 10) {
+    const std::vector<double> prices = randomPrices(1024);
+    for (std::size_t i = 0; i < iterations; ++i) {
+        for (const double price: prices) Arkulib::Benchmarks::doNotOptimize(Arkulib::Rational<long long>::bestApproximation(price, 1000));
+    }
+}
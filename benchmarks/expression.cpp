@@ -0,0 +1,37 @@
+#include <random>
+#include <vector>
+#include "Benchmark.hpp"
+#include "../include/RationalExpression.hpp"
+
+namespace {
+    std::vector<Arkulib::Rational<long long>> randomRationals() {
+        std::mt19937 generator(42);
+        std::uniform_int_distribution<long long> numerators(-1000, 1000), denominators(1, 100);
+        std::vector<Arkulib::Rational<long long>> rationals;
+        for (std::size_t i = 0; i < 1024 * 6; ++i) rationals.emplace_back(numerators(generator) | 1, denominators(generator));
+        return rationals;
+    }
+}
+
+ARKULIB_BENCHMARK("Expression/Formula/Operators", 1 << 6) {
+    const auto rationals = randomRationals();
+    for (std::size_t i = 0; i < iterations; ++i) {
+        for (std::size_t j = 0; j + 6 <= rationals.size(); j += 6) {
+            const auto &a = rationals[j], &b = rationals[j + 1], &c = rationals[j + 2];
+            const auto &d = rationals[j + 3], &e = rationals[j + 4], &f = rationals[j + 5];
+            Arkulib::Benchmarks::doNotOptimize(a * b + c * d - e / f);
+        }
+    }
+}
+
+ARKULIB_BENCHMARK("Expression/Formula/Fused", 1 << 6) {
+    const auto rationals = randomRationals();
+    for (std::size_t i = 0; i < iterations; ++i) {
+        for (std::size_t j = 0; j + 6 <= rationals.size(); j += 6) {
+            const auto [a, b, c, d, e, f] = Arkulib::Expressions::lazy(
+                    rationals[j], rationals[j + 1], rationals[j + 2], rationals[j + 3], rationals[j + 4], rationals[j + 5]
+            );
+            Arkulib::Benchmarks::doNotOptimize((a * b + c * d - e / f).evaluate());
+        }
+    }
+}
@@ -0,0 +1,54 @@
+#include <random>
+#include <vector>
+#include "Benchmark.hpp"
+#include "../include/FixedRational.hpp"
+
+namespace {
+    using Frames = Arkulib::FixedRational<int, 48000>;
+
+    std::vector<int> randomFrames() {
+        std::mt19937 generator(42);
+        std::uniform_int_distribution<int> frames(-48000, 48000);
+        std::vector<int> numerators(4096);
+        for (int &numerator: numerators) numerator = frames(generator);
+        return numerators;
+    }
+}
+
+ARKULIB_BENCHMARK("FixedRational/Accumulate/Rational", 1 << 8) {
+    std::vector<Arkulib::Rational<int>> values;
+    for (const int numerator: randomFrames()) values.emplace_back(numerator, 48000);
+    for (std::size_t i = 0; i < iterations; ++i) {
+        Arkulib::Rational<int> sum;
+        for (const auto &value: values) sum = sum + value;
+        Arkulib::Benchmarks::doNotOptimize(sum);
+    }
+}
+
+ARKULIB_BENCHMARK("FixedRational/Accumulate/Fixed", 1 << 8) {
+    std::vector<Frames> values;
+    for (const int numerator: randomFrames()) values.push_back(Frames::fromNumerator(numerator));
+    for (std::size_t i = 0; i < iterations; ++i) {
+        Frames sum;
+        for (const auto &value: values) sum += value;
+        Arkulib::Benchmarks::doNotOptimize(sum);
+    }
+}
+
+ARKULIB_BENCHMARK("FixedRational/Scale/Rational", 1 << 8) {
+    std::vector<Arkulib::Rational<int>> values;
+    for (const int numerator: randomFrames()) values.emplace_back(numerator, 48000);
+    const Arkulib::Rational<int> gain(3, 4);
+    for (std::size_t i = 0; i < iterations; ++i) {
+        for (const auto &value: values) Arkulib::Benchmarks::doNotOptimize(value * gain);
+    }
+}
+
+ARKULIB_BENCHMARK("FixedRational/Scale/Fixed", 1 << 8) {
+    std::vector<Frames> values;
+    for (const int numerator: randomFrames()) values.push_back(Frames::fromNumerator(numerator));
+    const Frames gain(Arkulib::Rational<int>(3, 4));
+    for (std::size_t i = 0; i < iterations; ++i) {
+        for (const auto &value: values) Arkulib::Benchmarks::doNotOptimize(value * gain);
+    }
+}
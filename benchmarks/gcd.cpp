@@ -0,0 +1,71 @@
+#include <numeric>
+#include <random>
+#include <vector>
+#include "Benchmark.hpp"
+#include "../include/Tools/Gcd.hpp"
+
+namespace {
+    template<typename IntType>
+    std::vector<IntType> randomOperands(const int shift) {
+        std::mt19937_64 generator(42);
+        std::vector<IntType> values(2048);
+        for (auto &value: values) value = static_cast<IntType>(generator() >> shift);
+        return values;
+    }
+
+#ifdef __SIZEOF_INT128__
+    std::vector<Arkulib::Tools::UInt128> randomWideOperands() {
+        std::mt19937_64 generator(42);
+        std::vector<Arkulib::Tools::UInt128> values(2048);
+        for (auto &value: values) value = (Arkulib::Tools::UInt128(generator()) << 64) | generator();
+        return values;
+    }
+#endif
+}
+
+ARKULIB_BENCHMARK("Gcd/Int32/StdGcd", 1 << 22) {
+    const auto values = randomOperands<int>(33);
+    for (std::size_t i = 0; i < iterations; ++i) Arkulib::Benchmarks::doNotOptimize(std::gcd(values[i & 2047], values[(i * 7 + 1) & 2047]));
+}
+
+ARKULIB_BENCHMARK("Gcd/Int32/Euclidean", 1 << 22) {
+    const auto values = randomOperands<int>(33);
+    for (std::size_t i = 0; i < iterations; ++i) Arkulib::Benchmarks::doNotOptimize(Arkulib::Tools::euclideanGcd(values[i & 2047], values[(i * 7 + 1) & 2047]));
+}
+
+ARKULIB_BENCHMARK("Gcd/Int32/Binary", 1 << 22) {
+    const auto values = randomOperands<int>(33);
+    for (std::size_t i = 0; i < iterations; ++i) Arkulib::Benchmarks::doNotOptimize(Arkulib::Tools::gcd(values[i & 2047], values[(i * 7 + 1) & 2047]));
+}
+
+ARKULIB_BENCHMARK("Gcd/Int64/StdGcd", 1 << 21) {
+    const auto values = randomOperands<long long int>(1);
+    for (std::size_t i = 0; i < iterations; ++i) Arkulib::Benchmarks::doNotOptimize(std::gcd(values[i & 2047], values[(i * 7 + 1) & 2047]));
+}
+
+ARKULIB_BENCHMARK("Gcd/Int64/Euclidean", 1 << 21) {
+    const auto values = randomOperands<long long int>(1);
+    for (std::size_t i = 0; i < iterations; ++i) Arkulib::Benchmarks::doNotOptimize(Arkulib::Tools::euclideanGcd(values[i & 2047], values[(i * 7 + 1) & 2047]));
+}
+
+ARKULIB_BENCHMARK("Gcd/Int64/Binary", 1 << 21) {
+    const auto values = randomOperands<long long int>(1);
+    for (std::size_t i = 0; i < iterations; ++i) Arkulib::Benchmarks::doNotOptimize(Arkulib::Tools::gcd(values[i & 2047], values[(i * 7 + 1) & 2047]));
+}
+
+#ifdef __SIZEOF_INT128__
+ARKULIB_BENCHMARK("Gcd/UInt128/Euclidean", 1 << 19) {
+    const auto values = randomWideOperands();
+    for (std::size_t i = 0; i < iterations; ++i) Arkulib::Benchmarks::doNotOptimize(Arkulib::Tools::euclideanGcd(values[i & 2047], values[(i * 7 + 1) & 2047]));
+}
+
+ARKULIB_BENCHMARK("Gcd/UInt128/Binary", 1 << 19) {
+    const auto values = randomWideOperands();
+    for (std::size_t i = 0; i < iterations; ++i) Arkulib::Benchmarks::doNotOptimize(Arkulib::Tools::binaryGcd(values[i & 2047], values[(i * 7 + 1) & 2047]));
+}
+
+ARKULIB_BENCHMARK("Gcd/UInt128/Lehmer", 1 << 19) {
+    const auto values = randomWideOperands();
+    for (std::size_t i = 0; i < iterations; ++i) Arkulib::Benchmarks::doNotOptimize(Arkulib::Tools::lehmerGcd(values[i & 2047], values[(i * 7 + 1) & 2047]));
+}
+#endif
@@ -0,0 +1,42 @@
+#include <random>
+#include <vector>
+#include "Benchmark.hpp"
+#include "../include/HybridRational.hpp"
+
+namespace {
+    template<typename RationalType>
+    std::vector<RationalType> randomRationals(const std::size_t count) {
+        std::mt19937 generator(42);
+        std::uniform_int_distribution<int> distribution(1, 1 << 15);
+        std::vector<RationalType> rationals;
+        rationals.reserve(count);
+        for (std::size_t i = 0; i < count; ++i) rationals.emplace_back(distribution(generator), distribution(generator));
+        return rationals;
+    }
+
+    template<typename RationalType>
+    void smallValues(const std::size_t iterations) {
+        // Nearly all the values fit in 32 bits: the inline path of HybridRational is the one measured
+        const std::vector<RationalType> rationals = randomRationals<RationalType>(1024);
+        for (std::size_t i = 0; i < iterations; ++i) {
+            for (std::size_t k = 0; k + 1 < rationals.size(); ++k) {
+                Arkulib::Benchmarks::doNotOptimize(rationals[k] * rationals[k + 1] + rationals[k] / rationals[k + 1]);
+            }
+        }
+    }
+}
+
+ARKULIB_BENCHMARK("Hybrid/SmallValues/RationalLongLong", 1 << 8) { smallValues<Arkulib::Rational<long long>>(iterations); }
+
+ARKULIB_BENCHMARK("Hybrid/SmallValues/HybridRational", 1 << 8) { smallValues<Arkulib::HybridRational<>>(iterations); }
+
+ARKULIB_BENCHMARK("Hybrid/SmallValues/RationalBigInt", 1 << 6) { smallValues<Arkulib::Rational<Arkulib::BigInt>>(iterations); }
+
+ARKULIB_BENCHMARK("Hybrid/HarmonicSum/HybridRational", 16) {
+    // 1 + 1/2 + ... + 1/300: inline up to 1/46, on the heap after
+    for (std::size_t i = 0; i < iterations; ++i) {
+        Arkulib::HybridRational<> sum;
+        for (int k = 1; k <= 300; ++k) sum += Arkulib::HybridRational<>(1, k);
+        Arkulib::Benchmarks::doNotOptimize(sum);
+    }
+}
@@ -0,0 +1,77 @@
+#include <random>
+#include <sstream>
+#include <vector>
+#include "Benchmark.hpp"
+#include "../include/RationalIO.hpp"
+
+namespace {
+    std::vector<Arkulib::Rational<long long>> randomRationals() {
+        std::mt19937 generator(42);
+        std::uniform_int_distribution<long long> numerators(-1000000000LL, 1000000000LL), denominators(1, 1000000);
+        std::vector<Arkulib::Rational<long long>> rationals;
+        for (std::size_t i = 0; i < 4096; ++i) rationals.emplace_back(numerators(generator), denominators(generator));
+        return rationals;
+    }
+}
+
+ARKULIB_BENCHMARK("IO/Format/Stream", 1 << 6) {
+    const auto rationals = randomRationals();
+    for (std::size_t i = 0; i < iterations; ++i) {
+        std::ostringstream stream;
+        for (const auto &rational: rationals) stream << rational << '\n';
+        Arkulib::Benchmarks::doNotOptimize(stream.tellp());
+    }
+}
+
+ARKULIB_BENCHMARK("IO/Format/TextWriter", 1 << 6) {
+    const auto rationals = randomRationals();
+    for (std::size_t i = 0; i < iterations; ++i) {
+        std::ostringstream stream;
+        {
+            Arkulib::IO::TextWriter writer(stream);
+            writer.write(rationals.begin(), rationals.end());
+        }
+        Arkulib::Benchmarks::doNotOptimize(stream.tellp());
+    }
+}
+
+ARKULIB_BENCHMARK("IO/Parse/TextReader", 1 << 6) {
+    std::ostringstream text;
+    {
+        const auto rationals = randomRationals();
+        Arkulib::IO::TextWriter writer(text);
+        writer.write(rationals.begin(), rationals.end());
+    }
+    const std::string content = text.str();
+    for (std::size_t i = 0; i < iterations; ++i) {
+        std::istringstream stream(content);
+        Arkulib::IO::TextReader reader(stream);
+        Arkulib::Benchmarks::doNotOptimize(reader.readAll<Arkulib::Rational<long long>>().size());
+    }
+}
+
+ARKULIB_BENCHMARK("IO/Format/BinaryWriter", 1 << 6) {
+    const auto rationals = randomRationals();
+    for (std::size_t i = 0; i < iterations; ++i) {
+        std::ostringstream stream;
+        {
+            Arkulib::IO::BinaryWriter writer(stream);
+            writer.write(rationals.begin(), rationals.end());
+        }
+        Arkulib::Benchmarks::doNotOptimize(stream.tellp());
+    }
+}
+
+ARKULIB_BENCHMARK("IO/Parse/BinaryView", 1 << 6) {
+    std::ostringstream data;
+    {
+        const auto rationals = randomRationals();
+        Arkulib::IO::BinaryWriter writer(data);
+        writer.write(rationals.begin(), rationals.end());
+    }
+    const std::string content = data.str();
+    for (std::size_t i = 0; i < iterations; ++i) {
+        const Arkulib::IO::BinaryView<Arkulib::Rational<long long>> view(content.data(), content.size());
+        for (const auto &rational: view) Arkulib::Benchmarks::doNotOptimize(rational);
+    }
+}
@@ -0,0 +1,79 @@
+#include <vector>
+#include "Benchmark.hpp"
+#include "../include/Rational.hpp"
+
+namespace {
+    using Arkulib::Rational;
+
+    /**
+     * The operators before the gcd-before-multiply kernels: full width products in long long,
+     * then a Rational<long long> (gcd) narrowed by the converting constructor (largeness check).
+     */
+    template<typename IntType>
+    Rational<IntType> legacyAdd(const Rational<IntType> &left, const Rational<IntType> &right) {
+        Rational<long long int> errorChecker(
+                static_cast<long long int>(left.getNumerator()) * right.getDenominator() + static_cast<long long int>(left.getDenominator()) * right.getNumerator(),
+                static_cast<long long int>(left.getDenominator()) * right.getDenominator()
+        );
+        return Rational<IntType>(errorChecker);
+    }
+
+    template<typename IntType>
+    Rational<IntType> legacyMultiply(const Rational<IntType> &left, const Rational<IntType> &right) {
+        Rational<long long int> errorChecker(
+                static_cast<long long int>(left.getNumerator()) * right.getNumerator(),
+                static_cast<long long int>(left.getDenominator()) * right.getDenominator()
+        );
+        return Rational<IntType>(errorChecker);
+    }
+
+    std::vector<Rational<int>> operands() {
+        std::vector<Rational<int>> values;
+        for (int i = 1; i <= 1024; ++i) values.emplace_back(i % 97 + 1, i % 89 + 2);
+        return values;
+    }
+}
+
+ARKULIB_BENCHMARK("Kernels/Add/Henrici", 1 << 22) {
+    const auto values = operands();
+    for (std::size_t i = 0; i < iterations; ++i) {
+        Arkulib::Benchmarks::doNotOptimize(values[i & 1023] + values[(i * 7) & 1023]);
+    }
+}
+
+ARKULIB_BENCHMARK("Kernels/Add/LegacyCheckForOverflowThenReturn", 1 << 22) {
+    const auto values = operands();
+    for (std::size_t i = 0; i < iterations; ++i) {
+        Arkulib::Benchmarks::doNotOptimize(legacyAdd(values[i & 1023], values[(i * 7) & 1023]));
+    }
+}
+
+ARKULIB_BENCHMARK("Kernels/Multiply/Knuth", 1 << 22) {
+    const auto values = operands();
+    for (std::size_t i = 0; i < iterations; ++i) {
+        Arkulib::Benchmarks::doNotOptimize(values[i & 1023] * values[(i * 7) & 1023]);
+    }
+}
+
+ARKULIB_BENCHMARK("Kernels/Multiply/LegacyCheckForOverflowThenReturn", 1 << 22) {
+    const auto values = operands();
+    for (std::size_t i = 0; i < iterations; ++i) {
+        Arkulib::Benchmarks::doNotOptimize(legacyMultiply(values[i & 1023], values[(i * 7) & 1023]));
+    }
+}
+
+ARKULIB_BENCHMARK("Kernels/ProductChain/Knuth", 1 << 12) {
+    for (std::size_t i = 0; i < iterations; ++i) {
+        Rational<int> product = Rational<int>::One();
+        for (int k = 1; k <= 256; ++k) product = product * Rational<int>(k, k + 1);
+        Arkulib::Benchmarks::doNotOptimize(product);
+    }
+}
+
+ARKULIB_BENCHMARK("Kernels/ProductChain/LegacyCheckForOverflowThenReturn", 1 << 12) {
+    for (std::size_t i = 0; i < iterations; ++i) {
+        Rational<int> product = Rational<int>::One();
+        for (int k = 1; k <= 256; ++k) product = legacyMultiply(product, Rational<int>(k, k + 1));
+        Arkulib::Benchmarks::doNotOptimize(product);
+    }
+}
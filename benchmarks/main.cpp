@@ -0,0 +1,14 @@
+#include <cstdio>
+#include <cstring>
+#include "Benchmark.hpp"
+
+// Usage: Arkulib_benchmarks [filter]. Only the benchmarks whose name contains the filter are run.
+int main(int argc, char **argv) {
+    const char *filter = argc > 1 ? argv[1] : "";
+
+    for (const auto &benchmark: Arkulib::Benchmarks::registry()) {
+        if (std::strstr(benchmark.name.c_str(), filter) == nullptr) continue;
+        std::printf("%-60s %12.2f ns/op\n", benchmark.name.c_str(), Arkulib::Benchmarks::run(benchmark));
+    }
+    return 0;
+}
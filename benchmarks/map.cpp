@@ -0,0 +1,34 @@
+#include <random>
+#include <unordered_set>
+#include <vector>
+#include "Benchmark.hpp"
+#include "../include/RationalMap.hpp"
+
+namespace {
+    // A ratio table with many duplicates: about a third of the values are distinct
+    std::vector<Arkulib::Rational<int>> randomRatios() {
+        std::mt19937 generator(42);
+        std::uniform_int_distribution<int> numerators(1, 300), denominators(1, 300);
+        std::vector<Arkulib::Rational<int>> ratios;
+        for (std::size_t i = 0; i < 100000; ++i) ratios.emplace_back(numerators(generator), denominators(generator));
+        return ratios;
+    }
+}
+
+ARKULIB_BENCHMARK("Map/Deduplicate/UnorderedSet", 1 << 4) {
+    const auto ratios = randomRatios();
+    for (std::size_t i = 0; i < iterations; ++i) {
+        std::unordered_set<Arkulib::Rational<int>> set;
+        for (const auto &ratio: ratios) set.insert(ratio);
+        Arkulib::Benchmarks::doNotOptimize(set.size());
+    }
+}
+
+ARKULIB_BENCHMARK("Map/Deduplicate/RationalSet", 1 << 4) {
+    const auto ratios = randomRatios();
+    for (std::size_t i = 0; i < iterations; ++i) {
+        Arkulib::RationalSet<Arkulib::Rational<int>> set;
+        for (const auto &ratio: ratios) set.insert(ratio);
+        Arkulib::Benchmarks::doNotOptimize(set.size());
+    }
+}
@@ -0,0 +1,58 @@
+#include <random>
+#include "Benchmark.hpp"
+#include "../include/RationalMatrix.hpp"
+
+namespace {
+    // Small numerators over a few denominators, like the coefficients of a linear system read from a file
+    template<typename IntType>
+    Arkulib::RationalMatrix<IntType> randomMatrix(const std::size_t rows, const std::size_t columns) {
+        std::mt19937 generator(42);
+        std::uniform_int_distribution<int> numerators(-50, 50), denominators(1, 9);
+        Arkulib::RationalMatrix<IntType> matrix(rows, columns);
+        for (std::size_t i = 0; i < rows; ++i) {
+            for (std::size_t j = 0; j < columns; ++j) matrix(i, j) = {IntType(numerators(generator)), IntType(denominators(generator))};
+        }
+        return matrix;
+    }
+}
+
+ARKULIB_BENCHMARK("Matrix/Determinant5/Gaussian", 1 << 10) {
+    const auto matrix = randomMatrix<long long>(5, 5);
+    for (std::size_t i = 0; i < iterations; ++i) Arkulib::Benchmarks::doNotOptimize(matrix.determinantGaussian());
+}
+
+ARKULIB_BENCHMARK("Matrix/Determinant5/Bareiss", 1 << 10) {
+    const auto matrix = randomMatrix<long long>(5, 5);
+    for (std::size_t i = 0; i < iterations; ++i) Arkulib::Benchmarks::doNotOptimize(matrix.determinant());
+}
+
+// Beyond a few rows the Gaussian partial results overflow long long: both go on BigInt
+ARKULIB_BENCHMARK("Matrix/Solve30/Gaussian", 1 << 2) {
+    const auto matrix = randomMatrix<Arkulib::BigInt>(30, 30), rightHandSide = randomMatrix<Arkulib::BigInt>(30, 1);
+    for (std::size_t i = 0; i < iterations; ++i) Arkulib::Benchmarks::doNotOptimize(matrix.solveGaussian(rightHandSide));
+}
+
+ARKULIB_BENCHMARK("Matrix/Solve30/Bareiss", 1 << 2) {
+    const auto matrix = randomMatrix<Arkulib::BigInt>(30, 30), rightHandSide = randomMatrix<Arkulib::BigInt>(30, 1);
+    for (std::size_t i = 0; i < iterations; ++i) Arkulib::Benchmarks::doNotOptimize(matrix.solve(rightHandSide));
+}
+
+ARKULIB_BENCHMARK("Matrix/Solve30/Modular", 1 << 2) {
+    const auto matrix = randomMatrix<Arkulib::BigInt>(30, 30), rightHandSide = randomMatrix<Arkulib::BigInt>(30, 1);
+    for (std::size_t i = 0; i < iterations; ++i) Arkulib::Benchmarks::doNotOptimize(matrix.solveModular(rightHandSide));
+}
+
+ARKULIB_BENCHMARK("Matrix/Solve100/Bareiss", 1) {
+    const auto matrix = randomMatrix<Arkulib::BigInt>(100, 100), rightHandSide = randomMatrix<Arkulib::BigInt>(100, 1);
+    for (std::size_t i = 0; i < iterations; ++i) Arkulib::Benchmarks::doNotOptimize(matrix.solve(rightHandSide));
+}
+
+ARKULIB_BENCHMARK("Matrix/Solve100/Modular", 1) {
+    const auto matrix = randomMatrix<Arkulib::BigInt>(100, 100), rightHandSide = randomMatrix<Arkulib::BigInt>(100, 1);
+    for (std::size_t i = 0; i < iterations; ++i) Arkulib::Benchmarks::doNotOptimize(matrix.solveModular(rightHandSide));
+}
+
+ARKULIB_BENCHMARK("Matrix/Product64", 1 << 2) {
+    const auto a = randomMatrix<long long>(64, 64), b = randomMatrix<long long>(64, 64);
+    for (std::size_t i = 0; i < iterations; ++i) Arkulib::Benchmarks::doNotOptimize(a * b);
+}
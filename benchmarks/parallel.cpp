@@ -0,0 +1,42 @@
+#include <random>
+#include <vector>
+#include "Benchmark.hpp"
+#include "../include/Parallel.hpp"
+
+namespace {
+    // Built before the measures
+    const std::vector<Arkulib::Rational<long long>> LARGE_ARRAY = [] {
+        std::mt19937 generator(42);
+        std::uniform_int_distribution<int> numerators(-(1 << 20), 1 << 20);
+        std::uniform_int_distribution<int> denominators(0, 3);
+        std::vector<Arkulib::Rational<long long>> values;
+        values.reserve(1 << 22);
+        for (std::size_t i = 0; i < values.capacity(); ++i) values.emplace_back(numerators(generator), 256 >> denominators(generator));
+        return values;
+    }();
+
+    void parallelSum(const std::size_t iterations, const std::size_t threadCount) {
+        for (std::size_t i = 0; i < iterations; ++i) {
+            Arkulib::Benchmarks::doNotOptimize(Arkulib::Parallel::sum(LARGE_ARRAY, {threadCount}));
+        }
+    }
+}
+
+ARKULIB_BENCHMARK("Parallel/Sum/Sequential", 4) {
+    for (std::size_t i = 0; i < iterations; ++i) Arkulib::Benchmarks::doNotOptimize(Arkulib::sum(LARGE_ARRAY));
+}
+
+ARKULIB_BENCHMARK("Parallel/Sum/1Thread", 4) { parallelSum(iterations, 1); }
+
+ARKULIB_BENCHMARK("Parallel/Sum/4Threads", 4) { parallelSum(iterations, 4); }
+
+ARKULIB_BENCHMARK("Parallel/Sum/AllThreads", 4) { parallelSum(iterations, 0); }
+
+ARKULIB_BENCHMARK("Parallel/Transform/AllThreads", 4) {
+    std::vector<Arkulib::Rational<long long>> out(LARGE_ARRAY.size());
+    for (std::size_t i = 0; i < iterations; ++i) {
+        Arkulib::Parallel::transform(LARGE_ARRAY.begin(), LARGE_ARRAY.end(), out.begin(),
+                                     [](const Arkulib::Rational<long long> &r) { return r * r; });
+        Arkulib::Benchmarks::doNotOptimize(out);
+    }
+}
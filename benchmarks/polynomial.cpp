@@ -0,0 +1,58 @@
+#include <random>
+#include <vector>
+#include "Benchmark.hpp"
+#include "../include/RationalPolynomial.hpp"
+
+namespace {
+    using Polynomial = Arkulib::RationalPolynomial<long long>;
+    using R = Polynomial::RationalType;
+
+    // Taylor-like coefficients: small numerators over a few denominators
+    Polynomial randomPolynomial(const std::size_t degree, const unsigned seed) {
+        std::mt19937 generator(seed);
+        std::uniform_int_distribution<long long> numerators(-30, 30), denominators(1, 4);
+        std::vector<R> coefficients;
+        for (std::size_t i = 0; i <= degree; ++i) coefficients.emplace_back(numerators(generator), denominators(generator));
+        coefficients.back() = R(1, 3);
+        return Polynomial(coefficients);
+    }
+}
+
+ARKULIB_BENCHMARK("Polynomial/Evaluate20/Operators", 1 << 14) {
+    const Polynomial polynomial = randomPolynomial(20, 1);
+    const R x(3, 4);
+    for (std::size_t i = 0; i < iterations; ++i) {
+        R value;
+        for (std::size_t power = polynomial.degree() + 1; power-- > 0;) value = value * x + polynomial.coefficient(power);
+        Arkulib::Benchmarks::doNotOptimize(value);
+    }
+}
+
+ARKULIB_BENCHMARK("Polynomial/Evaluate20/Horner", 1 << 14) {
+    const Polynomial polynomial = randomPolynomial(20, 1);
+    const R x(3, 4);
+    for (std::size_t i = 0; i < iterations; ++i) Arkulib::Benchmarks::doNotOptimize(polynomial.evaluate(x));
+}
+
+ARKULIB_BENCHMARK("Polynomial/EvaluateBatch20/Double", 1 << 8) {
+    const Polynomial polynomial = randomPolynomial(20, 1);
+    std::vector<double> points(4096);
+    for (std::size_t i = 0; i < points.size(); ++i) points[i] = -1. + 2. * static_cast<double>(i) / 4096.;
+    for (std::size_t i = 0; i < iterations; ++i) Arkulib::Benchmarks::doNotOptimize(polynomial.evaluate(points));
+}
+
+ARKULIB_BENCHMARK("Polynomial/Multiply200/Operators", 1 << 2) {
+    const Polynomial a = randomPolynomial(200, 1), b = randomPolynomial(200, 2);
+    for (std::size_t i = 0; i < iterations; ++i) {
+        std::vector<R> coefficients(a.degree() + b.degree() + 1);
+        for (std::size_t j = 0; j <= a.degree(); ++j) {
+            for (std::size_t k = 0; k <= b.degree(); ++k) coefficients[j + k] += a.coefficient(j) * b.coefficient(k);
+        }
+        Arkulib::Benchmarks::doNotOptimize(coefficients);
+    }
+}
+
+ARKULIB_BENCHMARK("Polynomial/Multiply200/Karatsuba", 1 << 2) {
+    const Polynomial a = randomPolynomial(200, 1), b = randomPolynomial(200, 2);
+    for (std::size_t i = 0; i < iterations; ++i) Arkulib::Benchmarks::doNotOptimize(a * b);
+}
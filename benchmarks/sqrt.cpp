@@ -0,0 +1,57 @@
+#include <cmath>
+#include <random>
+#include <vector>
+#include "Benchmark.hpp"
+#include "../include/Rational.hpp"
+
+namespace {
+    // Squares of random fractions, then the same fractions off by one
+    std::vector<Arkulib::Rational<int>> randomRadicands(const bool isSquare) {
+        std::mt19937 generator(42);
+        std::uniform_int_distribution<int> operands(1, 40000);
+        std::vector<Arkulib::Rational<int>> radicands;
+        for (int i = 0; i < 4096; ++i) {
+            const int numerator = operands(generator), denominator = operands(generator);
+            radicands.emplace_back(numerator * numerator + (isSquare ? 0 : 1), denominator * denominator);
+        }
+        return radicands;
+    }
+}
+
+ARKULIB_BENCHMARK("Sqrt/PerfectSquare/FloatingPoint", 1 << 6) {
+    const auto radicands = randomRadicands(true);
+    for (std::size_t i = 0; i < iterations; ++i) {
+        for (const auto &radicand: radicands)
+            Arkulib::Benchmarks::doNotOptimize(Arkulib::Rational<int>::bestApproximation(std::sqrt(radicand.toRealNumber<double>()), 46340));
+    }
+}
+
+ARKULIB_BENCHMARK("Sqrt/PerfectSquare/Exact", 1 << 6) {
+    const auto radicands = randomRadicands(true);
+    for (std::size_t i = 0; i < iterations; ++i) {
+        for (const auto &radicand: radicands) Arkulib::Benchmarks::doNotOptimize(radicand.sqrt());
+    }
+}
+
+ARKULIB_BENCHMARK("Sqrt/Irrational/FloatingPoint", 1 << 6) {
+    const auto radicands = randomRadicands(false);
+    for (std::size_t i = 0; i < iterations; ++i) {
+        for (const auto &radicand: radicands)
+            Arkulib::Benchmarks::doNotOptimize(Arkulib::Rational<int>::bestApproximation(std::sqrt(radicand.toRealNumber<double>()), 46340));
+    }
+}
+
+ARKULIB_BENCHMARK("Sqrt/Irrational/IntegerRoot", 1 << 6) {
+    const auto radicands = randomRadicands(false);
+    for (std::size_t i = 0; i < iterations; ++i) {
+        for (const auto &radicand: radicands) Arkulib::Benchmarks::doNotOptimize(radicand.sqrt());
+    }
+}
+
+ARKULIB_BENCHMARK("Sqrt/Irrational/ErrorBound", 1 << 6) {
+    const auto radicands = randomRadicands(false);
+    const Arkulib::Rational<int> maxError(1, 10000);
+    for (std::size_t i = 0; i < iterations; ++i) {
+        for (const auto &radicand: radicands) Arkulib::Benchmarks::doNotOptimize(radicand.sqrt(maxError));
+    }
+}
@@ -0,0 +1,91 @@
+#include <random>
+#include <vector>
+#include "Benchmark.hpp"
+#include "../include/CommonDenominatorVector.hpp"
+#include "../include/RationalVector.hpp"
+
+namespace {
+    constexpr std::size_t LANES = 4096;
+
+    std::vector<Arkulib::Rational<int>> randomRationals(const unsigned seed) {
+        std::mt19937 generator(seed);
+        std::uniform_int_distribution<int> distribution(1, 1 << 12);
+        std::vector<Arkulib::Rational<int>> rationals;
+        rationals.reserve(LANES);
+        for (std::size_t i = 0; i < LANES; ++i) rationals.emplace_back(distribution(generator), distribution(generator));
+        return rationals;
+    }
+
+    void vectorAdd(const std::size_t iterations, const Arkulib::Tools::Simd::Level level) {
+        Arkulib::Tools::Simd::setLevel(level);
+        const Arkulib::RationalVector<int> a(randomRationals(1)), b(randomRationals(2));
+        Arkulib::RationalVector<int> result;
+        for (std::size_t i = 0; i < iterations; ++i) {
+            Arkulib::Benchmarks::doNotOptimize(Arkulib::RationalVector<int>::add(a, b, result));
+            Arkulib::Benchmarks::doNotOptimize(result);
+        }
+        Arkulib::Tools::Simd::setLevel(Arkulib::Tools::Simd::detectLevel());
+    }
+}
+
+ARKULIB_BENCHMARK("Vector/Add/RationalLoop", 1 << 8) {
+    const std::vector<Arkulib::Rational<int>> a = randomRationals(1), b = randomRationals(2);
+    std::vector<Arkulib::Rational<int>> result(LANES);
+    for (std::size_t i = 0; i < iterations; ++i) {
+        for (std::size_t lane = 0; lane < LANES; ++lane) result[lane] = a[lane] + b[lane];
+        Arkulib::Benchmarks::doNotOptimize(result);
+    }
+}
+
+ARKULIB_BENCHMARK("Vector/Add/Scalar", 1 << 10) { vectorAdd(iterations, Arkulib::Tools::Simd::Level::Scalar); }
+
+ARKULIB_BENCHMARK("Vector/Add/Sse41", 1 << 10) { vectorAdd(iterations, Arkulib::Tools::Simd::Level::Sse41); }
+
+ARKULIB_BENCHMARK("Vector/Add/Avx2", 1 << 10) { vectorAdd(iterations, Arkulib::Tools::Simd::Level::Avx2); }
+
+ARKULIB_BENCHMARK("Vector/Add/Avx512", 1 << 10) { vectorAdd(iterations, Arkulib::Tools::Simd::Level::Avx512); }
+
+ARKULIB_BENCHMARK("Vector/Less/Avx2", 1 << 12) {
+    Arkulib::Tools::Simd::setLevel(Arkulib::Tools::Simd::Level::Avx2);
+    const Arkulib::RationalVector<int> a(randomRationals(1)), b(randomRationals(2));
+    for (std::size_t i = 0; i < iterations; ++i) Arkulib::Benchmarks::doNotOptimize(Arkulib::RationalVector<int>::less(a, b));
+    Arkulib::Tools::Simd::setLevel(Arkulib::Tools::Simd::detectLevel());
+}
+
+namespace {
+    std::vector<Arkulib::Rational<int>> randomPrices(const unsigned seed) {
+        std::mt19937 generator(seed);
+        std::uniform_int_distribution<int> distribution(1, 1 << 20);
+        std::vector<Arkulib::Rational<int>> prices;
+        prices.reserve(LANES);
+        for (std::size_t i = 0; i < LANES; ++i) prices.emplace_back(distribution(generator), 256);
+        return prices;
+    }
+}
+
+ARKULIB_BENCHMARK("Vector/Prices/RationalLoop", 1 << 8) {
+    const std::vector<Arkulib::Rational<int>> a = randomPrices(1), b = randomPrices(2);
+    std::vector<Arkulib::Rational<int>> result(LANES);
+    for (std::size_t i = 0; i < iterations; ++i) {
+        for (std::size_t lane = 0; lane < LANES; ++lane) result[lane] = a[lane] + b[lane];
+        Arkulib::Benchmarks::doNotOptimize(result);
+    }
+}
+
+ARKULIB_BENCHMARK("Vector/Prices/RationalVector", 1 << 10) {
+    const Arkulib::RationalVector<int> a(randomPrices(1)), b(randomPrices(2));
+    Arkulib::RationalVector<int> result;
+    for (std::size_t i = 0; i < iterations; ++i) {
+        Arkulib::Benchmarks::doNotOptimize(Arkulib::RationalVector<int>::add(a, b, result));
+        Arkulib::Benchmarks::doNotOptimize(result);
+    }
+}
+
+ARKULIB_BENCHMARK("Vector/Prices/CommonDenominatorVector", 1 << 12) {
+    const Arkulib::CommonDenominatorVector<int> a(randomPrices(1)), b(randomPrices(2));
+    Arkulib::CommonDenominatorVector<int> result;
+    for (std::size_t i = 0; i < iterations; ++i) {
+        Arkulib::Benchmarks::doNotOptimize(Arkulib::CommonDenominatorVector<int>::add(a, b, result));
+        Arkulib::Benchmarks::doNotOptimize(result);
+    }
+}
@@ -0,0 +1,315 @@
+/**
+ * @file      Algorithms.hpp
+ * @author    Elise MASSA
+ * @author    Mattéo LECLERCQ
+ * @date      2022
+ * @brief     Exact sum and dot product of many rationals with a single gcd
+ * @copyright WTFPL
+ */
+
+#pragma once
+
+#include <iterator>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#if __has_include(<span>)
+#include <span>
+#endif
+
+#include "BigInt.hpp"
+#include "Rational.hpp"
+#include "Tools/FractionAccumulator.hpp"
+
+namespace Arkulib {
+    namespace Tools {
+        /**
+         * @brief The template parameters of a Rational
+         */
+        template<typename RationalType>
+        struct RationalTraits;
+
+        template<typename IntType, typename NormalizationPolicy, typename ErrorPolicy>
+        struct RationalTraits<Rational<IntType, NormalizationPolicy, ErrorPolicy>> {
+            using Int = IntType;
+            using Wide = WiderIntegerType<IntType>;
+            using Normalization = NormalizationPolicy;
+            using Error = ErrorPolicy;
+        };
+
+        template<typename Type>
+        constexpr bool isRational = false;
+
+        template<typename IntType, typename NormalizationPolicy, typename ErrorPolicy>
+        constexpr bool isRational<Rational<IntType, NormalizationPolicy, ErrorPolicy>> = true;
+
+        /**
+         * @brief The type of the magnitude of an integer: the unsigned type of a builtin integer, the type itself else
+         */
+        template<typename IntType, bool = isBuiltinInteger<IntType>>
+        struct MagnitudeType {
+            using Type = IntType;
+        };
+
+        template<typename IntType>
+        struct MagnitudeType<IntType, true> {
+            using Type = UnsignedIntegerType<IntType>;
+        };
+
+        /**
+         * @brief Closest rational to a reduced accumulator that doesn't fit in IntType, for Policies::Approximate (like
+         * the overflows of the operators). The absolute error is recorded in the statistics of the ErrorPolicy.
+         */
+        template<typename RationalType, typename AccumulatorType>
+        RationalType approximateFraction(const FractionAccumulator<AccumulatorType> &accumulator) {
+            using IntType = typename RationalTraits<RationalType>::Int;
+            using UnsignedType = typename MagnitudeType<AccumulatorType>::Type;
+            const auto BOUND = static_cast<UnsignedType>(std::numeric_limits<IntType>::max());
+
+            const bool isNegative = accumulator.numerator < AccumulatorType(0);
+            UnsignedType magnitude{};
+            if constexpr (isBuiltinInteger<AccumulatorType>) magnitude = unsignedAbs(accumulator.numerator);
+            else magnitude = isNegative ? -accumulator.numerator : accumulator.numerator;
+
+            UnsignedType approximatedNumerator{}, approximatedDenominator{};
+            boundedBestApproximation(
+                    magnitude, static_cast<UnsignedType>(accumulator.denominator), BOUND, BOUND,
+                    approximatedNumerator, approximatedDenominator
+            );
+
+            const auto numerator = static_cast<IntType>(approximatedNumerator);
+            const auto denominator = static_cast<IntType>(approximatedDenominator);
+            const long double error = static_cast<long double>(magnitude) / static_cast<long double>(accumulator.denominator)
+                                      - static_cast<long double>(numerator) / static_cast<long double>(denominator);
+            RationalTraits<RationalType>::Error::recordApproximation(static_cast<double>(error < 0 ? -error : error));
+
+            return RationalType(isNegative ? IntType(-numerator) : numerator, denominator);
+        }
+
+        /**
+         * @brief The rational of an accumulator. The constructor of the rational does the only gcd when the fraction
+         * already fits, else the accumulator is reduced first. What still doesn't fit is approximated with
+         * Policies::Approximate, reported as NumberTooLarge otherwise.
+         */
+        template<typename RationalType, typename AccumulatorType>
+        RationalType finalFraction(FractionAccumulator<AccumulatorType> &accumulator) {
+            using IntType = typename RationalTraits<RationalType>::Int;
+            if (!fitsIn<IntType>(accumulator.numerator) || !fitsIn<IntType>(accumulator.denominator)) {
+                accumulator.reduce();
+                if (!fitsIn<IntType>(accumulator.numerator) || !fitsIn<IntType>(accumulator.denominator)) {
+                    if constexpr (Policies::isApproximating<typename RationalTraits<RationalType>::Error>) {
+                        return approximateFraction<RationalType>(accumulator);
+                    }
+                    RationalTraits<RationalType>::Error::raise(ArkulibError::NumberTooLarge);
+                    return RationalType();
+                }
+            }
+            return RationalType(static_cast<IntType>(accumulator.numerator), static_cast<IntType>(accumulator.denominator));
+        }
+
+        /**
+         * @brief Exact running sum of terms given in the wide type of the rational's IntType. The terms are accumulated
+         * over the least common multiple of their denominators. If the wide type overflows even reduced, the
+         * accumulator goes on with BigInt: only the final result must fit in IntType.
+         * @tparam RationalType
+         */
+        template<typename RationalType>
+        class ExactAccumulator {
+
+        public:
+            using WideType = typename RationalTraits<RationalType>::Wide;
+
+            /**
+             * @brief Add numerator / denominator
+             * @param numerator
+             * @param denominator Must be positive
+             */
+            inline void add(const WideType &numerator, const WideType &denominator) {
+                if constexpr (IntegerTraits<WideType>::isBounded) {
+                    if (!m_isBig) {
+                        if (!m_wide.add(numerator, denominator)) return;
+                        promote();
+                    }
+                    m_big.add(BigInt(numerator), BigInt(denominator));
+                }
+                else m_wide.add(numerator, denominator);
+            }
+
+            /**
+             * @brief Add the terms given by termAt(iterator), a pair numerator, denominator in the wide type.
+             * The wide accumulator is copied in a local variable for the loop, so it can stay in registers.
+             * termAt is called once per iterator.
+             */
+            template<typename Iterator, typename TermAt>
+            void addRange(Iterator first, const Iterator last, TermAt termAt) {
+                if constexpr (IntegerTraits<WideType>::isBounded) {
+                    if (!m_isBig) {
+                        FractionAccumulator<WideType> wide = m_wide;
+                        for (; first != last; ++first) {
+                            const auto [numerator, denominator] = termAt(first);
+                            if (wide.add(numerator, denominator)) {
+                                m_wide = wide;
+                                promote();
+                                m_big.add(BigInt(numerator), BigInt(denominator));
+                                ++first;
+                                break;
+                            }
+                        }
+                        if (!m_isBig) {
+                            m_wide = wide;
+                            return;
+                        }
+                    }
+                }
+                for (; first != last; ++first) {
+                    const auto [numerator, denominator] = termAt(first);
+                    add(numerator, denominator);
+                }
+            }
+
+            /**
+             * @brief Add the sum of another accumulator
+             * @param other
+             */
+            inline void merge(const ExactAccumulator &other) {
+                if constexpr (IntegerTraits<WideType>::isBounded) {
+                    if (!other.m_isBig) return add(other.m_wide.numerator, other.m_wide.denominator);
+                    if (!m_isBig) promote();
+                    m_big.add(other.m_big.numerator, other.m_big.denominator);
+                }
+                else m_wide.add(other.m_wide.numerator, other.m_wide.denominator);
+            }
+
+            /**
+             * @return The reduced sum (one gcd when the result fits before its reduction)
+             */
+            [[nodiscard]] inline RationalType toRational() {
+                return m_isBig ? finalFraction<RationalType>(m_big) : finalFraction<RationalType>(m_wide);
+            }
+
+        private:
+            FractionAccumulator<WideType> m_wide;
+            FractionAccumulator<BigInt> m_big;
+            bool m_isBig = false;
+
+            inline void promote() {
+                m_big = FractionAccumulator<BigInt>{BigInt(m_wide.numerator), BigInt(m_wide.denominator)};
+                m_isBig = true;
+            }
+        };
+
+        /**
+         * @brief Sum the terms given by termAt(iterator), a pair numerator, denominator in the wide type
+         * @return The reduced sum
+         */
+        template<typename RationalType, typename Iterator, typename TermAt>
+        RationalType sumTerms(Iterator first, const Iterator last, TermAt termAt) {
+            ExactAccumulator<RationalType> accumulator;
+            accumulator.addRange(first, last, termAt);
+            return accumulator.toRational();
+        }
+    }
+
+    /************************************************************************************************************
+     *************************************************** SUM ****************************************************
+     ************************************************************************************************************/
+
+    /**
+     * @brief Exact sum of rationals. Unlike a fold of operator+=, there is one gcd for the whole sum (instead of
+     * one per element) and only the result must fit in IntType, not the partial sums.
+     * @tparam Iterator An input iterator over a Rational
+     * @param first
+     * @param last
+     * @return The reduced sum (0 if the range is empty)
+     */
+    template<typename Iterator>
+    typename std::iterator_traits<Iterator>::value_type sum(Iterator first, Iterator last) {
+        using RationalType = typename std::iterator_traits<Iterator>::value_type;
+        using WideType = typename Tools::RationalTraits<RationalType>::Wide;
+        return Tools::sumTerms<RationalType>(first, last, [](const Iterator &iterator) {
+            return std::pair<WideType, WideType>(iterator->getNumerator(), iterator->getDenominator());
+        });
+    }
+
+    /**
+     * @brief Exact sum of a container of rationals (std::vector, std::array...)
+     * @param values
+     * @return The reduced sum
+     */
+    template<typename Container>
+    auto sum(const Container &values) -> decltype(sum(std::begin(values), std::end(values))) {
+        return sum(std::begin(values), std::end(values));
+    }
+
+    /************************************************************************************************************
+     *************************************************** DOT ****************************************************
+     ************************************************************************************************************/
+
+    /**
+     * @brief Exact dot product a[0] * b[0] + ... + a[n-1] * b[n-1], with one gcd for the whole sum.
+     * The products are computed in the wide type of IntType, so they never overflow.
+     * @param firstA
+     * @param lastA
+     * @param firstB The second range has at least the size of the first one
+     * @return The reduced dot product
+     */
+    template<typename IteratorA, typename IteratorB>
+    typename std::iterator_traits<IteratorA>::value_type dot(IteratorA firstA, IteratorA lastA, IteratorB firstB) {
+        using RationalType = typename std::iterator_traits<IteratorA>::value_type;
+        using WideType = typename Tools::RationalTraits<RationalType>::Wide;
+        return Tools::sumTerms<RationalType>(firstA, lastA, [&firstB](const IteratorA &iterator) {
+            std::pair<WideType, WideType> product(
+                    WideType(iterator->getNumerator()) * WideType(firstB->getNumerator()),
+                    WideType(iterator->getDenominator()) * WideType(firstB->getDenominator())
+            );
+            ++firstB;
+            return product;
+        });
+    }
+
+    /**
+     * @brief Exact dot product of two containers of rationals
+     * @param a
+     * @param b Must have the size of a (else InvalidAccessArgument is raised)
+     * @return The reduced dot product
+     */
+    template<typename ContainerA, typename ContainerB>
+    auto dot(const ContainerA &a, const ContainerB &b) -> decltype(dot(std::begin(a), std::end(a), std::begin(b))) {
+        using RationalType = std::decay_t<decltype(*std::begin(a))>;
+        if (std::size(a) != std::size(b)) {
+            Tools::RationalTraits<RationalType>::Error::raise(ArkulibError::InvalidAccessArgument);
+            return RationalType();
+        }
+        return dot(std::begin(a), std::end(a), std::begin(b));
+    }
+
+#if defined(__cpp_lib_span)
+    /**
+     * @brief Exact sum of a span of rationals
+     * @param values
+     * @return The reduced sum
+     */
+    template<typename IntType, typename NormalizationPolicy, typename ErrorPolicy, std::size_t Extent>
+    Rational<IntType, NormalizationPolicy, ErrorPolicy> sum(std::span<const Rational<IntType, NormalizationPolicy, ErrorPolicy>, Extent> values) {
+        return sum(values.begin(), values.end());
+    }
+
+    /**
+     * @brief Exact dot product of two spans of rationals
+     * @param a
+     * @param b Must have the size of a (else InvalidAccessArgument is raised)
+     * @return The reduced dot product
+     */
+    template<typename IntType, typename NormalizationPolicy, typename ErrorPolicy, std::size_t ExtentA, std::size_t ExtentB>
+    Rational<IntType, NormalizationPolicy, ErrorPolicy> dot(
+            std::span<const Rational<IntType, NormalizationPolicy, ErrorPolicy>, ExtentA> a,
+            std::span<const Rational<IntType, NormalizationPolicy, ErrorPolicy>, ExtentB> b
+    ) {
+        if (a.size() != b.size()) {
+            ErrorPolicy::raise(ArkulibError::InvalidAccessArgument);
+            return Rational<IntType, NormalizationPolicy, ErrorPolicy>();
+        }
+        return dot(a.begin(), a.end(), b.begin());
+    }
+#endif
+}
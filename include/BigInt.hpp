@@ -0,0 +1,1145 @@
+/**
+ * @file      BigInt.hpp
+ * @author    Elise MASSA
+ * @author    Mattéo LECLERCQ
+ * @date      2022
+ * @brief     Arbitrary-precision signed integer, usable as Rational<BigInt>
+ * @copyright WTFPL
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "Tools/Gcd.hpp"
+#include "Tools/Hash.hpp"
+#include "Tools/IntegerTraits.hpp"
+
+namespace Arkulib {
+    /**
+     * @brief Arbitrary-precision signed integer (sign and magnitude, 32-bit limbs, little endian).
+     *  - Values up to 128 bits are stored inline (no allocation).
+     *  - Multiplication: schoolbook, then Karatsuba above KARATSUBA_THRESHOLD limbs.
+     *  - Division: Knuth's Algorithm D. / and % truncate toward zero, like the builtin integers.
+     *  - GCD: divide-and-conquer (half-GCD) above HALF_GCD_THRESHOLD limbs, Lehmer below, binary GCD on 64 bits.
+     */
+    class BigInt {
+
+    public:
+        using Limb = std::uint32_t;
+        using DoubleLimb = std::uint64_t;
+
+        static constexpr std::size_t LIMB_BITS = 32;
+        static constexpr std::size_t INLINE_LIMBS = 4;
+        static constexpr std::size_t KARATSUBA_THRESHOLD = 32;
+        static constexpr std::size_t HALF_GCD_THRESHOLD = 128;
+
+        /************************************************************************************************************
+         ****************************************** CONSTRUCTOR / DESTRUCTOR ****************************************
+         ************************************************************************************************************/
+
+        /**
+         * @brief Zero
+         */
+        inline BigInt() noexcept = default;
+
+        /**
+         * @brief Create a BigInt from a builtin integer (implicit, like a widening conversion)
+         * @tparam BuiltinType
+         * @param value
+         */
+        template<typename BuiltinType, std::enable_if_t<Tools::isBuiltinInteger<BuiltinType>, int> = 0>
+        inline BigInt(const BuiltinType value) noexcept : m_isNegative(value < BuiltinType(0)) {
+            auto magnitude = Tools::unsignedAbs(value);
+            if constexpr (sizeof(BuiltinType) <= sizeof(Limb)) {
+                m_storage.inlineLimbs[0] = static_cast<Limb>(magnitude);
+                m_size = magnitude != 0;
+            }
+            else {
+                while (magnitude != 0) {
+                    m_storage.inlineLimbs[m_size++] = static_cast<Limb>(magnitude);
+                    magnitude >>= LIMB_BITS;
+                }
+            }
+        }
+
+        /**
+         * @brief Create a BigInt from the integer part of a finite floating point number
+         * @tparam FloatingType
+         * @param value
+         */
+        template<typename FloatingType, std::enable_if_t<std::is_floating_point_v<FloatingType>, int> = 0>
+        explicit BigInt(FloatingType value);
+
+        /**
+         * @brief Create a BigInt from its decimal representation, with an optional sign ("-123456789012345678901")
+         * @param decimal
+         */
+        explicit BigInt(std::string_view decimal);
+
+        inline BigInt(const BigInt &reference) : m_isNegative(reference.m_isNegative) {
+            reserve(reference.m_size);
+            std::copy_n(reference.limbs(), reference.m_size, limbs());
+            m_size = reference.m_size;
+        }
+
+        inline BigInt(BigInt &&reference) noexcept { steal(reference); }
+
+        inline BigInt &operator=(const BigInt &reference) {
+            if (this != &reference) {
+                m_size = 0;
+                reserve(reference.m_size);
+                std::copy_n(reference.limbs(), reference.m_size, limbs());
+                m_size = reference.m_size;
+                m_isNegative = reference.m_isNegative;
+            }
+            return *this;
+        }
+
+        inline BigInt &operator=(BigInt &&reference) noexcept {
+            if (this != &reference) {
+                release();
+                steal(reference);
+            }
+            return *this;
+        }
+
+        inline ~BigInt() { release(); }
+
+        /************************************************************************************************************
+         ************************************************ GETTERS ***************************************************
+         ************************************************************************************************************/
+
+        [[nodiscard]] inline bool isZero() const noexcept { return m_size == 0; }
+
+        [[nodiscard]] inline bool isNegative() const noexcept { return m_isNegative; }
+
+        /**
+         * @return -1, 0 or 1
+         */
+        [[nodiscard]] inline int sign() const noexcept { return m_isNegative ? -1 : m_size != 0; }
+
+        /**
+         * @return The number of limbs of the magnitude
+         */
+        [[nodiscard]] inline std::size_t limbCount() const noexcept { return m_size; }
+
+        /**
+         * @return True if the value is stored without allocation
+         */
+        [[nodiscard]] inline bool isInline() const noexcept { return m_capacity == INLINE_LIMBS; }
+
+        /**
+         * @return The number of significant bits of the magnitude (0 for zero)
+         */
+        [[nodiscard]] inline std::size_t bitLength() const noexcept {
+            if (m_size == 0) return 0;
+            return m_size * LIMB_BITS - static_cast<std::size_t>(Tools::countLeadingZeros(limbs()[m_size - 1]));
+        }
+
+        inline explicit operator bool() const noexcept { return m_size != 0; }
+
+        /**
+         * @brief Convert to a builtin integer (modulo 2^N, like the builtin conversions) or to a floating point number
+         * @tparam ArithmeticType
+         */
+        template<typename ArithmeticType, std::enable_if_t<
+                (Tools::isBuiltinInteger<ArithmeticType> || std::is_floating_point_v<ArithmeticType>)
+                && !std::is_same_v<ArithmeticType, bool>, int> = 0>
+        inline explicit operator ArithmeticType() const noexcept {
+            if constexpr (std::is_floating_point_v<ArithmeticType>) {
+                return toFloatingPoint<ArithmeticType>();
+            }
+            else {
+                using UnsignedType = Tools::UnsignedIntegerType<ArithmeticType>;
+                UnsignedType bits = 0;
+                for (std::size_t i = 0; i < m_size && i * LIMB_BITS < sizeof(UnsignedType) * 8; ++i)
+                    bits |= static_cast<UnsignedType>(static_cast<UnsignedType>(limbs()[i]) << (i * LIMB_BITS));
+                if (m_isNegative) bits = static_cast<UnsignedType>(UnsignedType(0) - bits);
+                return static_cast<ArithmeticType>(bits);
+            }
+        }
+
+        /**
+         * @return The decimal representation
+         */
+        [[nodiscard]] std::string toString() const;
+
+        /**
+         * @brief The remainder modulo a word, without allocation (for the multi-modular algorithms)
+         * @param modulus Must not be zero
+         * @return *this mod modulus, in [0, modulus) even for a negative value
+         */
+        [[nodiscard]] std::uint64_t residue(std::uint64_t modulus) const noexcept;
+
+        /************************************************************************************************************
+         ************************************************ OPERATORS *************************************************
+         ************************************************************************************************************/
+
+        inline friend BigInt operator-(BigInt value) noexcept {
+            if (value.m_size != 0) value.m_isNegative = !value.m_isNegative;
+            return value;
+        }
+
+        inline friend BigInt operator+(const BigInt &a, const BigInt &b) { return addSigned(a, b, b.m_isNegative); }
+
+        inline friend BigInt operator-(const BigInt &a, const BigInt &b) {
+            return addSigned(a, b, b.m_size != 0 && !b.m_isNegative);
+        }
+
+        friend BigInt operator*(const BigInt &a, const BigInt &b);
+
+        inline friend BigInt operator/(const BigInt &a, const BigInt &b) {
+            BigInt quotient;
+            divide(a, b, &quotient, nullptr);
+            return quotient;
+        }
+
+        inline friend BigInt operator%(const BigInt &a, const BigInt &b) {
+            BigInt remainder;
+            divide(a, b, nullptr, &remainder);
+            return remainder;
+        }
+
+        inline BigInt &operator+=(const BigInt &another) { return *this = *this + another; }
+
+        inline BigInt &operator-=(const BigInt &another) { return *this = *this - another; }
+
+        inline BigInt &operator*=(const BigInt &another) { return *this = *this * another; }
+
+        inline BigInt &operator/=(const BigInt &another) { return *this = *this / another; }
+
+        inline BigInt &operator%=(const BigInt &another) { return *this = *this % another; }
+
+        inline BigInt &operator++() { return *this += 1; }
+
+        inline BigInt &operator--() { return *this -= 1; }
+
+        inline BigInt operator++(int) {
+            BigInt previous = *this;
+            ++*this;
+            return previous;
+        }
+
+        inline BigInt operator--(int) {
+            BigInt previous = *this;
+            --*this;
+            return previous;
+        }
+
+        /**
+         * @brief Compute the quotient and the remainder with a single division
+         * @param dividend
+         * @param divisor Must not be 0
+         * @param quotient Can be nullptr
+         * @param remainder Can be nullptr
+         */
+        static void divide(const BigInt &dividend, const BigInt &divisor, BigInt *quotient, BigInt *remainder);
+
+        /************************************************************************************************************
+         *********************************************** COMPARISON *************************************************
+         ************************************************************************************************************/
+
+        inline friend bool operator==(const BigInt &a, const BigInt &b) noexcept {
+            return a.m_isNegative == b.m_isNegative && compareMagnitudes(a, b) == 0;
+        }
+
+        inline friend bool operator!=(const BigInt &a, const BigInt &b) noexcept { return !(a == b); }
+
+        inline friend bool operator<(const BigInt &a, const BigInt &b) noexcept {
+            if (a.m_isNegative != b.m_isNegative) return a.m_isNegative;
+            const int comparison = compareMagnitudes(a, b);
+            return a.m_isNegative ? comparison > 0 : comparison < 0;
+        }
+
+        inline friend bool operator>(const BigInt &a, const BigInt &b) noexcept { return b < a; }
+
+        inline friend bool operator<=(const BigInt &a, const BigInt &b) noexcept { return !(b < a); }
+
+        inline friend bool operator>=(const BigInt &a, const BigInt &b) noexcept { return !(a < b); }
+
+        /************************************************************************************************************
+         ************************************************* MATHS ****************************************************
+         ************************************************************************************************************/
+
+        inline friend BigInt abs(BigInt value) noexcept {
+            value.m_isNegative = false;
+            return value;
+        }
+
+        /**
+         * @brief Divide-and-conquer GCD (see halfGcd)
+         * @param a
+         * @param b
+         * @return The positive GCD of a and b (0 if both are 0)
+         */
+        static BigInt gcd(BigInt a, BigInt b);
+
+        inline friend std::string to_string(const BigInt &value) { return value.toString(); }
+
+        inline friend std::ostream &operator<<(std::ostream &stream, const BigInt &value) {
+            return stream << value.toString();
+        }
+
+    private:
+        union Storage {
+            Limb inlineLimbs[INLINE_LIMBS];
+            Limb *heap;
+        };
+
+        Storage m_storage{};
+        std::uint32_t m_size = 0;
+        std::uint32_t m_capacity = INLINE_LIMBS;
+        bool m_isNegative = false;
+
+        /************************************************************************************************************
+         ************************************************ STORAGE ***************************************************
+         ************************************************************************************************************/
+
+        [[nodiscard]] inline Limb *limbs() noexcept { return isInline() ? m_storage.inlineLimbs : m_storage.heap; }
+
+        [[nodiscard]] inline const Limb *limbs() const noexcept {
+            return isInline() ? m_storage.inlineLimbs : m_storage.heap;
+        }
+
+        /**
+         * @brief Make room for capacity limbs (the current limbs are kept)
+         * @param capacity
+         */
+        inline void reserve(const std::size_t capacity) {
+            if (capacity <= m_capacity) return;
+
+            const std::size_t newCapacity = std::max<std::size_t>(capacity, 2 * m_capacity);
+            Limb *heap = new Limb[newCapacity];
+            std::copy_n(limbs(), m_size, heap);
+            release();
+            m_storage.heap = heap;
+            m_capacity = static_cast<std::uint32_t>(newCapacity);
+        }
+
+        /**
+         * @brief Set the number of limbs. The new limbs are 0.
+         * @param size
+         */
+        inline void resize(const std::size_t size) {
+            reserve(size);
+            if (size > m_size) std::fill(limbs() + m_size, limbs() + size, Limb(0));
+            m_size = static_cast<std::uint32_t>(size);
+        }
+
+        /**
+         * @brief Remove the leading zero limbs (zero is never negative)
+         */
+        inline void trim() noexcept {
+            const Limb *data = limbs();
+            while (m_size > 0 && data[m_size - 1] == 0) --m_size;
+            if (m_size == 0) m_isNegative = false;
+        }
+
+        /**
+         * @brief trim() then move the limbs back inline when they fit (the heap is released)
+         */
+        inline void compact() noexcept {
+            trim();
+            if (isInline() || m_size > INLINE_LIMBS) return;
+
+            Limb *heap = m_storage.heap;
+            std::copy_n(heap, m_size, m_storage.inlineLimbs);
+            delete[] heap;
+            m_capacity = INLINE_LIMBS;
+        }
+
+        inline void release() noexcept {
+            if (!isInline()) delete[] m_storage.heap;
+            m_capacity = INLINE_LIMBS;
+        }
+
+        inline void steal(BigInt &reference) noexcept {
+            m_storage = reference.m_storage;
+            m_size = reference.m_size;
+            m_capacity = reference.m_capacity;
+            m_isNegative = reference.m_isNegative;
+            reference.m_capacity = INLINE_LIMBS;
+            reference.m_size = 0;
+            reference.m_isNegative = false;
+        }
+
+        template<typename FloatingType>
+        [[nodiscard]] FloatingType toFloatingPoint() const noexcept;
+
+        /************************************************************************************************************
+         ******************************************** MAGNITUDE KERNELS *********************************************
+         ************************************************************************************************************/
+
+        /**
+         * @return -1, 0 or 1 if |a| is lower, equal or greater than |b|
+         */
+        static int compareMagnitudes(const BigInt &a, const BigInt &b) noexcept;
+
+        /**
+         * @return a + (bIsNegative ? -|b| : |b|)
+         */
+        static BigInt addSigned(const BigInt &a, const BigInt &b, bool bIsNegative);
+
+        /**
+         * @brief target[0 .. targetSize) += source[0 .. sourceSize) (sourceSize <= targetSize)
+         * @return The carry out of target
+         */
+        static Limb addLimbs(Limb *target, std::size_t targetSize, const Limb *source, std::size_t sourceSize) noexcept;
+
+        /**
+         * @brief target[0 .. targetSize) -= source[0 .. sourceSize) (sourceSize <= targetSize)
+         * @return The borrow out of target
+         */
+        static Limb subtractLimbs(Limb *target, std::size_t targetSize, const Limb *source, std::size_t sourceSize) noexcept;
+
+        /**
+         * @brief out[0 .. aSize + bSize) = a * b (out must not overlap a or b)
+         */
+        static void multiplyLimbs(const Limb *a, std::size_t aSize, const Limb *b, std::size_t bSize, Limb *out);
+
+        static void multiplySchoolbook(const Limb *a, std::size_t aSize, const Limb *b, std::size_t bSize, Limb *out) noexcept;
+
+        /**
+         * @brief Karatsuba multiplication for bSize <= aSize < 2 * bSize
+         */
+        static void multiplyKaratsuba(const Limb *a, std::size_t aSize, const Limb *b, std::size_t bSize, Limb *out);
+
+        /**
+         * @brief *this = *this * factor + addend (magnitude only)
+         */
+        void multiplyAddLimb(Limb factor, Limb addend);
+
+        /**
+         * @brief *this /= divisor (magnitude only)
+         * @return The remainder
+         */
+        Limb divideLimb(Limb divisor) noexcept;
+
+        /**
+         * @return |*this| * 2^bits
+         */
+        [[nodiscard]] BigInt shiftedLeft(std::size_t bits) const;
+
+        /**
+         * @return |*this| / 2^bits
+         */
+        [[nodiscard]] BigInt shiftedRight(std::size_t bits) const;
+
+        /************************************************************************************************************
+         ************************************************** GCD *****************************************************
+         ************************************************************************************************************/
+
+        /**
+         * @brief Unimodular 2x2 matrix: (x', y') = (m00 * x + m01 * y, m10 * x + m11 * y)
+         */
+        struct CofactorMatrix;
+
+        /**
+         * @brief Replace (x, y) by (y, x - q * y) with q = x / y
+         */
+        static void euclideanStep(BigInt &x, BigInt &y, CofactorMatrix *matrix);
+
+        /**
+         * @brief Lehmer step: the quotients are guessed on the 62 leading bits (Knuth, Algorithm L) then applied
+         * once to x and y. Falls back to euclideanStep when no quotient can be guessed.
+         * @param x Must have more than 62 bits
+         * @param y
+         * @param matrix If not null, multiplied on the left by the matrix of the steps done
+         * @param target The guessed steps stop before y goes below 2^target
+         */
+        static void lehmerStep(BigInt &x, BigInt &y, CofactorMatrix *matrix, std::size_t target = 0);
+
+        /**
+         * @brief Replace (x, y) by matrix * (x, y). The signs and the order are fixed so that x >= y >= 0,
+         * the matrix is updated accordingly (it stays unimodular, so the GCD is kept).
+         */
+        static void applyMatrix(CofactorMatrix &matrix, BigInt &x, BigInt &y);
+
+        /**
+         * @return left * right
+         */
+        static CofactorMatrix multiplyMatrices(const CofactorMatrix &left, const CofactorMatrix &right);
+
+        /**
+         * @brief Half-GCD: run the Euclidean algorithm on x >= y >= 0 until y has about half the bits of x.
+         * The quotients of the first half are found recursively on the leading half of x and y, applied to the whole
+         * numbers, then the second half is found the same way. Since every matrix is unimodular, a wrong guessed
+         * quotient only costs time: the last exact steps restore the bound.
+         * @param x
+         * @param y
+         * @param matrix If not null, multiplied on the left by the matrix of the steps done
+         */
+        static void halfGcd(BigInt &x, BigInt &y, CofactorMatrix *matrix);
+    };
+
+    /************************************************************************************************************
+     ************************************************************************************************************/
+
+
+
+    struct BigInt::CofactorMatrix {
+        BigInt m00 = 1, m01 = 0, m10 = 0, m11 = 1;
+    };
+
+
+
+    /************************************************************************************************************
+     ********************************************* CONSTRUCTOR DEF **********************************************
+     ************************************************************************************************************/
+
+    template<typename FloatingType, std::enable_if_t<std::is_floating_point_v<FloatingType>, int>>
+    BigInt::BigInt(const FloatingType value) {
+        assert(std::isfinite(value) && "A BigInt can't be created from an infinite or NaN value");
+
+        int exponent = 0;
+        FloatingType fraction = std::frexp(std::trunc(std::fabs(value)), &exponent);
+        if (exponent <= 0) return;
+
+        // fraction is in [0.5, 1): the limbs are read from the top, LIMB_BITS bits at a time
+        const std::size_t size = (static_cast<std::size_t>(exponent) + LIMB_BITS - 1) / LIMB_BITS;
+        resize(size);
+        auto bits = static_cast<int>(static_cast<std::size_t>(exponent) - LIMB_BITS * (size - 1));
+        for (std::size_t i = size; i-- > 0;) {
+            fraction = std::ldexp(fraction, bits);
+            const FloatingType chunk = std::floor(fraction);
+            limbs()[i] = static_cast<Limb>(chunk);
+            fraction -= chunk;
+            bits = LIMB_BITS;
+        }
+
+        m_isNegative = value < 0;
+        trim();
+    }
+
+    inline BigInt::BigInt(const std::string_view decimal) {
+        std::size_t position = 0;
+        bool isNegative = false;
+        if (!decimal.empty() && (decimal[0] == '-' || decimal[0] == '+')) {
+            isNegative = decimal[0] == '-';
+            position = 1;
+        }
+        assert(position < decimal.size() && "A BigInt can't be created from an empty string");
+
+        // Chunks of 9 digits: 10^9 fits in a limb
+        constexpr Limb POWERS_OF_TEN[] = {1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000};
+        std::size_t chunkSize = (decimal.size() - position) % 9;
+        if (chunkSize == 0) chunkSize = 9;
+
+        while (position < decimal.size()) {
+            Limb chunk = 0;
+            for (std::size_t i = 0; i < chunkSize; ++i) {
+                const char digit = decimal[position + i];
+                assert(digit >= '0' && digit <= '9' && "A BigInt can only be created from decimal digits");
+                chunk = chunk * 10 + static_cast<Limb>(digit - '0');
+            }
+            multiplyAddLimb(POWERS_OF_TEN[chunkSize], chunk);
+            position += chunkSize;
+            chunkSize = 9;
+        }
+
+        m_isNegative = isNegative;
+        trim();
+    }
+
+    /************************************************************************************************************
+     ********************************************** CONVERSION DEF **********************************************
+     ************************************************************************************************************/
+
+    template<typename FloatingType>
+    FloatingType BigInt::toFloatingPoint() const noexcept {
+        // 4 limbs cover the mantissa of every floating point type (113 bits at most)
+        const Limb *data = limbs();
+        const std::size_t used = std::min<std::size_t>(m_size, 4);
+        FloatingType result = 0;
+        for (std::size_t i = m_size; i-- > m_size - used;) result = result * FloatingType(4294967296.) + FloatingType(data[i]);
+        result = std::ldexp(result, static_cast<int>(LIMB_BITS * (m_size - used)));
+        return m_isNegative ? -result : result;
+    }
+
+    inline std::string BigInt::toString() const {
+        if (m_size == 0) return "0";
+
+        // Chunks of 9 digits, from the lowest
+        BigInt magnitude = *this;
+        std::string digits;
+        while (!magnitude.isZero()) {
+            Limb chunk = magnitude.divideLimb(1000000000);
+            for (int i = 0; i < 9; ++i) {
+                digits.push_back(static_cast<char>('0' + chunk % 10));
+                chunk /= 10;
+            }
+        }
+
+        while (digits.size() > 1 && digits.back() == '0') digits.pop_back();
+        if (m_isNegative) digits.push_back('-');
+        std::reverse(digits.begin(), digits.end());
+        return digits;
+    }
+
+    inline std::uint64_t BigInt::residue(const std::uint64_t modulus) const noexcept {
+        // Horner from the highest limb: remainder = (remainder * 2^32 + limb) mod modulus
+        const Limb *data = limbs();
+        std::uint64_t remainder = 0;
+        for (std::size_t i = m_size; i-- > 0;) {
+#ifdef __SIZEOF_INT128__
+            remainder = static_cast<std::uint64_t>(((Tools::UInt128(remainder) << LIMB_BITS) | data[i]) % modulus);
+#else
+            for (std::size_t bit = LIMB_BITS; bit-- > 0;) {
+                const bool carry = remainder >> 63;
+                remainder = (remainder << 1) | ((data[i] >> bit) & 1U);
+                if (carry || remainder >= modulus) remainder -= modulus;
+            }
+#endif
+        }
+        return (m_isNegative && remainder != 0) ? modulus - remainder : remainder;
+    }
+
+    /************************************************************************************************************
+     ****************************************** MAGNITUDE KERNELS DEF *******************************************
+     ************************************************************************************************************/
+
+    inline int BigInt::compareMagnitudes(const BigInt &a, const BigInt &b) noexcept {
+        if (a.m_size != b.m_size) return a.m_size < b.m_size ? -1 : 1;
+
+        const Limb *aLimbs = a.limbs();
+        const Limb *bLimbs = b.limbs();
+        for (std::size_t i = a.m_size; i-- > 0;) {
+            if (aLimbs[i] != bLimbs[i]) return aLimbs[i] < bLimbs[i] ? -1 : 1;
+        }
+        return 0;
+    }
+
+    inline BigInt::Limb BigInt::addLimbs(
+            Limb *target, const std::size_t targetSize,
+            const Limb *source, const std::size_t sourceSize
+    ) noexcept {
+        DoubleLimb carry = 0;
+        std::size_t i = 0;
+        for (; i < sourceSize; ++i) {
+            const DoubleLimb sum = DoubleLimb(target[i]) + source[i] + carry;
+            target[i] = static_cast<Limb>(sum);
+            carry = sum >> LIMB_BITS;
+        }
+        for (; carry != 0 && i < targetSize; ++i) {
+            const DoubleLimb sum = DoubleLimb(target[i]) + carry;
+            target[i] = static_cast<Limb>(sum);
+            carry = sum >> LIMB_BITS;
+        }
+        return static_cast<Limb>(carry);
+    }
+
+    inline BigInt::Limb BigInt::subtractLimbs(
+            Limb *target, const std::size_t targetSize,
+            const Limb *source, const std::size_t sourceSize
+    ) noexcept {
+        DoubleLimb borrow = 0;
+        std::size_t i = 0;
+        for (; i < sourceSize; ++i) {
+            const DoubleLimb difference = DoubleLimb(target[i]) - source[i] - borrow;
+            target[i] = static_cast<Limb>(difference);
+            borrow = (difference >> LIMB_BITS) & 1;
+        }
+        for (; borrow != 0 && i < targetSize; ++i) {
+            const DoubleLimb difference = DoubleLimb(target[i]) - borrow;
+            target[i] = static_cast<Limb>(difference);
+            borrow = (difference >> LIMB_BITS) & 1;
+        }
+        return static_cast<Limb>(borrow);
+    }
+
+    inline BigInt BigInt::addSigned(const BigInt &a, const BigInt &b, const bool bIsNegative) {
+        BigInt result;
+        if (a.m_isNegative == bIsNegative) {
+            const BigInt &larger = a.m_size >= b.m_size ? a : b;
+            const BigInt &smaller = a.m_size >= b.m_size ? b : a;
+            result.resize(larger.m_size);
+            std::copy_n(larger.limbs(), larger.m_size, result.limbs());
+            const Limb carry = addLimbs(result.limbs(), result.m_size, smaller.limbs(), smaller.m_size);
+            if (carry != 0) {
+                result.resize(larger.m_size + 1);
+                result.limbs()[larger.m_size] = carry;
+            }
+            result.m_isNegative = bIsNegative;
+        }
+        else {
+            // |larger| - |smaller| with the sign of the larger
+            const bool isAGreater = compareMagnitudes(a, b) >= 0;
+            const BigInt &larger = isAGreater ? a : b;
+            const BigInt &smaller = isAGreater ? b : a;
+            result.resize(larger.m_size);
+            std::copy_n(larger.limbs(), larger.m_size, result.limbs());
+            subtractLimbs(result.limbs(), result.m_size, smaller.limbs(), smaller.m_size);
+            result.m_isNegative = isAGreater ? a.m_isNegative : bIsNegative;
+        }
+        result.compact();
+        return result;
+    }
+
+    inline void BigInt::multiplySchoolbook(
+            const Limb *a, const std::size_t aSize,
+            const Limb *b, const std::size_t bSize,
+            Limb *out
+    ) noexcept {
+        std::fill_n(out, aSize + bSize, Limb(0));
+        for (std::size_t i = 0; i < aSize; ++i) {
+            const DoubleLimb aLimb = a[i];
+            if (aLimb == 0) continue;
+
+            DoubleLimb carry = 0;
+            for (std::size_t j = 0; j < bSize; ++j) {
+                const DoubleLimb product = aLimb * b[j] + out[i + j] + carry;
+                out[i + j] = static_cast<Limb>(product);
+                carry = product >> LIMB_BITS;
+            }
+            out[i + bSize] = static_cast<Limb>(carry);
+        }
+    }
+
+    inline void BigInt::multiplyLimbs(
+            const Limb *a, std::size_t aSize,
+            const Limb *b, std::size_t bSize,
+            Limb *out
+    ) {
+        if (aSize < bSize) {
+            std::swap(a, b);
+            std::swap(aSize, bSize);
+        }
+
+        if (bSize < KARATSUBA_THRESHOLD) {
+            multiplySchoolbook(a, aSize, b, bSize, out);
+        }
+        else if (aSize >= 2 * bSize) {
+            // Unbalanced: a is cut into chunks of bSize limbs
+            std::fill_n(out, aSize + bSize, Limb(0));
+            std::vector<Limb> partial(2 * bSize);
+            for (std::size_t offset = 0; offset < aSize; offset += bSize) {
+                const std::size_t chunkSize = std::min(bSize, aSize - offset);
+                multiplyLimbs(a + offset, chunkSize, b, bSize, partial.data());
+                addLimbs(out + offset, aSize + bSize - offset, partial.data(), chunkSize + bSize);
+            }
+        }
+        else {
+            multiplyKaratsuba(a, aSize, b, bSize, out);
+        }
+    }
+
+    inline void BigInt::multiplyKaratsuba(
+            const Limb *a, const std::size_t aSize,
+            const Limb *b, const std::size_t bSize,
+            Limb *out
+    ) {
+        // a = a1 * B^half + a0 and b = b1 * B^half + b0. bSize > aSize / 2 so b1 isn't empty.
+        const std::size_t half = aSize / 2;
+        const std::size_t a1Size = aSize - half;
+        const std::size_t b1Size = bSize - half;
+
+        // z0 = a0 * b0 in the low part of out, z2 = a1 * b1 in the high part
+        multiplyLimbs(a, half, b, half, out);
+        multiplyLimbs(a + half, a1Size, b + half, b1Size, out + 2 * half);
+
+        // z1 = (a0 + a1) * (b0 + b1) - z0 - z2
+        std::vector<Limb> aSum(a1Size + 1, 0);
+        std::copy_n(a + half, a1Size, aSum.begin());
+        addLimbs(aSum.data(), aSum.size(), a, half);
+
+        const std::size_t bSumSize = std::max(half, b1Size) + 1;
+        std::vector<Limb> bSum(bSumSize, 0);
+        std::copy_n(b, half, bSum.begin());
+        addLimbs(bSum.data(), bSumSize, b + half, b1Size);
+
+        std::vector<Limb> middle(aSum.size() + bSumSize);
+        multiplyLimbs(aSum.data(), aSum.size(), bSum.data(), bSumSize, middle.data());
+        subtractLimbs(middle.data(), middle.size(), out, 2 * half);
+        subtractLimbs(middle.data(), middle.size(), out + 2 * half, a1Size + b1Size);
+
+        std::size_t middleSize = middle.size();
+        while (middleSize > 0 && middle[middleSize - 1] == 0) --middleSize;
+        addLimbs(out + half, aSize + bSize - half, middle.data(), middleSize);
+    }
+
+    inline BigInt operator*(const BigInt &a, const BigInt &b) {
+        BigInt result;
+        if (a.m_size == 0 || b.m_size == 0) return result;
+
+        result.resize(a.m_size + b.m_size);
+        BigInt::multiplyLimbs(a.limbs(), a.m_size, b.limbs(), b.m_size, result.limbs());
+        result.m_isNegative = a.m_isNegative != b.m_isNegative;
+        result.compact();
+        return result;
+    }
+
+    inline void BigInt::multiplyAddLimb(const Limb factor, const Limb addend) {
+        DoubleLimb carry = addend;
+        Limb *data = limbs();
+        for (std::size_t i = 0; i < m_size; ++i) {
+            const DoubleLimb product = DoubleLimb(data[i]) * factor + carry;
+            data[i] = static_cast<Limb>(product);
+            carry = product >> LIMB_BITS;
+        }
+        if (carry != 0) {
+            resize(m_size + 1);
+            limbs()[m_size - 1] = static_cast<Limb>(carry);
+        }
+    }
+
+    inline BigInt::Limb BigInt::divideLimb(const Limb divisor) noexcept {
+        DoubleLimb remainder = 0;
+        Limb *data = limbs();
+        for (std::size_t i = m_size; i-- > 0;) {
+            const DoubleLimb current = (remainder << LIMB_BITS) | data[i];
+            data[i] = static_cast<Limb>(current / divisor);
+            remainder = current % divisor;
+        }
+        trim();
+        return static_cast<Limb>(remainder);
+    }
+
+    inline void BigInt::divide(const BigInt &dividend, const BigInt &divisor, BigInt *quotient, BigInt *remainder) {
+        assert(!divisor.isZero() && "Division of a BigInt by zero");
+
+        if (compareMagnitudes(dividend, divisor) < 0) {
+            if (remainder) *remainder = dividend;
+            if (quotient) *quotient = BigInt();
+            return;
+        }
+
+        const bool isQuotientNegative = dividend.m_isNegative != divisor.m_isNegative;
+        const bool isRemainderNegative = dividend.m_isNegative;
+
+        if (divisor.m_size == 1) {
+            BigInt result = dividend;
+            const Limb rest = result.divideLimb(divisor.limbs()[0]);
+            result.m_isNegative = isQuotientNegative;
+            result.compact();
+            if (remainder) {
+                *remainder = BigInt(rest);
+                remainder->m_isNegative = isRemainderNegative && rest != 0;
+            }
+            if (quotient) *quotient = std::move(result);
+            return;
+        }
+
+        // Knuth, Algorithm D: the divisor is normalized so that its leading limb has its highest bit set
+        const std::size_t m = dividend.m_size;
+        const std::size_t n = divisor.m_size;
+        const Limb *u = dividend.limbs();
+        const Limb *v = divisor.limbs();
+        const int shift = Tools::countLeadingZeros(v[n - 1]);
+
+        std::vector<Limb> vn(n), un(m + 1);
+        for (std::size_t i = n - 1; i > 0; --i)
+            vn[i] = static_cast<Limb>((DoubleLimb(v[i]) << shift) | (DoubleLimb(v[i - 1]) >> (LIMB_BITS - shift)));
+        vn[0] = static_cast<Limb>(DoubleLimb(v[0]) << shift);
+        un[m] = static_cast<Limb>(DoubleLimb(u[m - 1]) >> (LIMB_BITS - shift));
+        for (std::size_t i = m - 1; i > 0; --i)
+            un[i] = static_cast<Limb>((DoubleLimb(u[i]) << shift) | (DoubleLimb(u[i - 1]) >> (LIMB_BITS - shift)));
+        un[0] = static_cast<Limb>(DoubleLimb(u[0]) << shift);
+
+        BigInt result;
+        result.resize(m - n + 1);
+        Limb *q = result.limbs();
+        constexpr DoubleLimb BASE = DoubleLimb(1) << LIMB_BITS;
+
+        for (std::size_t j = m - n + 1; j-- > 0;) {
+            // Estimate the quotient digit with the two leading limbs, then correct it (at most twice)
+            const DoubleLimb numerator = (DoubleLimb(un[j + n]) << LIMB_BITS) | un[j + n - 1];
+            DoubleLimb quotientDigit = numerator / vn[n - 1];
+            DoubleLimb rest = numerator - quotientDigit * vn[n - 1];
+            while (quotientDigit >= BASE || quotientDigit * vn[n - 2] > ((rest << LIMB_BITS) | un[j + n - 2])) {
+                --quotientDigit;
+                rest += vn[n - 1];
+                if (rest >= BASE) break;
+            }
+
+            // un[j .. j + n] -= quotientDigit * vn
+            std::int64_t borrow = 0;
+            for (std::size_t i = 0; i < n; ++i) {
+                const DoubleLimb product = quotientDigit * vn[i];
+                const std::int64_t difference = std::int64_t(un[i + j]) - borrow - std::int64_t(product & 0xFFFFFFFFu);
+                un[i + j] = static_cast<Limb>(difference);
+                borrow = std::int64_t(product >> LIMB_BITS) - (difference >> LIMB_BITS);
+            }
+            const std::int64_t top = std::int64_t(un[j + n]) - borrow;
+            un[j + n] = static_cast<Limb>(top);
+
+            q[j] = static_cast<Limb>(quotientDigit);
+            if (top < 0) {
+                // The estimate was one too large: add the divisor back
+                --q[j];
+                un[j + n] += addLimbs(un.data() + j, n, vn.data(), n);
+            }
+        }
+
+        if (remainder) {
+            BigInt rest;
+            rest.resize(n);
+            Limb *r = rest.limbs();
+            for (std::size_t i = 0; i < n; ++i)
+                r[i] = static_cast<Limb>((DoubleLimb(un[i]) >> shift) | (DoubleLimb(un[i + 1]) << (LIMB_BITS - shift)));
+            rest.m_isNegative = isRemainderNegative;
+            rest.compact();
+            *remainder = std::move(rest);
+        }
+        if (quotient) {
+            result.m_isNegative = isQuotientNegative;
+            result.compact();
+            *quotient = std::move(result);
+        }
+    }
+
+    inline BigInt BigInt::shiftedLeft(const std::size_t bits) const {
+        BigInt result;
+        if (m_size == 0) return result;
+
+        const std::size_t limbShift = bits / LIMB_BITS;
+        const std::size_t bitShift = bits % LIMB_BITS;
+        result.resize(m_size + limbShift + 1);
+
+        const Limb *data = limbs();
+        Limb *out = result.limbs();
+        for (std::size_t i = m_size; i-- > 0;) {
+            out[i + limbShift + 1] |= static_cast<Limb>(DoubleLimb(data[i]) >> (LIMB_BITS - bitShift));
+            out[i + limbShift] = static_cast<Limb>(DoubleLimb(data[i]) << bitShift);
+        }
+        result.compact();
+        return result;
+    }
+
+    inline BigInt BigInt::shiftedRight(const std::size_t bits) const {
+        BigInt result;
+        const std::size_t limbShift = bits / LIMB_BITS;
+        if (limbShift >= m_size) return result;
+
+        const std::size_t bitShift = bits % LIMB_BITS;
+        const std::size_t size = m_size - limbShift;
+        result.resize(size);
+
+        const Limb *data = limbs() + limbShift;
+        Limb *out = result.limbs();
+        for (std::size_t i = 0; i < size; ++i) {
+            const DoubleLimb high = i + 1 < size ? DoubleLimb(data[i + 1]) << (LIMB_BITS - bitShift) : 0;
+            out[i] = static_cast<Limb>((DoubleLimb(data[i]) >> bitShift) | high);
+        }
+        result.compact();
+        return result;
+    }
+
+    /************************************************************************************************************
+     ************************************************** GCD DEF *************************************************
+     ************************************************************************************************************/
+
+    inline void BigInt::euclideanStep(BigInt &x, BigInt &y, CofactorMatrix *matrix) {
+        BigInt quotient, remainder;
+        divide(x, y, &quotient, &remainder);
+        x = std::move(y);
+        y = std::move(remainder);
+
+        if (matrix) {
+            // New rows: (row1, row0 - q * row1)
+            BigInt m10 = matrix->m00 - quotient * matrix->m10;
+            BigInt m11 = matrix->m01 - quotient * matrix->m11;
+            matrix->m00 = std::move(matrix->m10);
+            matrix->m01 = std::move(matrix->m11);
+            matrix->m10 = std::move(m10);
+            matrix->m11 = std::move(m11);
+        }
+    }
+
+    inline void BigInt::lehmerStep(BigInt &x, BigInt &y, CofactorMatrix *matrix, const std::size_t target) {
+        // Same shift on both operands: xh has exactly 62 significant bits
+        const std::size_t shift = x.bitLength() - 62;
+        auto xh = static_cast<std::int64_t>(x.shiftedRight(shift));
+        auto yh = static_cast<std::int64_t>(y.shiftedRight(shift));
+        const std::int64_t minimumYh = target > shift ? std::int64_t(1) << std::min<std::size_t>(62, target - shift) : 0;
+
+        std::int64_t A = 1, B = 0, C = 0, D = 1;
+        while (yh + C != 0 && yh + D != 0) {
+            const std::int64_t quotient = (xh + A) / (yh + C);
+            if (quotient != (xh + B) / (yh + D)) break;
+
+            const std::int64_t nextYh = xh - quotient * yh;
+            if (nextYh < minimumYh) break;
+
+            std::int64_t tmp = A - quotient * C; A = C; C = tmp;
+            tmp = B - quotient * D; B = D; D = tmp;
+            xh = yh; yh = nextYh;
+        }
+
+        if (B == 0) {
+            euclideanStep(x, y, matrix);
+            return;
+        }
+
+        BigInt newX = BigInt(A) * x + BigInt(B) * y;
+        y = BigInt(C) * x + BigInt(D) * y;
+        x = std::move(newX);
+
+        if (matrix) {
+            BigInt m00 = BigInt(A) * matrix->m00 + BigInt(B) * matrix->m10;
+            BigInt m01 = BigInt(A) * matrix->m01 + BigInt(B) * matrix->m11;
+            BigInt m10 = BigInt(C) * matrix->m00 + BigInt(D) * matrix->m10;
+            matrix->m11 = BigInt(C) * matrix->m01 + BigInt(D) * matrix->m11;
+            matrix->m00 = std::move(m00);
+            matrix->m01 = std::move(m01);
+            matrix->m10 = std::move(m10);
+        }
+    }
+
+    inline BigInt::CofactorMatrix BigInt::multiplyMatrices(const CofactorMatrix &left, const CofactorMatrix &right) {
+        CofactorMatrix product;
+        product.m00 = left.m00 * right.m00 + left.m01 * right.m10;
+        product.m01 = left.m00 * right.m01 + left.m01 * right.m11;
+        product.m10 = left.m10 * right.m00 + left.m11 * right.m10;
+        product.m11 = left.m10 * right.m01 + left.m11 * right.m11;
+        return product;
+    }
+
+    inline void BigInt::applyMatrix(CofactorMatrix &matrix, BigInt &x, BigInt &y) {
+        BigInt newX = matrix.m00 * x + matrix.m01 * y;
+        BigInt newY = matrix.m10 * x + matrix.m11 * y;
+
+        if (newX.isNegative()) {
+            newX = -newX;
+            matrix.m00 = -matrix.m00;
+            matrix.m01 = -matrix.m01;
+        }
+        if (newY.isNegative()) {
+            newY = -newY;
+            matrix.m10 = -matrix.m10;
+            matrix.m11 = -matrix.m11;
+        }
+        if (newX < newY) {
+            std::swap(newX, newY);
+            std::swap(matrix.m00, matrix.m10);
+            std::swap(matrix.m01, matrix.m11);
+        }
+
+        x = std::move(newX);
+        y = std::move(newY);
+    }
+
+    inline void BigInt::halfGcd(BigInt &x, BigInt &y, CofactorMatrix *matrix) {
+        // Stop when y < 2^target
+        const std::size_t target = x.bitLength() / 2 + 1;
+        if (y.bitLength() <= target) return;
+
+        if (x.m_size >= HALF_GCD_THRESHOLD) {
+            // First half: the quotients of the leading half of x and y
+            {
+                CofactorMatrix firstMatrix;
+                const std::size_t shift = x.bitLength() / 2;
+                BigInt xHigh = x.shiftedRight(shift), yHigh = y.shiftedRight(shift);
+                halfGcd(xHigh, yHigh, &firstMatrix);
+                applyMatrix(firstMatrix, x, y);
+                if (matrix) *matrix = multiplyMatrices(firstMatrix, *matrix);
+            }
+            if (y.bitLength() <= target) return;
+            euclideanStep(x, y, matrix);
+
+            // Second half: x has about 3/4 of the bits left, its leading 2 * (bits - target) bits give the quotients
+            const std::size_t bits = x.bitLength();
+            if (y.bitLength() > target && bits > target) {
+                CofactorMatrix secondMatrix;
+                const std::size_t shift = 2 * target > bits ? 2 * target - bits : 0;
+                BigInt xHigh = x.shiftedRight(shift), yHigh = y.shiftedRight(shift);
+                halfGcd(xHigh, yHigh, &secondMatrix);
+                applyMatrix(secondMatrix, x, y);
+                if (matrix) *matrix = multiplyMatrices(secondMatrix, *matrix);
+            }
+        }
+
+        // Lehmer then exact steps until the bound is reached
+        while (y.bitLength() > target) {
+            if (x.bitLength() > 64) lehmerStep(x, y, matrix, target);
+            else euclideanStep(x, y, matrix);
+        }
+    }
+
+    inline BigInt BigInt::gcd(BigInt a, BigInt b) {
+        a.m_isNegative = false;
+        b.m_isNegative = false;
+        if (a < b) std::swap(a, b);
+
+        while (!b.isZero()) {
+            if (a.m_size <= 2) {
+                return BigInt(Tools::binaryGcd(static_cast<std::uint64_t>(a), static_cast<std::uint64_t>(b)));
+            }
+#ifdef __SIZEOF_INT128__
+            if (a.m_size <= 4) {
+                return BigInt(Tools::lehmerGcd(static_cast<Tools::UInt128>(a), static_cast<Tools::UInt128>(b)));
+            }
+#endif
+
+            if (a.m_size - b.m_size > 1) {
+                // Very different sizes: one division brings them together
+                euclideanStep(a, b, nullptr);
+            }
+            else if (b.m_size >= HALF_GCD_THRESHOLD) {
+                halfGcd(a, b, nullptr);
+                if (!b.isZero()) euclideanStep(a, b, nullptr);
+            }
+            else {
+                lehmerStep(a, b, nullptr);
+            }
+        }
+        return a;
+    }
+}
+
+/************************************************************************************************************
+ ************************************************** TRAITS **************************************************
+ ************************************************************************************************************/
+
+namespace Arkulib::Tools {
+    /**
+     * @brief BigInt plugs into Rational<BigInt>: it never overflows and brings its own GCD
+     */
+    template<>
+    struct IntegerTraits<BigInt> {
+        static constexpr bool isInteger = true;
+        static constexpr bool isBounded = false;
+
+        static inline BigInt gcd(const BigInt &a, const BigInt &b) { return BigInt::gcd(a, b); }
+    };
+}
+
+namespace std {
+    template<>
+    struct numeric_limits<Arkulib::BigInt> {
+        static constexpr bool is_specialized = true;
+        static constexpr bool is_signed = true;
+        static constexpr bool is_integer = true;
+        static constexpr bool is_exact = true;
+        static constexpr bool is_bounded = false;
+        static constexpr bool is_modulo = false;
+        static constexpr int radix = 2;
+        static constexpr int digits = 0;
+        static constexpr int digits10 = 0;
+
+        static Arkulib::BigInt min() noexcept { return {}; }
+        static Arkulib::BigInt max() noexcept { return {}; }
+        static Arkulib::BigInt lowest() noexcept { return {}; }
+    };
+
+    /**
+     * @brief Hash of the value, from its remainder modulo the prime 2^61 - 1
+     */
+    template<>
+    struct hash<Arkulib::BigInt> {
+        inline std::size_t operator()(const Arkulib::BigInt &value) const noexcept {
+            return static_cast<std::size_t>(Arkulib::Tools::mixHash(value.residue((std::uint64_t(1) << 61) - 1)));
+        }
+    };
+}
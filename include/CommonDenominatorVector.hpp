@@ -0,0 +1,444 @@
+/**
+ * @file      CommonDenominatorVector.hpp
+ * @author    Elise MASSA
+ * @author    Mattéo LECLERCQ
+ * @date      2022
+ * @brief     Vector of rationals sharing one denominator (prices in 1/256ths...): the additions are SIMD integer
+ *            additions of the numerators, rescaled only when the denominators differ
+ * @copyright WTFPL
+ */
+
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "Rational.hpp"
+#include "RationalVector.hpp"
+#include "Tools/AlignedAllocator.hpp"
+#include "Tools/SimdKernels.hpp"
+
+namespace Arkulib {
+    /**
+     * @brief Rationals numerator[i] / denominator with one positive denominator for the whole vector.
+     * The denominator is the least common multiple of the denominators of the elements when it's built from rationals.
+     * After an addition, it can be larger than needed: simplify() finds the smallest one again, only when it's called
+     * and only if an operation may have changed it.
+     * @tparam IntType A builtin signed integer (the 32-bit integers use the SIMD kernels)
+     * @tparam ErrorPolicy Used by the constructors, push_back and the operators (the static kernels return a mask)
+     */
+    template<typename IntType = int, typename ErrorPolicy = Policies::DefaultErrorPolicy>
+    class CommonDenominatorVector {
+        static_assert(Tools::isBuiltinInteger<IntType> && std::is_signed_v<IntType>, "CommonDenominatorVector needs a builtin signed integer");
+
+    public:
+        using RationalType = Rational<IntType, Policies::Canonical, ErrorPolicy>;
+        using Storage = std::vector<IntType, Tools::AlignedAllocator<IntType>>;
+
+        /************************************************************************************************************
+         ****************************************** CONSTRUCTOR / DESTRUCTOR ****************************************
+         ************************************************************************************************************/
+
+        /**
+         * @brief Instantiate an empty vector over 1
+         */
+        inline CommonDenominatorVector() noexcept = default;
+
+        /**
+         * @brief Instantiate size zeros over a denominator
+         * @param size
+         * @param denominator Must be positive
+         */
+        explicit CommonDenominatorVector(std::size_t size, IntType denominator = 1) noexcept(ErrorPolicy::isNoexcept);
+
+        /**
+         * @brief Put rationals over the least common multiple of their denominators
+         * @param rationals
+         */
+        template<typename NormalizationPolicy, typename AnotherErrorPolicy>
+        explicit CommonDenominatorVector(const std::vector<Rational<IntType, NormalizationPolicy, AnotherErrorPolicy>> &rationals) noexcept(ErrorPolicy::isNoexcept);
+
+        /************************************************************************************************************
+         ************************************************* ACCESSORS ************************************************
+         ************************************************************************************************************/
+
+        [[nodiscard]] inline std::size_t size() const noexcept { return m_numerators.size(); }
+
+        [[nodiscard]] inline bool empty() const noexcept { return m_numerators.empty(); }
+
+        inline void reserve(const std::size_t capacity) { m_numerators.reserve(capacity); }
+
+        /**
+         * @brief Resize the vector, the new elements are 0
+         */
+        inline void resize(const std::size_t size) { m_numerators.resize(size, IntType(0)); }
+
+        [[nodiscard]] inline IntType getDenominator() const noexcept { return m_denominator; }
+
+        [[nodiscard]] inline const Storage &numerators() const noexcept { return m_numerators; }
+
+        /**
+         * @brief Append a rational. The whole vector is rescaled if its denominator isn't a multiple of the rational's one.
+         * @param rational
+         */
+        template<typename NormalizationPolicy, typename AnotherErrorPolicy>
+        void push_back(const Rational<IntType, NormalizationPolicy, AnotherErrorPolicy> &rational) noexcept(ErrorPolicy::isNoexcept);
+
+        /**
+         * @brief The rational of an element (reduced)
+         * @param index
+         */
+        [[nodiscard]] inline RationalType get(const std::size_t index) const noexcept(ErrorPolicy::isNoexcept) {
+            return RationalType(m_numerators[index], m_denominator);
+        }
+
+        /**
+         * @brief Replace an element. The whole vector is rescaled if its denominator isn't a multiple of the rational's one.
+         * @param index
+         * @param rational
+         */
+        template<typename NormalizationPolicy, typename AnotherErrorPolicy>
+        void set(std::size_t index, const Rational<IntType, NormalizationPolicy, AnotherErrorPolicy> &rational) noexcept(ErrorPolicy::isNoexcept);
+
+        /************************************************************************************************************
+         ************************************************* KERNELS **************************************************
+         ************************************************************************************************************/
+
+        /**
+         * @brief result = a + b for every element. With the same denominator, it's only an addition of the numerators.
+         * Else both are rescaled to the least common multiple of the denominators.
+         * The elements which don't fit in IntType are set to 0. If the common denominator itself doesn't fit,
+         * every element is set.
+         * @param a
+         * @param b Same size as a
+         * @param result Resized to the size of a, can be a or b
+         * @return The mask of the elements which overflowed
+         */
+        static LaneMask add(const CommonDenominatorVector &a, const CommonDenominatorVector &b, CommonDenominatorVector &result);
+
+        /**
+         * @brief result = a - b for every element (see add)
+         */
+        static LaneMask subtract(const CommonDenominatorVector &a, const CommonDenominatorVector &b, CommonDenominatorVector &result);
+
+        /**
+         * @brief Divide the denominator and the numerators by their gcd, to get the smallest common denominator.
+         * Nothing is done if no operation changed the vector since the last call.
+         */
+        void simplify() noexcept;
+
+        /************************************************************************************************************
+         ************************************************ CONVERSION ************************************************
+         ************************************************************************************************************/
+
+        /**
+         * @return Every element as a reduced rational
+         */
+        [[nodiscard]] std::vector<RationalType> toRationals() const noexcept(ErrorPolicy::isNoexcept);
+
+        /**
+         * @return A RationalVector with the denominator copied in every lane (nothing is reduced)
+         */
+        [[nodiscard]] RationalVector<IntType, ErrorPolicy> toRationalVector() const;
+
+        /**
+         * @brief Convert every element into a floating point number
+         * @tparam FloatingType
+         */
+        template<typename FloatingType = double>
+        [[nodiscard]] std::vector<FloatingType> toRealNumber() const;
+
+        /************************************************************************************************************
+         ************************************************* OPERATORS ************************************************
+         ************************************************************************************************************/
+
+        // The operators raise an error with ErrorPolicy if any element overflows
+
+        inline CommonDenominatorVector operator+(const CommonDenominatorVector &anotherVector) const {
+            CommonDenominatorVector result;
+            if (add(*this, anotherVector, result).any()) ErrorPolicy::raise(ArkulibError::NumberTooLarge);
+            return result;
+        }
+
+        inline CommonDenominatorVector operator-(const CommonDenominatorVector &anotherVector) const {
+            CommonDenominatorVector result;
+            if (subtract(*this, anotherVector, result).any()) ErrorPolicy::raise(ArkulibError::NumberTooLarge);
+            return result;
+        }
+
+        inline CommonDenominatorVector &operator+=(const CommonDenominatorVector &anotherVector) { return *this = *this + anotherVector; }
+
+        inline CommonDenominatorVector &operator-=(const CommonDenominatorVector &anotherVector) { return *this = *this - anotherVector; }
+
+    private:
+        Storage m_numerators;
+        IntType m_denominator = 1;
+        bool m_isReduced = true; // The denominator is known to be the smallest
+
+        /**
+         * @brief The least common multiple of two positive integers
+         * @return True if it doesn't fit in IntType
+         */
+        static inline bool lcmOverflow(const IntType a, const IntType b, IntType &result) noexcept {
+            return Tools::multiplyOverflow(static_cast<IntType>(a / Tools::gcd(a, b)), b, result);
+        }
+
+        /**
+         * @brief out = numerators * factor, the overflowed elements get their bit set
+         */
+        static void scale(const Storage &numerators, IntType factor, Storage &out, std::uint64_t *overflow) noexcept;
+
+        /**
+         * @brief Change the denominator into a multiple of it
+         * @return False if a numerator doesn't fit anymore (the vector is then unchanged)
+         */
+        bool rescale(IntType newDenominator);
+
+        /**
+         * @brief Put a rational over the common denominator, rescaling the vector if needed
+         * @param rational
+         * @param result Its numerator over the common denominator
+         * @return False if it overflowed
+         */
+        template<typename NormalizationPolicy, typename AnotherErrorPolicy>
+        bool numeratorOf(const Rational<IntType, NormalizationPolicy, AnotherErrorPolicy> &rational, IntType &result);
+
+        template<int Sign>
+        static LaneMask addKernel(const CommonDenominatorVector &a, const CommonDenominatorVector &b, CommonDenominatorVector &result);
+    };
+
+
+
+
+    /************************************************************************************************************
+     ************************************************************************************************************/
+
+
+
+
+    /************************************************************************************************************
+     ****************************************** CONSTRUCTOR / DESTRUCTOR ****************************************
+     ************************************************************************************************************/
+
+    template<typename IntType, typename ErrorPolicy>
+    CommonDenominatorVector<IntType, ErrorPolicy>::CommonDenominatorVector(const std::size_t size, const IntType denominator) noexcept(ErrorPolicy::isNoexcept)
+            : m_numerators(size, IntType(0)), m_denominator(denominator), m_isReduced(denominator == 1) {
+        if (denominator <= 0) {
+            ErrorPolicy::raise(denominator == 0 ? ArkulibError::DivideByZero : ArkulibError::InvalidAccessArgument);
+            m_denominator = 1;
+        }
+    }
+
+    template<typename IntType, typename ErrorPolicy>
+    template<typename NormalizationPolicy, typename AnotherErrorPolicy>
+    CommonDenominatorVector<IntType, ErrorPolicy>::CommonDenominatorVector(
+            const std::vector<Rational<IntType, NormalizationPolicy, AnotherErrorPolicy>> &rationals
+    ) noexcept(ErrorPolicy::isNoexcept) {
+        // The denominators of reduced rationals: their least common multiple is the smallest common denominator
+        std::vector<RationalType> reduced;
+        if constexpr (!NormalizationPolicy::isAlwaysReduced) {
+            reduced.reserve(rationals.size());
+            for (const auto &rational: rationals) reduced.emplace_back(rational.getNumerator(), rational.getDenominator());
+        }
+        const auto denominatorOf = [&](const std::size_t index) {
+            if constexpr (NormalizationPolicy::isAlwaysReduced) return rationals[index].getDenominator();
+            else return reduced[index].getDenominator();
+        };
+        const auto numeratorOf = [&](const std::size_t index) {
+            if constexpr (NormalizationPolicy::isAlwaysReduced) return rationals[index].getNumerator();
+            else return reduced[index].getNumerator();
+        };
+
+        IntType denominator = 1;
+        for (std::size_t index = 0; index < rationals.size(); ++index) {
+            if (denominator % denominatorOf(index) != 0 && lcmOverflow(denominator, denominatorOf(index), denominator)) {
+                ErrorPolicy::raise(ArkulibError::NumberTooLarge);
+                return;
+            }
+        }
+
+        m_numerators.resize(rationals.size());
+        for (std::size_t index = 0; index < rationals.size(); ++index) {
+            if (Tools::multiplyOverflow(numeratorOf(index), static_cast<IntType>(denominator / denominatorOf(index)), m_numerators[index])) {
+                m_numerators.clear();
+                ErrorPolicy::raise(ArkulibError::NumberTooLarge);
+                return;
+            }
+        }
+        m_denominator = denominator;
+    }
+
+    /************************************************************************************************************
+     ************************************************* ACCESSORS ************************************************
+     ************************************************************************************************************/
+
+    template<typename IntType, typename ErrorPolicy>
+    template<typename NormalizationPolicy, typename AnotherErrorPolicy>
+    bool CommonDenominatorVector<IntType, ErrorPolicy>::numeratorOf(
+            const Rational<IntType, NormalizationPolicy, AnotherErrorPolicy> &rational, IntType &result
+    ) {
+        // A canonical rational is already reduced: no gcd, only a modulo when the denominators are the same
+        IntType numerator = rational.getNumerator(), denominator = rational.getDenominator();
+        if constexpr (!NormalizationPolicy::isAlwaysReduced) {
+            const RationalType reduced(numerator, denominator);
+            numerator = reduced.getNumerator();
+            denominator = reduced.getDenominator();
+        }
+
+        // A reduced denominator which doesn't divide the common one: it's replaced by their least common multiple
+        if (m_denominator % denominator != 0) {
+            IntType newDenominator{};
+            if (lcmOverflow(m_denominator, denominator, newDenominator) || !rescale(newDenominator)) return false;
+            // The multiplication below can still fail: the larger denominator would then be useless
+            m_isReduced = false;
+        }
+        return !Tools::multiplyOverflow(numerator, static_cast<IntType>(m_denominator / denominator), result);
+    }
+
+    template<typename IntType, typename ErrorPolicy>
+    template<typename NormalizationPolicy, typename AnotherErrorPolicy>
+    void CommonDenominatorVector<IntType, ErrorPolicy>::push_back(const Rational<IntType, NormalizationPolicy, AnotherErrorPolicy> &rational) noexcept(ErrorPolicy::isNoexcept) {
+        IntType numerator{};
+        if (!numeratorOf(rational, numerator)) {
+            ErrorPolicy::raise(ArkulibError::NumberTooLarge);
+            return;
+        }
+        m_numerators.push_back(numerator);
+    }
+
+    template<typename IntType, typename ErrorPolicy>
+    template<typename NormalizationPolicy, typename AnotherErrorPolicy>
+    void CommonDenominatorVector<IntType, ErrorPolicy>::set(const std::size_t index, const Rational<IntType, NormalizationPolicy, AnotherErrorPolicy> &rational) noexcept(ErrorPolicy::isNoexcept) {
+        IntType numerator{};
+        if (!numeratorOf(rational, numerator)) {
+            ErrorPolicy::raise(ArkulibError::NumberTooLarge);
+            return;
+        }
+        // The replaced element may have been the only one needing the whole denominator
+        m_numerators[index] = numerator;
+        m_isReduced = false;
+    }
+
+    /************************************************************************************************************
+     ************************************************* KERNELS **************************************************
+     ************************************************************************************************************/
+
+    template<typename IntType, typename ErrorPolicy>
+    void CommonDenominatorVector<IntType, ErrorPolicy>::scale(
+            const Storage &numerators, const IntType factor, Storage &out, std::uint64_t *overflow
+    ) noexcept {
+        out.resize(numerators.size());
+        for (std::size_t index = 0; index < numerators.size(); ++index) {
+            if (Tools::multiplyOverflow(numerators[index], factor, out[index])) Tools::Simd::setLaneBit(overflow, index);
+        }
+    }
+
+    template<typename IntType, typename ErrorPolicy>
+    bool CommonDenominatorVector<IntType, ErrorPolicy>::rescale(const IntType newDenominator) {
+        LaneMask overflow(size());
+        Storage numerators;
+        scale(m_numerators, static_cast<IntType>(newDenominator / m_denominator), numerators, overflow.words());
+        if (overflow.any()) return false;
+
+        m_numerators = std::move(numerators);
+        m_denominator = newDenominator;
+        return true;
+    }
+
+    template<typename IntType, typename ErrorPolicy>
+    template<int Sign>
+    LaneMask CommonDenominatorVector<IntType, ErrorPolicy>::addKernel(
+            const CommonDenominatorVector &a, const CommonDenominatorVector &b, CommonDenominatorVector &result
+    ) {
+        assert(a.size() == b.size() && "The vectors must have the same size");
+        const std::size_t count = a.size();
+        LaneMask overflow(count);
+
+        IntType denominator = a.m_denominator;
+        Storage scaledA, scaledB;
+        const IntType *aNumerators = a.m_numerators.data(), *bNumerators = b.m_numerators.data();
+        if (a.m_denominator != b.m_denominator) {
+            // Only the vectors whose denominator isn't the common one are rescaled (in a copy: result can alias them)
+            if (lcmOverflow(a.m_denominator, b.m_denominator, denominator)) {
+                result = CommonDenominatorVector(count);
+                for (std::size_t index = 0; index < count; ++index) overflow.set(index);
+                return overflow;
+            }
+            if (denominator != a.m_denominator) {
+                scale(a.m_numerators, static_cast<IntType>(denominator / a.m_denominator), scaledA, overflow.words());
+                aNumerators = scaledA.data();
+            }
+            if (denominator != b.m_denominator) {
+                scale(b.m_numerators, static_cast<IntType>(denominator / b.m_denominator), scaledB, overflow.words());
+                bNumerators = scaledB.data();
+            }
+        }
+
+        // The kernel reads a lane before writing it, so it can write into a or b
+        result.m_numerators.resize(count);
+        Tools::Simd::addNarrow<Sign>(aNumerators, bNumerators, result.m_numerators.data(), overflow.words(), count);
+        result.m_denominator = denominator;
+        result.m_isReduced = false;
+
+        for (std::size_t word = 0; word < (count + 63) / 64; ++word) {
+            for (std::uint64_t bits = overflow.words()[word]; bits != 0; bits &= bits - 1) {
+                result.m_numerators[word * 64 + static_cast<std::size_t>(Tools::countTrailingZeros(bits))] = 0;
+            }
+        }
+        return overflow;
+    }
+
+    template<typename IntType, typename ErrorPolicy>
+    LaneMask CommonDenominatorVector<IntType, ErrorPolicy>::add(const CommonDenominatorVector &a, const CommonDenominatorVector &b, CommonDenominatorVector &result) {
+        return addKernel<1>(a, b, result);
+    }
+
+    template<typename IntType, typename ErrorPolicy>
+    LaneMask CommonDenominatorVector<IntType, ErrorPolicy>::subtract(const CommonDenominatorVector &a, const CommonDenominatorVector &b, CommonDenominatorVector &result) {
+        return addKernel<-1>(a, b, result);
+    }
+
+    template<typename IntType, typename ErrorPolicy>
+    void CommonDenominatorVector<IntType, ErrorPolicy>::simplify() noexcept {
+        if (m_isReduced) return;
+        m_isReduced = true;
+
+        // Stops as soon as the gcd is 1: the denominator is then already the smallest
+        IntType divisor = m_denominator;
+        for (std::size_t index = 0; index < size() && divisor != 1; ++index) divisor = Tools::gcd(divisor, m_numerators[index]);
+        if (divisor == 1) return;
+
+        for (IntType &numerator: m_numerators) numerator /= divisor;
+        m_denominator /= divisor;
+    }
+
+    /************************************************************************************************************
+     ************************************************ CONVERSION ************************************************
+     ************************************************************************************************************/
+
+    template<typename IntType, typename ErrorPolicy>
+    std::vector<typename CommonDenominatorVector<IntType, ErrorPolicy>::RationalType>
+    CommonDenominatorVector<IntType, ErrorPolicy>::toRationals() const noexcept(ErrorPolicy::isNoexcept) {
+        std::vector<RationalType> rationals;
+        rationals.reserve(size());
+        for (const IntType numerator: m_numerators) rationals.emplace_back(numerator, m_denominator);
+        return rationals;
+    }
+
+    template<typename IntType, typename ErrorPolicy>
+    RationalVector<IntType, ErrorPolicy> CommonDenominatorVector<IntType, ErrorPolicy>::toRationalVector() const {
+        RationalVector<IntType, ErrorPolicy> vector(size());
+        for (std::size_t index = 0; index < size(); ++index) vector.set(index, m_numerators[index], m_denominator);
+        return vector;
+    }
+
+    template<typename IntType, typename ErrorPolicy>
+    template<typename FloatingType>
+    std::vector<FloatingType> CommonDenominatorVector<IntType, ErrorPolicy>::toRealNumber() const {
+        std::vector<FloatingType> result(size());
+        for (std::size_t index = 0; index < size(); ++index) result[index] = FloatingType(m_numerators[index]) / FloatingType(m_denominator);
+        return result;
+    }
+}
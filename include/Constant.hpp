@@ -10,9 +10,10 @@
 #pragma once
 
 namespace Arkulib::Constant {
-    const unsigned int DEFAULT_ITERATIONS_FROM_FP = 10; /*!< Default iterations used in the fromFloatingPoint recursive algorithm */
-    const double DEFAULT_THRESHOLD_FROM_FP = 0.01; /*!< Default iterations used in the fromFloatingPoint recursive algorithm */
-    const unsigned int DEFAULT_MAX_DIGITS_APPROXIMATE = 7; /*!< The max digits handled by the method toApproximation */
-    const unsigned int DEFAULT_KEPT_DIGITS_APPROXIMATE = 3; /*!< The default precision set for toApproximation. The approximation will be set for 3 digits by default. */
-    const unsigned int DEFAULT_COUT_ERATIONAL_DIGITS = 6; /*!< The default precision set for ERational std::cout */
+    constexpr unsigned int DEFAULT_ITERATIONS_FROM_FP = 10; /*!< Default iterations used in the fromFloatingPoint recursive algorithm */
+    constexpr double DEFAULT_THRESHOLD_FROM_FP = 0.01; /*!< Default iterations used in the fromFloatingPoint recursive algorithm */
+    constexpr unsigned int DEFAULT_MAX_DIGITS_APPROXIMATE = 7; /*!< The max digits handled by the method toApproximation */
+    constexpr unsigned int DEFAULT_KEPT_DIGITS_APPROXIMATE = 3; /*!< The default precision set for toApproximation. The approximation will be set for 3 digits by default. */
+    constexpr unsigned int DEFAULT_COUT_ERATIONAL_DIGITS = 6; /*!< The default precision set for ERational std::cout */
+    constexpr unsigned long long DEFAULT_SQRT_SCALE_UNBOUNDED = 1000000000000000000ULL; /*!< Denominator of the irrational square roots of the unbounded integers (BigInt): an error below 1e-18 */
 }
\ No newline at end of file
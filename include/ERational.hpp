@@ -16,8 +16,9 @@ namespace Arkulib {
     /**
      * @brief This class can be used to express big rationals
      * @tparam FloatType
+     * @tparam ErrorPolicy Policies::Throw, Policies::StatusFlag or Policies::AssertOnly
      */
-    template<typename FloatType = double>
+    template<typename FloatType = double, typename ErrorPolicy = Policies::DefaultErrorPolicy>
     class ERational {
 
     public:
@@ -47,7 +48,8 @@ namespace Arkulib {
         );
 
         /**
-        * @brief Create an experimental rational from a floating number
+        * @brief Create an experimental rational from a floating number. The number is split exactly into
+        * mantissa / 2^-exponent (Tools::decomposeFloatingPoint), so the tiny and huge values are kept.
         * @tparam FloatingType
         * @param nonRational
         */
@@ -59,16 +61,19 @@ namespace Arkulib {
          * @tparam IntType
          * @param reference
          */
-        inline constexpr ERational(const ERational<FloatType> &reference) = default;
+        inline constexpr ERational(const ERational<FloatType, ErrorPolicy> &reference) = default;
 
         /**
          * @brief Copy constructor from a Rational
+         * @tparam IntType
+         * @tparam NormalizationPolicy
+         * @tparam AnotherErrorPolicy
          * @param reference
          */
-        template<typename IntType>
-        inline constexpr explicit ERational(const Rational<IntType> &reference) {
-            *this = ERational<FloatType>(reference.getNumerator(), reference.getDenominator());
-        };
+        template<typename IntType, typename NormalizationPolicy, typename AnotherErrorPolicy>
+        inline constexpr explicit ERational(const Rational<IntType, NormalizationPolicy, AnotherErrorPolicy> &reference) {
+            *this = ERational<FloatType, ErrorPolicy>(reference.getNumerator(), reference.getDenominator());
+        }
 
         /**
          * @brief Explicit constructor
@@ -132,7 +137,7 @@ namespace Arkulib {
          * @param anotherERational
          * @return The sum in ERational
          */
-        constexpr ERational<FloatType> operator+(const ERational<FloatType> &anotherERational) const;
+        constexpr ERational<FloatType, ErrorPolicy> operator+(const ERational<FloatType, ErrorPolicy> &anotherERational) const;
 
         /************************************************************************************************************
          *********************************************** OPERATOR - *************************************************
@@ -143,7 +148,7 @@ namespace Arkulib {
          * @param anotherERational
          * @return The result in ERational
          */
-        constexpr ERational<FloatType> operator-(const ERational<FloatType> &anotherERational) const;
+        constexpr ERational<FloatType, ErrorPolicy> operator-(const ERational<FloatType, ErrorPolicy> &anotherERational) const;
 
         /************************************************************************************************************
          *********************************************** OPERATOR * *************************************************
@@ -154,7 +159,7 @@ namespace Arkulib {
          * @param anotherERational
          * @return The multiplication in ERational
          */
-        constexpr ERational<FloatType> operator*(const ERational<FloatType> &anotherERational) const;
+        constexpr ERational<FloatType, ErrorPolicy> operator*(const ERational<FloatType, ErrorPolicy> &anotherERational) const;
 
         /************************************************************************************************************
          *********************************************** OPERATOR / *************************************************
@@ -165,7 +170,7 @@ namespace Arkulib {
          * @param anotherERational
          * @return The result in ERational
          */
-        constexpr ERational<FloatType> operator/(const ERational<FloatType> &anotherERational) const;
+        constexpr ERational<FloatType, ErrorPolicy> operator/(const ERational<FloatType, ErrorPolicy> &anotherERational) const;
 
         /************************************************************************************************************
          *********************************************** OPERATOR == ************************************************
@@ -176,7 +181,7 @@ namespace Arkulib {
            * @param anotherERational
            * @return True if the first erational is equal to the second
            */
-        constexpr inline bool operator==(const ERational<FloatType> &anotherERational) const;
+        constexpr inline bool operator==(const ERational<FloatType, ErrorPolicy> &anotherERational) const;
 
         /************************************************************************************************************
          ********************************************** OPERATOR != *************************************************
@@ -187,7 +192,7 @@ namespace Arkulib {
          * @param anotherERational
          * @return True if the first erational is different to the second
          */
-        constexpr inline bool operator!=(const ERational<FloatType> &anotherERational) const;
+        constexpr inline bool operator!=(const ERational<FloatType, ErrorPolicy> &anotherERational) const;
 
         /************************************************************************************************************
          ************************************************* STATUS ***************************************************
@@ -219,8 +224,8 @@ namespace Arkulib {
          * @brief Apply absolute value on the ERational
          * @return The ERational in absolute value
          */
-        [[maybe_unused]] [[nodiscard]] constexpr inline ERational<FloatType> abs() const {
-            return ERational<FloatType>(
+        [[maybe_unused]] [[nodiscard]] constexpr inline ERational<FloatType, ErrorPolicy> abs() const {
+            return ERational<FloatType, ErrorPolicy>(
                     std::abs(getNumMultiplier()), getNumExponent(),
                     std::abs(getDenMultiplier()), getDenExponent()
             );
@@ -230,14 +235,14 @@ namespace Arkulib {
          * @brief Get the inverse of an ERational
          * @return The inversed ERational
          */
-        [[maybe_unused]] [[nodiscard]] constexpr inline ERational<FloatType> inverse() const {
-            return ERational<FloatType>(getDenMultiplier(), getDenExponent(), getNumMultiplier(), getNumExponent());
+        [[maybe_unused]] [[nodiscard]] constexpr inline ERational<FloatType, ErrorPolicy> inverse() const {
+            return ERational<FloatType, ErrorPolicy>(getDenMultiplier(), getDenExponent(), getNumMultiplier(), getNumExponent());
         }
 
         /**
          * @brief Simplify the Rational with GCD
          */
-        [[maybe_unused]] constexpr ERational<FloatType> simplify() noexcept;
+        [[maybe_unused]] constexpr ERational<FloatType, ErrorPolicy> simplify() noexcept;
 
         /************************************************************************************************************
          *********************************************** CONVERSION *************************************************
@@ -286,17 +291,24 @@ namespace Arkulib {
         template<typename IntType = int>
         static constexpr std::pair<FloatType, short int> transformOperandToPair(IntType operand);
 
+        /**
+         * @brief Transform 2^exponent into a pair
+         * @param exponent
+         * @return
+         */
+        static std::pair<FloatType, short int> powerOfTwoToPair(unsigned int exponent);
+
         /**
          * @brief Verify if the denominator is null or negative
          * @param checkIfDenominatorIsNull
          */
-        constexpr void verifyDenominator(bool checkIfDenominatorIsNull = true);
+        constexpr void verifyDenominator(bool checkIfDenominatorIsNull = true) noexcept(ErrorPolicy::isNoexcept);
 
         /**
-         * @brief Verify if the template is correct. Throw an exception if the template is an integral
+         * @brief Verify if the template is correct. Report an error through the ErrorPolicy if the template is an integral
          */
-        constexpr inline void verifyTemplateType() const {
-            if (std::is_integral<FloatType>()) throw Exceptions::IntTypeGivenException();
+        constexpr inline void verifyTemplateType() const noexcept(ErrorPolicy::isNoexcept) {
+            if constexpr (std::is_integral_v<FloatType>) ErrorPolicy::raise(ArkulibError::IntTypeGiven);
         };
 
         /**
@@ -305,8 +317,8 @@ namespace Arkulib {
          * @param secondERational
          */
         constexpr void setAtSameNumeratorExponent(
-            ERational<FloatType> &firstERational,
-            ERational<FloatType> &secondERational
+            ERational<FloatType, ErrorPolicy> &firstERational,
+            ERational<FloatType, ErrorPolicy> &secondERational
         ) const;
 
         /**
@@ -315,8 +327,8 @@ namespace Arkulib {
          * @param secondERational
          */
         constexpr void setAtSameDenominator(
-            ERational <FloatType> &firstERational,
-            ERational <FloatType> &secondERational
+            ERational<FloatType, ErrorPolicy> &firstERational,
+            ERational<FloatType, ErrorPolicy> &secondERational
         ) const;
 
         /************************************************************************************************************
@@ -342,15 +354,15 @@ namespace Arkulib {
      ********************************************* CONSTRUCTOR DEF **********************************************
      ************************************************************************************************************/
 
-    template<typename FloatType>
-    constexpr ERational<FloatType>::ERational() : m_numerator(0., 0), m_denominator(1., 0) {
+    template<typename FloatType, typename ErrorPolicy>
+    constexpr ERational<FloatType, ErrorPolicy>::ERational() : m_numerator(0., 0), m_denominator(1., 0) {
         verifyTemplateType();
     }
 
 
-    template<typename FloatType>
+    template<typename FloatType, typename ErrorPolicy>
     template<typename IntType>
-    constexpr ERational<FloatType>::ERational(
+    constexpr ERational<FloatType, ErrorPolicy>::ERational(
             const IntType numerator,
             const IntType denominator,
             const bool willBeReduce,
@@ -362,7 +374,7 @@ namespace Arkulib {
         verifyDenominator(willDenominatorBeVerified);
 
         if (willBeReduce) {
-            const int gcd = std::gcd(numerator, denominator);
+            const IntType gcd = Tools::gcd(numerator, denominator);
             assert(gcd != 0 && "GCD shouldn't be equal to 0");
 
             transformToExperimental(numerator / gcd, denominator / gcd);
@@ -370,19 +382,45 @@ namespace Arkulib {
         }
     }
 
-    template<typename FloatType>
+    template<typename FloatType, typename ErrorPolicy>
     template<typename AnotherFloatType>
-    constexpr ERational<FloatType>::ERational(const AnotherFloatType &nonRational) {
+    constexpr ERational<FloatType, ErrorPolicy>::ERational(const AnotherFloatType &nonRational) {
         verifyTemplateType();
 
-        Rational<long long int> tmpRational = Rational<long long int>::fromFloatingPoint(nonRational);
-        *this = ERational{tmpRational};
+        if constexpr (std::is_integral_v<AnotherFloatType>) {
+            *this = ERational<FloatType, ErrorPolicy>(nonRational, AnotherFloatType(1));
+        }
+
+        else {
+            const Tools::DyadicDecomposition dyadic = Tools::decomposeFloatingPoint(nonRational);
+            if (!dyadic.isFinite) {
+                ErrorPolicy::raise(ArkulibError::NumberTooLarge);
+                *this = ERational<FloatType, ErrorPolicy>();
+                return;
+            }
+            if (dyadic.mantissa == 0) {
+                *this = ERational<FloatType, ErrorPolicy>();
+                return;
+            }
+
+            std::pair<FloatType, short int> mantissa = transformOperandToPair(dyadic.mantissa);
+            if (dyadic.isNegative) mantissa.first = -mantissa.first;
+            const std::pair<FloatType, short int> power = powerOfTwoToPair(dyadic.exponent < 0 ? -dyadic.exponent : dyadic.exponent);
+
+            if (dyadic.exponent < 0) {
+                m_numerator = mantissa;
+                m_denominator = power;
+            } else {
+                m_numerator = std::make_pair(mantissa.first * power.first, static_cast<short int>(mantissa.second + power.second));
+                m_denominator = std::make_pair(FloatType(1), static_cast<short int>(0));
+            }
+        }
     }
 
 
 
-    template<typename FloatType>
-    constexpr ERational<FloatType>::ERational(
+    template<typename FloatType, typename ErrorPolicy>
+    constexpr ERational<FloatType, ErrorPolicy>::ERational(
             const FloatType numMultiplier,
             const short int numExponent,
             const FloatType denMultiplier,
@@ -393,8 +431,8 @@ namespace Arkulib {
     }
 
 
-    template<typename FloatType>
-    constexpr ERational<FloatType>::ERational(
+    template<typename FloatType, typename ErrorPolicy>
+    constexpr ERational<FloatType, ErrorPolicy>::ERational(
             std::pair<FloatType, short int> numerator,
             std::pair<FloatType, short int> denominator
     ) {
@@ -406,15 +444,15 @@ namespace Arkulib {
      ********************************************* OPERATOR + DEF ***********************************************
      ************************************************************************************************************/
 
-    template<typename FloatType>
-    constexpr ERational<FloatType> ERational<FloatType>::operator+(const ERational<FloatType> &anotherERational) const {
+    template<typename FloatType, typename ErrorPolicy>
+    constexpr ERational<FloatType, ErrorPolicy> ERational<FloatType, ErrorPolicy>::operator+(const ERational<FloatType, ErrorPolicy> &anotherERational) const {
         // We create new Rational with the same denominator (we multiply them by denominator / denominator)
-        ERational<FloatType> firstERational = *this;
-        ERational<FloatType> secondERational = anotherERational;
+        ERational<FloatType, ErrorPolicy> firstERational = *this;
+        ERational<FloatType, ErrorPolicy> secondERational = anotherERational;
         setAtSameDenominator(firstERational, secondERational);
         setAtSameNumeratorExponent(firstERational, secondERational);
 
-        return ERational<FloatType>(
+        return ERational<FloatType, ErrorPolicy>(
                 std::make_pair(
                         firstERational.getNumMultiplier() + secondERational.getNumMultiplier(),
                         firstERational.getNumExponent()
@@ -427,15 +465,15 @@ namespace Arkulib {
  ********************************************* OPERATOR - DEF ***********************************************
  ************************************************************************************************************/
 
-    template<typename FloatType>
-    constexpr ERational<FloatType> ERational<FloatType>::operator-(const ERational<FloatType> &anotherERational) const {
+    template<typename FloatType, typename ErrorPolicy>
+    constexpr ERational<FloatType, ErrorPolicy> ERational<FloatType, ErrorPolicy>::operator-(const ERational<FloatType, ErrorPolicy> &anotherERational) const {
         // We create new Rational with the same denominator (we multiply them by denominator / denominator)
-        ERational<FloatType> firstERational = *this;
-        ERational<FloatType> secondERational = anotherERational;
+        ERational<FloatType, ErrorPolicy> firstERational = *this;
+        ERational<FloatType, ErrorPolicy> secondERational = anotherERational;
         setAtSameDenominator(firstERational, secondERational);
         setAtSameNumeratorExponent(firstERational, secondERational);
 
-        return ERational<FloatType>(
+        return ERational<FloatType, ErrorPolicy>(
                 std::make_pair(
                         firstERational.getNumMultiplier() - secondERational.getNumMultiplier(),
                         firstERational.getNumExponent()
@@ -448,9 +486,9 @@ namespace Arkulib {
      ********************************************* OPERATOR * DEF ***********************************************
      ************************************************************************************************************/
 
-    template<typename FloatType>
-    constexpr ERational<FloatType> ERational<FloatType>::operator*(const ERational<FloatType> &anotherERational) const {
-        return ERational<FloatType>(
+    template<typename FloatType, typename ErrorPolicy>
+    constexpr ERational<FloatType, ErrorPolicy> ERational<FloatType, ErrorPolicy>::operator*(const ERational<FloatType, ErrorPolicy> &anotherERational) const {
+        return ERational<FloatType, ErrorPolicy>(
                 getNumMultiplier() * anotherERational.getNumMultiplier(),
                 getNumExponent() + anotherERational.getNumExponent(),
                 getDenMultiplier() * anotherERational.getDenMultiplier(),
@@ -462,9 +500,9 @@ namespace Arkulib {
      ********************************************* OPERATOR / DEF ***********************************************
      ************************************************************************************************************/
 
-    template<typename FloatType>
-    constexpr ERational<FloatType> ERational<FloatType>::operator/(const ERational<FloatType> &anotherERational) const {
-        return ERational<FloatType>(
+    template<typename FloatType, typename ErrorPolicy>
+    constexpr ERational<FloatType, ErrorPolicy> ERational<FloatType, ErrorPolicy>::operator/(const ERational<FloatType, ErrorPolicy> &anotherERational) const {
+        return ERational<FloatType, ErrorPolicy>(
                 getNumMultiplier() * anotherERational.getDenMultiplier(),
                 getNumExponent() + anotherERational.getDenExponent(),
                 getDenMultiplier() * anotherERational.getNumMultiplier(),
@@ -476,10 +514,10 @@ namespace Arkulib {
      ********************************************* OPERATOR == DEF **********************************************
      ************************************************************************************************************/
 
-    template<typename FloatType>
-    constexpr bool ERational<FloatType>::operator==(const ERational<FloatType> &anotherERational) const {
-        ERational<FloatType> leftRational = this->simplify();
-        ERational<FloatType> rightRational = anotherERational->simplify();
+    template<typename FloatType, typename ErrorPolicy>
+    constexpr bool ERational<FloatType, ErrorPolicy>::operator==(const ERational<FloatType, ErrorPolicy> &anotherERational) const {
+        ERational<FloatType, ErrorPolicy> leftRational = this->simplify();
+        ERational<FloatType, ErrorPolicy> rightRational = anotherERational->simplify();
 
         if (leftRational.getNumExponent() != rightRational.getNumExponent()
             || leftRational.getDenExponent() != rightRational.getDenExponent()
@@ -494,8 +532,8 @@ namespace Arkulib {
      ********************************************* OPERATOR != DEF **********************************************
      ************************************************************************************************************/
 
-    template<typename FloatType>
-    constexpr bool ERational<FloatType>::operator!=(const ERational<FloatType> &anotherERational) const {
+    template<typename FloatType, typename ErrorPolicy>
+    constexpr bool ERational<FloatType, ErrorPolicy>::operator!=(const ERational<FloatType, ErrorPolicy> &anotherERational) const {
         return (*this == anotherERational) == false;
     }
 
@@ -503,8 +541,8 @@ namespace Arkulib {
      ************************************************ MATHS DEF *************************************************
      ************************************************************************************************************/
 
-    template<typename FloatType>
-    constexpr ERational<FloatType> ERational<FloatType>::simplify() noexcept {
+    template<typename FloatType, typename ErrorPolicy>
+    constexpr ERational<FloatType, ErrorPolicy> ERational<FloatType, ErrorPolicy>::simplify() noexcept {
         const int exponentDifference = std::abs(getNumExponent() - getDenExponent());
 
         if (exponentDifference == 0 && getNumExponent() != 0) {
@@ -525,16 +563,16 @@ namespace Arkulib {
      ************************************************ METHODS DEF ***********************************************
      ************************************************************************************************************/
 
-    template<typename FloatType>
+    template<typename FloatType, typename ErrorPolicy>
     template<typename IntType>
-    constexpr void ERational<FloatType>::transformToExperimental(const IntType numerator, const IntType denominator) {
+    constexpr void ERational<FloatType, ErrorPolicy>::transformToExperimental(const IntType numerator, const IntType denominator) {
         setNumerator(transformOperandToPair(numerator));
         setDenominator(transformOperandToPair(denominator));
     }
 
-    template<typename FloatType>
+    template<typename FloatType, typename ErrorPolicy>
     template<typename IntType>
-    constexpr std::pair<FloatType, short> ERational<FloatType>::transformOperandToPair(IntType operand) {
+    constexpr std::pair<FloatType, short> ERational<FloatType, ErrorPolicy>::transformOperandToPair(IntType operand) {
         const int operandLength = Tools::getNumberLength(operand);
         return std::make_pair(
                 operand * std::pow(10, -operandLength),
@@ -542,10 +580,27 @@ namespace Arkulib {
         );
     }
 
-    template<typename FloatType>
-    constexpr void ERational<FloatType>::verifyDenominator(bool checkIfDenominatorIsNull) {
-        if (getDenMultiplier() == 0. && checkIfDenominatorIsNull)
-            throw Exceptions::DivideByZeroException();
+    template<typename FloatType, typename ErrorPolicy>
+    std::pair<FloatType, short> ERational<FloatType, ErrorPolicy>::powerOfTwoToPair(const unsigned int exponent) {
+        if (exponent < static_cast<unsigned int>(std::numeric_limits<FloatType>::max_exponent)) {
+            return transformOperandToPair(std::ldexp(FloatType(1), static_cast<int>(exponent)));
+        }
+
+        // 2^exponent isn't finite in FloatType: 2^exponent = 10^(exponent * log10(2))
+        const FloatType decimalLog = static_cast<FloatType>(exponent) * std::log10(FloatType(2));
+        const FloatType decimalExponent = std::floor(decimalLog);
+        return std::make_pair(std::pow(FloatType(10), decimalLog - decimalExponent), static_cast<short int>(decimalExponent));
+    }
+
+    template<typename FloatType, typename ErrorPolicy>
+    constexpr void ERational<FloatType, ErrorPolicy>::verifyDenominator(bool checkIfDenominatorIsNull) noexcept(ErrorPolicy::isNoexcept) {
+        if (getDenMultiplier() == 0. && checkIfDenominatorIsNull) {
+            // The experimental rational becomes 0 / 1 when the ErrorPolicy doesn't throw
+            ErrorPolicy::raise(ArkulibError::DivideByZero);
+            m_numerator = std::make_pair(0., 0);
+            m_denominator = std::make_pair(1., 0);
+            return;
+        }
 
         if (getDenMultiplier() < 0.) {
             setNumMultiplier(-getNumMultiplier());
@@ -553,10 +608,10 @@ namespace Arkulib {
         }
     }
 
-    template<typename FloatType>
-    constexpr void ERational<FloatType>::setAtSameNumeratorExponent(
-            ERational<FloatType> &firstERational,
-            ERational<FloatType> &secondERational
+    template<typename FloatType, typename ErrorPolicy>
+    constexpr void ERational<FloatType, ErrorPolicy>::setAtSameNumeratorExponent(
+            ERational<FloatType, ErrorPolicy> &firstERational,
+            ERational<FloatType, ErrorPolicy> &secondERational
     ) const {
         const int exponentDifference = firstERational.getNumExponent() - secondERational.getNumExponent();
         secondERational.setNumMultiplier(secondERational.getNumMultiplier() / std::pow(10, exponentDifference));
@@ -566,10 +621,10 @@ namespace Arkulib {
                "The two numerator exponents should be equal");
     }
 
-    template<typename FloatType>
-    constexpr void ERational<FloatType>::setAtSameDenominator(
-            ERational <FloatType> &firstERational,
-            ERational <FloatType> &secondERational
+    template<typename FloatType, typename ErrorPolicy>
+    constexpr void ERational<FloatType, ErrorPolicy>::setAtSameDenominator(
+            ERational<FloatType, ErrorPolicy> &firstERational,
+            ERational<FloatType, ErrorPolicy> &secondERational
     ) const {
         firstERational= firstERational * ERational(secondERational.getDenominator(), secondERational.getDenominator());
         secondERational= secondERational * ERational(this->getDenominator(), this->getDenominator());
@@ -584,12 +639,13 @@ namespace Arkulib {
     /**
      * @brief << operator override to allow std::cout
      * @tparam FloatType
+     * @tparam ErrorPolicy
      * @param stream
      * @param rational
      * @return The stream with the rational to string.
      */
-    template<typename FloatType>
-    std::ostream &operator<<(std::ostream &stream, const ERational<FloatType> &rational) {
+    template<typename FloatType, typename ErrorPolicy>
+    std::ostream &operator<<(std::ostream &stream, const ERational<FloatType, ErrorPolicy> &rational) {
         return stream << rational.toString();
     }
 
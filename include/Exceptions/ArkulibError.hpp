@@ -0,0 +1,44 @@
+/**
+ * @file      ArkulibError.hpp
+ * @author    Elise MASSA
+ * @author    Mattéo LECLERCQ
+ * @date      2022
+ * @brief     Error codes reported by the error policies (one per exception)
+ * @copyright WTFPL
+ */
+
+#pragma once
+
+namespace Arkulib {
+    /**
+     * @brief Every error the library can report. Policies::Throw maps each of them to its exception.
+     */
+    enum class ArkulibError {
+        None,
+        DivideByZero,
+        NegativeSqrt,
+        InvalidAccessArgument,
+        FloatTypeGiven,
+        IntTypeGiven,
+        NumberTooLarge,
+        DigitsTooLarge
+    };
+
+    /**
+     * @param error
+     * @return The message of the exception matching the error
+     */
+    constexpr inline const char *toMessage(const ArkulibError error) noexcept {
+        switch (error) {
+            case ArkulibError::None: return "No error.";
+            case ArkulibError::DivideByZero: return "Denominator must not be null";
+            case ArkulibError::NegativeSqrt: return "The rational must not be negative when calling sqrt().";
+            case ArkulibError::InvalidAccessArgument: return "The parameter must be 0 (numerator) or 1 (denominator).";
+            case ArkulibError::FloatTypeGiven: return "The type given to a rational must not be a floating point.";
+            case ArkulibError::IntTypeGiven: return "The type given to a erational multiplier must not be a floating point.";
+            case ArkulibError::NumberTooLarge: return "The given integer type doesn't have the capacity to store the rational.";
+            case ArkulibError::DigitsTooLarge: return "The given precision seems to large to be wanted. You should reduce it.";
+        }
+        return "Unknown error.";
+    }
+}
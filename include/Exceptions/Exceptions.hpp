@@ -14,4 +14,5 @@
 #include "FloatTypeGivenException.hpp"
 #include "IntTypeGivenException.hpp"
 #include "NumberTooLargeException.hpp"
-#include "DigitsTooLargeException.hpp"
\ No newline at end of file
+#include "DigitsTooLargeException.hpp"
+#include "ArkulibError.hpp"
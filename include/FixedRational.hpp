@@ -0,0 +1,235 @@
+/**
+ * @file      FixedRational.hpp
+ * @author    Elise MASSA
+ * @author    Mattéo LECLERCQ
+ * @date      2022
+ * @brief     Rationals with a denominator fixed at compile time (ticks, cents, 1/48000 s audio frames): only the
+ *            numerator is stored and no operation needs a gcd
+ * @copyright WTFPL
+ */
+
+#pragma once
+
+#include <iostream>
+#include <limits>
+#include <type_traits>
+
+#include "Rational.hpp"
+
+namespace Arkulib {
+    /**
+     * @brief numerator / Den, where Den is a template constant. The additions and the subtractions are one integer
+     * operation, the products and the quotients are computed in the wider integer type then divided by a constant
+     * (rounded to the nearest, ties away from zero).
+     * @tparam IntType A builtin integer type with a wider type (int, long long, ...)
+     * @tparam Den The denominator, positive
+     * @tparam ErrorPolicy Policies::Throw, Policies::StatusFlag, Policies::AssertOnly or Policies::Approximate
+     * (which saturates the results that overflow)
+     */
+    template<typename IntType, IntType Den, typename ErrorPolicy = Policies::DefaultErrorPolicy>
+    class FixedRational {
+        static_assert(Tools::isBuiltinInteger<IntType>, "The type given to a fixed rational must be a builtin integer.");
+        static_assert(Tools::WiderInteger<IntType>::isWider, "The products of a fixed rational need a wider integer type.");
+        static_assert(Den > 0, "The denominator of a fixed rational must be positive.");
+
+        using WideType = Tools::WiderIntegerType<IntType>;
+
+    public:
+
+        /************************************************************************************************************
+         ****************************************** CONSTRUCTOR / DESTRUCTOR ****************************************
+         ************************************************************************************************************/
+
+        /**
+         * @brief Instantiate zero
+         */
+        inline constexpr FixedRational() noexcept = default;
+
+        /**
+         * @brief Create a fixed rational from an integer (integer * Den / Den)
+         * @param integer
+         */
+        constexpr explicit FixedRational(IntType integer) noexcept(ErrorPolicy::isNoexcept)
+                : m_numerator(fromWide(WideType(integer) * Den).m_numerator) {}
+
+        /**
+         * @brief Create a fixed rational from a rational, rounded to the nearest multiple of 1 / Den
+         * @param rational
+         */
+        template<typename NormalizationPolicy, typename AnotherErrorPolicy>
+        constexpr explicit FixedRational(const Rational<IntType, NormalizationPolicy, AnotherErrorPolicy> &rational) noexcept(ErrorPolicy::isNoexcept)
+                : m_numerator(fromWide(divideRounded(WideType(rational.getNumerator()) * Den, WideType(rational.getDenominator()))).m_numerator) {}
+
+        /**
+         * @brief Create a fixed rational from its numerator, without any conversion
+         * @param numerator
+         * @return numerator / Den
+         */
+        [[nodiscard]] static inline constexpr FixedRational fromNumerator(const IntType numerator) noexcept {
+            FixedRational result;
+            result.m_numerator = numerator;
+            return result;
+        }
+
+        /************************************************************************************************************
+         ************************************************ GETTERS ***************************************************
+         ************************************************************************************************************/
+
+        [[nodiscard]] constexpr inline IntType getNumerator() const noexcept { return m_numerator; }
+
+        [[nodiscard]] static constexpr inline IntType getDenominator() noexcept { return Den; }
+
+        [[nodiscard]] constexpr inline bool isZero() const noexcept { return m_numerator == 0; }
+
+        /************************************************************************************************************
+         *********************************************** CONVERSION *************************************************
+         ************************************************************************************************************/
+
+        /**
+         * @brief The rational equal to this fixed rational (reduced by its own policy)
+         * @tparam RationalType
+         */
+        template<typename RationalType = Rational<IntType>>
+        [[nodiscard]] constexpr inline RationalType toRational() const {
+            return RationalType(m_numerator, Den);
+        }
+
+        template<typename NormalizationPolicy, typename AnotherErrorPolicy>
+        constexpr inline explicit operator Rational<IntType, NormalizationPolicy, AnotherErrorPolicy>() const {
+            return toRational<Rational<IntType, NormalizationPolicy, AnotherErrorPolicy>>();
+        }
+
+        template<typename FloatingType = double>
+        [[nodiscard]] constexpr inline FloatingType toRealNumber() const noexcept {
+            return static_cast<FloatingType>(m_numerator) / static_cast<FloatingType>(Den);
+        }
+
+        /**
+         * @return The integer part (truncated toward zero)
+         */
+        [[nodiscard]] constexpr inline IntType toInteger() const noexcept { return m_numerator / Den; }
+
+        /************************************************************************************************************
+         ************************************************ OPERATORS *************************************************
+         ************************************************************************************************************/
+
+        constexpr FixedRational operator+(const FixedRational &other) const noexcept(ErrorPolicy::isNoexcept) {
+            IntType numerator{};
+            if (Tools::addOverflow(m_numerator, other.m_numerator, numerator)) {
+                return fromWide(WideType(m_numerator) + other.m_numerator);
+            }
+            return fromNumerator(numerator);
+        }
+
+        constexpr FixedRational operator-(const FixedRational &other) const noexcept(ErrorPolicy::isNoexcept) {
+            IntType numerator{};
+            if (Tools::subtractOverflow(m_numerator, other.m_numerator, numerator)) {
+                return fromWide(WideType(m_numerator) - other.m_numerator);
+            }
+            return fromNumerator(numerator);
+        }
+
+        constexpr FixedRational operator*(const FixedRational &other) const noexcept(ErrorPolicy::isNoexcept) {
+            return fromWide(divideRounded(WideType(m_numerator) * other.m_numerator, WideType(Den)));
+        }
+
+        constexpr FixedRational operator/(const FixedRational &other) const noexcept(ErrorPolicy::isNoexcept) {
+            if (other.isZero()) return raiseError(ArkulibError::DivideByZero);
+            return fromWide(divideRounded(WideType(m_numerator) * Den, WideType(other.m_numerator)));
+        }
+
+        constexpr FixedRational operator*(const IntType integer) const noexcept(ErrorPolicy::isNoexcept) {
+            IntType numerator{};
+            if (Tools::multiplyOverflow(m_numerator, integer, numerator)) {
+                return fromWide(WideType(m_numerator) * integer);
+            }
+            return fromNumerator(numerator);
+        }
+
+        constexpr FixedRational operator/(const IntType integer) const noexcept(ErrorPolicy::isNoexcept) {
+            if (integer == 0) return raiseError(ArkulibError::DivideByZero);
+            return fromWide(divideRounded(WideType(m_numerator), WideType(integer)));
+        }
+
+        constexpr inline friend FixedRational operator*(const IntType integer, const FixedRational &fixed) noexcept(ErrorPolicy::isNoexcept) {
+            return fixed * integer;
+        }
+
+        constexpr inline FixedRational operator-() const noexcept(ErrorPolicy::isNoexcept) {
+            return FixedRational() - *this;
+        }
+
+        constexpr inline FixedRational &operator+=(const FixedRational &other) noexcept(ErrorPolicy::isNoexcept) { return *this = *this + other; }
+
+        constexpr inline FixedRational &operator-=(const FixedRational &other) noexcept(ErrorPolicy::isNoexcept) { return *this = *this - other; }
+
+        constexpr inline FixedRational &operator*=(const FixedRational &other) noexcept(ErrorPolicy::isNoexcept) { return *this = *this * other; }
+
+        constexpr inline FixedRational &operator/=(const FixedRational &other) noexcept(ErrorPolicy::isNoexcept) { return *this = *this / other; }
+
+        constexpr inline FixedRational &operator*=(const IntType integer) noexcept(ErrorPolicy::isNoexcept) { return *this = *this * integer; }
+
+        constexpr inline FixedRational &operator/=(const IntType integer) noexcept(ErrorPolicy::isNoexcept) { return *this = *this / integer; }
+
+        /************************************************************************************************************
+         *********************************************** COMPARISON *************************************************
+         ************************************************************************************************************/
+
+        constexpr inline friend bool operator==(const FixedRational &a, const FixedRational &b) noexcept { return a.m_numerator == b.m_numerator; }
+
+        constexpr inline friend bool operator!=(const FixedRational &a, const FixedRational &b) noexcept { return a.m_numerator != b.m_numerator; }
+
+        constexpr inline friend bool operator<(const FixedRational &a, const FixedRational &b) noexcept { return a.m_numerator < b.m_numerator; }
+
+        constexpr inline friend bool operator<=(const FixedRational &a, const FixedRational &b) noexcept { return a.m_numerator <= b.m_numerator; }
+
+        constexpr inline friend bool operator>(const FixedRational &a, const FixedRational &b) noexcept { return a.m_numerator > b.m_numerator; }
+
+        constexpr inline friend bool operator>=(const FixedRational &a, const FixedRational &b) noexcept { return a.m_numerator >= b.m_numerator; }
+
+    private:
+        IntType m_numerator{}; /*!< The value is m_numerator / Den */
+
+        /**
+         * @brief dividend / divisor rounded to the nearest integer, ties away from zero (the divisor can be negative)
+         */
+        static constexpr inline WideType divideRounded(const WideType dividend, const WideType divisor) noexcept {
+            const WideType quotient = dividend / divisor, remainder = dividend % divisor;
+            const WideType twiceRemainder = remainder < 0 ? -2 * remainder : 2 * remainder;
+            if (twiceRemainder < (divisor < 0 ? -divisor : divisor)) return quotient;
+            return (dividend < 0) != (divisor < 0) ? quotient - 1 : quotient + 1;
+        }
+
+        /**
+         * @brief The fixed rational of a wide numerator: NumberTooLarge if it doesn't fit in IntType, or the
+         * saturated value with the Approximate policy
+         */
+        static constexpr FixedRational fromWide(const WideType numerator) noexcept(ErrorPolicy::isNoexcept) {
+            if (Tools::fitsIn<IntType>(numerator)) return fromNumerator(static_cast<IntType>(numerator));
+
+            if constexpr (Policies::isApproximating<ErrorPolicy>) {
+                const IntType saturated = numerator < 0 ? std::numeric_limits<IntType>::min() : std::numeric_limits<IntType>::max();
+                ErrorPolicy::recordApproximation(static_cast<double>(numerator - saturated) / static_cast<double>(Den) * (numerator < 0 ? -1. : 1.));
+                return fromNumerator(saturated);
+            }
+            return raiseError(ArkulibError::NumberTooLarge);
+        }
+
+        /**
+         * @brief Report the error through the ErrorPolicy
+         * @return Zero, when the ErrorPolicy doesn't throw
+         */
+        static constexpr inline FixedRational raiseError(const ArkulibError error) noexcept(ErrorPolicy::isNoexcept) {
+            ErrorPolicy::raise(error);
+            return FixedRational();
+        }
+    };
+
+    /**
+     * @brief << operator override to allow std::cout, the value is printed as the reduced rational
+     */
+    template<typename IntType, IntType Den, typename ErrorPolicy>
+    std::ostream &operator<<(std::ostream &stream, const FixedRational<IntType, Den, ErrorPolicy> &fixed) {
+        return stream << fixed.toRational().toString();
+    }
+}
@@ -0,0 +1,373 @@
+/**
+ * @file      HybridRational.hpp
+ * @author    Elise MASSA
+ * @author    Mattéo LECLERCQ
+ * @date      2022
+ * @brief     Rational stored inline on 64-bit integers, promoted to Rational<BigInt> when an operation overflows
+ *            and demoted back as soon as the reduced result fits again
+ * @copyright WTFPL
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <string>
+
+#include "BigInt.hpp"
+#include "Rational.hpp"
+
+namespace Arkulib {
+    /**
+     * @brief Exact rational with the speed of the 64-bit integers in the common case. The value lives inline as two
+     * int64 (always reduced, positive denominator). When an operation overflows, the result is computed again with
+     * BigInt and kept on the heap. Every result is reduced, so it's demoted back inline when it fits in 64 bits.
+     * @tparam ErrorPolicy Policies::Throw, Policies::StatusFlag or Policies::AssertOnly (only division by 0 can fail)
+     */
+    template<typename ErrorPolicy = Policies::DefaultErrorPolicy>
+    class HybridRational {
+
+    public:
+        using SmallType = std::int64_t;
+        using BigRational = Rational<BigInt, Policies::Canonical, ErrorPolicy>;
+
+        /************************************************************************************************************
+         ****************************************** CONSTRUCTOR / DESTRUCTOR ****************************************
+         ************************************************************************************************************/
+
+        /**
+         * @brief Instantiate 0 / 1
+         */
+        inline HybridRational() noexcept = default;
+
+        /**
+         * @brief Create a rational from a numerator and a denominator (reduced at construction)
+         * @param numerator
+         * @param denominator
+         */
+        HybridRational(SmallType numerator, SmallType denominator = 1) noexcept(ErrorPolicy::isNoexcept); // NOLINT(google-explicit-constructor)
+
+        /**
+         * @brief Create a rational from a big rational. It's stored inline if it fits.
+         * @param bigRational
+         */
+        inline explicit HybridRational(BigRational bigRational) { assignBig(std::move(bigRational)); }
+
+        /**
+         * @brief Create a rational from a Rational with another int type
+         * @tparam IntType
+         * @tparam NormalizationPolicy
+         * @tparam AnotherErrorPolicy
+         * @param rational
+         */
+        template<typename IntType, typename NormalizationPolicy, typename AnotherErrorPolicy>
+        inline explicit HybridRational(const Rational<IntType, NormalizationPolicy, AnotherErrorPolicy> &rational)
+                : HybridRational(BigRational(BigInt(rational.getNumerator()), BigInt(rational.getDenominator()))) {}
+
+        inline HybridRational(const HybridRational &reference)
+                : m_numerator(reference.m_numerator), m_denominator(reference.m_denominator),
+                  m_big(reference.m_big ? std::make_unique<BigRational>(*reference.m_big) : nullptr) {}
+
+        inline HybridRational(HybridRational &&reference) noexcept = default;
+
+        inline HybridRational &operator=(const HybridRational &reference) {
+            if (this != &reference) *this = HybridRational(reference);
+            return *this;
+        }
+
+        inline HybridRational &operator=(HybridRational &&reference) noexcept = default;
+
+        inline ~HybridRational() = default;
+
+        /************************************************************************************************************
+         ************************************************ GETTERS ***************************************************
+         ************************************************************************************************************/
+
+        /**
+         * @return True if the value is stored inline on 64-bit integers
+         */
+        [[nodiscard]] inline bool isSmall() const noexcept { return m_big == nullptr; }
+
+        /**
+         * @return True if the value doesn't fit in 64 bits and lives on the heap
+         */
+        [[nodiscard]] inline bool isBig() const noexcept { return m_big != nullptr; }
+
+        /**
+         * @return The numerator (a BigInt, whatever the storage)
+         */
+        [[nodiscard]] inline BigInt getNumerator() const { return isSmall() ? BigInt(m_numerator) : m_big->getNumerator(); }
+
+        /**
+         * @return The denominator (a BigInt, whatever the storage)
+         */
+        [[nodiscard]] inline BigInt getDenominator() const { return isSmall() ? BigInt(m_denominator) : m_big->getDenominator(); }
+
+        [[nodiscard]] inline bool isZero() const noexcept { return isSmall() ? m_numerator == 0 : m_big->getNumerator().isZero(); }
+
+        [[nodiscard]] inline bool isNegative() const noexcept { return isSmall() ? m_numerator < 0 : m_big->getNumerator().isNegative(); }
+
+        /************************************************************************************************************
+         *********************************************** OPERATORS **************************************************
+         ************************************************************************************************************/
+
+        /**
+         * @brief Addition: 64-bit Henrici kernel, BigInt if it overflows
+         */
+        friend HybridRational operator+(const HybridRational &a, const HybridRational &b) {
+            SmallType numerator{}, denominator{};
+            if (a.isSmall() && b.isSmall() && !Tools::reducedAddOverflow(
+                    a.m_numerator, a.m_denominator, b.m_numerator, b.m_denominator, numerator, denominator)) {
+                return fromReducedOperands(numerator, denominator);
+            }
+            return promoted(a, b, [](const BigRational &x, const BigRational &y) { return x + y; });
+        }
+
+        /**
+         * @brief Subtraction: 64-bit Henrici kernel, BigInt if it overflows
+         */
+        friend HybridRational operator-(const HybridRational &a, const HybridRational &b) {
+            SmallType numerator{}, denominator{};
+            if (a.isSmall() && b.isSmall() && !Tools::reducedSubtractOverflow(
+                    a.m_numerator, a.m_denominator, b.m_numerator, b.m_denominator, numerator, denominator)) {
+                return fromReducedOperands(numerator, denominator);
+            }
+            return promoted(a, b, [](const BigRational &x, const BigRational &y) { return x - y; });
+        }
+
+        /**
+         * @brief Multiplication: 64-bit Knuth kernel, BigInt if it overflows
+         */
+        friend HybridRational operator*(const HybridRational &a, const HybridRational &b) {
+            SmallType numerator{}, denominator{};
+            if (a.isSmall() && b.isSmall() && !Tools::reducedMultiplyOverflow(
+                    a.m_numerator, a.m_denominator, b.m_numerator, b.m_denominator, numerator, denominator)) {
+                return fromReducedOperands(numerator, denominator);
+            }
+            return promoted(a, b, [](const BigRational &x, const BigRational &y) { return x * y; });
+        }
+
+        /**
+         * @brief Division: 64-bit Knuth kernel, BigInt if it overflows
+         */
+        friend HybridRational operator/(const HybridRational &a, const HybridRational &b) {
+            if (b.isZero()) {
+                ErrorPolicy::raise(ArkulibError::DivideByZero);
+                return HybridRational();
+            }
+
+            SmallType numerator{}, denominator{};
+            if (a.isSmall() && b.isSmall() && !Tools::reducedDivideOverflow(
+                    a.m_numerator, a.m_denominator, b.m_numerator, b.m_denominator, numerator, denominator)) {
+                return fromReducedOperands(numerator, denominator);
+            }
+            return promoted(a, b, [](const BigRational &x, const BigRational &y) { return x / y; });
+        }
+
+        /**
+         * @brief Unary minus (-INT64_MIN is promoted)
+         */
+        friend HybridRational operator-(const HybridRational &rational) {
+            SmallType numerator{};
+            if (rational.isSmall() && !Tools::subtractOverflow(SmallType(0), rational.m_numerator, numerator)) {
+                return fromReducedOperands(numerator, rational.m_denominator);
+            }
+            return HybridRational(-rational.toBigRational());
+        }
+
+        inline HybridRational &operator+=(const HybridRational &another) { return *this = *this + another; }
+
+        inline HybridRational &operator-=(const HybridRational &another) { return *this = *this - another; }
+
+        inline HybridRational &operator*=(const HybridRational &another) { return *this = *this * another; }
+
+        inline HybridRational &operator/=(const HybridRational &another) { return *this = *this / another; }
+
+        /************************************************************************************************************
+         ********************************************** COMPARISON **************************************************
+         ************************************************************************************************************/
+
+        /**
+         * @brief Both sides are reduced and a big value never fits inline: the storages must match
+         */
+        friend bool operator==(const HybridRational &a, const HybridRational &b) {
+            if (a.isSmall() != b.isSmall()) return false;
+            if (a.isSmall()) return a.m_numerator == b.m_numerator && a.m_denominator == b.m_denominator;
+            return *a.m_big == *b.m_big;
+        }
+
+        friend bool operator!=(const HybridRational &a, const HybridRational &b) { return !(a == b); }
+
+        friend bool operator<(const HybridRational &a, const HybridRational &b) { return compare(a, b) < 0; }
+
+        friend bool operator<=(const HybridRational &a, const HybridRational &b) { return compare(a, b) <= 0; }
+
+        friend bool operator>(const HybridRational &a, const HybridRational &b) { return compare(a, b) > 0; }
+
+        friend bool operator>=(const HybridRational &a, const HybridRational &b) { return compare(a, b) >= 0; }
+
+        /************************************************************************************************************
+         *********************************************** CONVERSION *************************************************
+         ************************************************************************************************************/
+
+        /**
+         * @return The value as a Rational<BigInt>
+         */
+        [[nodiscard]] inline BigRational toBigRational() const {
+            if (isBig()) return *m_big;
+            return BigRational(BigInt(m_numerator), BigInt(m_denominator), false, false);
+        }
+
+        /**
+         * @brief Get an approximation floating point number of the ratio
+         * @tparam FloatingType
+         * @return A floating point number (type FloatingType)
+         */
+        template<typename FloatingType = double>
+        [[nodiscard]] inline FloatingType toRealNumber() const noexcept {
+            if (isSmall()) return FloatingType(m_numerator) / FloatingType(m_denominator);
+            return m_big->template toRealNumber<FloatingType>();
+        }
+
+        /**
+         * @brief Return ( _numerator_ / _denominator_ ) as a string
+         * @return std::string
+         */
+        [[nodiscard]] inline std::string toString() const {
+            if (isBig()) return m_big->toString();
+            return "(" + std::to_string(m_numerator) + " / " + std::to_string(m_denominator) + ")";
+        }
+
+        inline friend std::ostream &operator<<(std::ostream &stream, const HybridRational &rational) {
+            return stream << rational.toString();
+        }
+
+        /************************************************************************************************************
+         ************************************************* STATIC ***************************************************
+         ************************************************************************************************************/
+
+        inline static HybridRational Zero() noexcept { return HybridRational(); }
+
+        inline static HybridRational One() noexcept { return fromReducedOperands(1, 1); }
+
+    private:
+        /************************************************************************************************************
+         ********************************************* MEMBERS ******************************************************
+         ************************************************************************************************************/
+
+        SmallType m_numerator = 0; /*!< Inline numerator (meaningless when m_big is set) */
+
+        SmallType m_denominator = 1; /*!< Inline denominator, always positive (meaningless when m_big is set) */
+
+        std::unique_ptr<BigRational> m_big; /*!< The value when it doesn't fit in 64 bits */
+
+        /************************************************************************************************************
+         ********************************************* METHODS ******************************************************
+         ************************************************************************************************************/
+
+        /**
+         * @brief Build from an already reduced numerator and a positive denominator (no gcd). INT64_MIN goes through
+         * BigInt like in the constructor, so that equal values always have the same storage.
+         */
+        inline static HybridRational fromReducedOperands(const SmallType numerator, const SmallType denominator) {
+            HybridRational result;
+            constexpr SmallType MIN = std::numeric_limits<SmallType>::lowest();
+            if (numerator == MIN || denominator == MIN) {
+                result.assignBig(BigRational(BigInt(numerator), BigInt(denominator)));
+                return result;
+            }
+            result.m_numerator = numerator;
+            result.m_denominator = denominator;
+            return result;
+        }
+
+        /**
+         * @brief Store a reduced big rational, inline if both operands fit in 64 bits
+         * @param bigRational
+         */
+        void assignBig(BigRational bigRational);
+
+        /**
+         * @brief Slow path of the operators: the operation is done with BigInt then the result is demoted if possible
+         * @tparam Operation
+         */
+        template<typename Operation>
+        static HybridRational promoted(const HybridRational &a, const HybridRational &b, Operation operation);
+
+        /**
+         * @return -1, 0 or 1 if a is lower, equal or greater than b
+         */
+        static int compare(const HybridRational &a, const HybridRational &b);
+    };
+
+    /************************************************************************************************************
+     ************************************************ DEFINITIONS ***********************************************
+     ************************************************************************************************************/
+
+    template<typename ErrorPolicy>
+    HybridRational<ErrorPolicy>::HybridRational(SmallType numerator, SmallType denominator) noexcept(ErrorPolicy::isNoexcept) {
+        if (denominator == 0) {
+            ErrorPolicy::raise(ArkulibError::DivideByZero);
+            return;
+        }
+
+        // |INT64_MIN| has no 64-bit opposite: these values go through BigInt (and come back if they are reduced)
+        constexpr SmallType MIN = std::numeric_limits<SmallType>::lowest();
+        if (numerator == MIN || denominator == MIN) {
+            assignBig(BigRational(BigInt(numerator), BigInt(denominator)));
+            return;
+        }
+
+        const SmallType gcd = Tools::gcd(numerator, denominator);
+        m_numerator = denominator < 0 ? -numerator / gcd : numerator / gcd;
+        m_denominator = denominator < 0 ? -denominator / gcd : denominator / gcd;
+    }
+
+    template<typename ErrorPolicy>
+    void HybridRational<ErrorPolicy>::assignBig(BigRational bigRational) {
+        // bitLength <= 63 keeps INT64_MIN big: the inline values can always be negated
+        constexpr std::size_t SMALL_BITS = std::numeric_limits<SmallType>::digits;
+        const BigInt numerator = bigRational.getNumerator();
+        const BigInt denominator = bigRational.getDenominator();
+
+        if (numerator.bitLength() <= SMALL_BITS && denominator.bitLength() <= SMALL_BITS) {
+            m_numerator = static_cast<SmallType>(numerator);
+            m_denominator = static_cast<SmallType>(denominator);
+            m_big.reset();
+        }
+        else if (m_big) {
+            *m_big = std::move(bigRational);
+        }
+        else {
+            m_big = std::make_unique<BigRational>(std::move(bigRational));
+        }
+    }
+
+    template<typename ErrorPolicy>
+    template<typename Operation>
+    HybridRational<ErrorPolicy> HybridRational<ErrorPolicy>::promoted(
+            const HybridRational &a,
+            const HybridRational &b,
+            Operation operation
+    ) {
+        // The big operands are used in place, only the small ones are converted
+        HybridRational result;
+        if (a.isBig() && b.isBig()) result.assignBig(operation(*a.m_big, *b.m_big));
+        else if (a.isBig()) result.assignBig(operation(*a.m_big, b.toBigRational()));
+        else if (b.isBig()) result.assignBig(operation(a.toBigRational(), *b.m_big));
+        else result.assignBig(operation(a.toBigRational(), b.toBigRational()));
+        return result;
+    }
+
+    template<typename ErrorPolicy>
+    int HybridRational<ErrorPolicy>::compare(const HybridRational &a, const HybridRational &b) {
+        if (a.isSmall() && b.isSmall()) {
+            return Tools::compareFractions(a.m_numerator, a.m_denominator, b.m_numerator, b.m_denominator);
+        }
+
+        const BigRational left = a.toBigRational();
+        const BigRational right = b.toBigRational();
+        return (left > right) - (left < right);
+    }
+}
@@ -0,0 +1,321 @@
+/**
+ * @file      Parallel.hpp
+ * @author    Elise MASSA
+ * @author    Mattéo LECLERCQ
+ * @date      2022
+ * @brief     Multithreaded reduce, transform and sum over large arrays of Rational or ERational. The range is cut in
+ *            fixed-size chunks merged in a fixed tree order: the result doesn't depend on the number of threads.
+ * @copyright WTFPL
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <functional>
+#include <iterator>
+#include <optional>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include "Algorithms.hpp"
+
+namespace Arkulib::Parallel {
+    /**
+     * @brief How a range is split between the threads
+     */
+    struct Options {
+        /**
+         * @brief Number of threads, the calling one included (0: std::thread::hardware_concurrency())
+         */
+        std::size_t threadCount = 0;
+
+        /**
+         * @brief Number of elements reduced sequentially by a thread. The order of the operations only depends on it:
+         * a non-associative operation (on ERational) gives the same result with any threadCount, not any chunkSize.
+         */
+        std::size_t chunkSize = std::size_t(1) << 14;
+    };
+}
+
+namespace Arkulib {
+    template<typename FloatType, typename ErrorPolicy>
+    class ERational;
+}
+
+namespace Arkulib::Tools {
+    /**
+     * @brief The ErrorPolicy of a Rational or an ERational, void for the other types
+     * @tparam Type
+     */
+    template<typename Type>
+    struct ErrorPolicyOf {
+        using Policy = void;
+    };
+
+    template<typename IntType, typename NormalizationPolicy, typename ErrorPolicy>
+    struct ErrorPolicyOf<Rational<IntType, NormalizationPolicy, ErrorPolicy>> {
+        using Policy = ErrorPolicy;
+    };
+
+    template<typename FloatType, typename ErrorPolicy>
+    struct ErrorPolicyOf<ERational<FloatType, ErrorPolicy>> {
+        using Policy = ErrorPolicy;
+    };
+
+    /**
+     * @brief True if the ErrorPolicy keeps a per-thread status (Policies::StatusFlag)
+     */
+    template<typename ErrorPolicy, typename = void>
+    constexpr bool hasThreadStatus = false;
+
+    template<typename ErrorPolicy>
+    constexpr bool hasThreadStatus<ErrorPolicy, std::void_t<decltype(ErrorPolicy::status()), decltype(ErrorPolicy::clear())>> = true;
+
+    /**
+     * @brief The errors that an ErrorPolicy keeps per thread: the status of StatusFlag, the statistics of Approximate.
+     * They are taken from a worker thread after each chunk, then given to the calling thread after the join.
+     * Nothing is kept for the other policies.
+     * @tparam ErrorPolicy
+     */
+    template<typename ErrorPolicy>
+    class ThreadErrors {
+    public:
+        /**
+         * @brief Move the errors of the current thread into this object, the thread starts again without error
+         */
+        inline void takeFromThread() noexcept {
+            if constexpr (hasThreadStatus<ErrorPolicy>) {
+                m_status = ErrorPolicy::status();
+                ErrorPolicy::clear();
+            }
+        }
+
+        /**
+         * @brief Raise the kept error in the current thread (the status is sticky: an older error stays)
+         */
+        inline void giveToThread() const noexcept {
+            if constexpr (hasThreadStatus<ErrorPolicy>) {
+                if (m_status != ArkulibError::None) ErrorPolicy::raise(m_status);
+            }
+        }
+
+    private:
+        ArkulibError m_status = ArkulibError::None;
+    };
+
+    template<typename BasePolicy>
+    class ThreadErrors<Policies::Approximate<BasePolicy>> {
+    public:
+        inline void takeFromThread() noexcept {
+            m_stats = Policies::Approximate<BasePolicy>::stats();
+            Policies::Approximate<BasePolicy>::resetStats();
+            m_base.takeFromThread();
+        }
+
+        inline void giveToThread() const noexcept {
+            Policies::Approximate<BasePolicy>::stats().merge(m_stats);
+            m_base.giveToThread();
+        }
+
+    private:
+        Policies::ApproximationStats m_stats;
+        ThreadErrors<BasePolicy> m_base;
+    };
+
+    /**
+     * @brief Call body(chunk) for every chunk in [0, chunkCount). The threads take the chunks in increasing order from
+     * a shared counter (a thread done early takes the next chunk). The calling thread works too.
+     * After an exception, no new chunk is started and the exception of the lowest chunk is rethrown: the chunks are
+     * claimed in order, so it's the same exception whatever the number of threads. Without exception support
+     * (-fno-exceptions), the chunks are called directly.
+     * The per-thread errors of ErrorPolicy (see ThreadErrors) raised by the chunks reach the calling thread, in the
+     * order of the chunks.
+     * @tparam ErrorPolicy The ErrorPolicy of the values computed by body (void if there is none)
+     * @param chunkCount
+     * @param threadCount 0 for std::thread::hardware_concurrency()
+     * @param body
+     */
+    template<typename ErrorPolicy = void, typename Body>
+    void forEachChunk(const std::size_t chunkCount, std::size_t threadCount, Body body) {
+        if (threadCount == 0) threadCount = std::max(1U, std::thread::hardware_concurrency());
+        threadCount = std::min(threadCount, chunkCount);
+
+        std::atomic<std::size_t> nextChunk{0};
+        std::atomic<bool> hasFailed{false};
+        std::vector<ThreadErrors<ErrorPolicy>> chunkErrors(chunkCount);
+#if defined(__cpp_exceptions) || defined(__EXCEPTIONS)
+        std::vector<std::exception_ptr> errors(chunkCount);
+#endif
+
+        const auto work = [&]() {
+            for (std::size_t chunk = nextChunk++; chunk < chunkCount && !hasFailed; chunk = nextChunk++) {
+                // The errors the thread had before the chunk are put aside, so that chunkErrors only get the chunk's
+                ThreadErrors<ErrorPolicy> previousErrors;
+                previousErrors.takeFromThread();
+#if defined(__cpp_exceptions) || defined(__EXCEPTIONS)
+                try {
+                    body(chunk);
+                } catch (...) {
+                    errors[chunk] = std::current_exception();
+                    hasFailed = true;
+                }
+#else
+                body(chunk);
+#endif
+                chunkErrors[chunk].takeFromThread();
+                previousErrors.giveToThread();
+            }
+        };
+
+        std::vector<std::thread> threads;
+        threads.reserve(threadCount > 0 ? threadCount - 1 : 0);
+        for (std::size_t i = 1; i < threadCount; ++i) threads.emplace_back(work);
+        work();
+        for (std::thread &thread: threads) thread.join();
+
+        for (const ThreadErrors<ErrorPolicy> &errors: chunkErrors) errors.giveToThread();
+
+#if defined(__cpp_exceptions) || defined(__EXCEPTIONS)
+        for (const std::exception_ptr &error: errors) if (error) std::rethrow_exception(error);
+#endif
+    }
+
+    /**
+     * @brief Merge partial results in a fixed binary tree: (p0 + p1) + (p2 + p3)... level by level
+     * @param partials Not empty. partials[0] receives the result.
+     * @param merge merge(left, right) adds right into left
+     */
+    template<typename PartialType, typename Merge>
+    void mergeInTreeOrder(std::vector<PartialType> &partials, Merge merge) {
+        for (std::size_t width = 1; width < partials.size(); width *= 2) {
+            for (std::size_t i = 0; i + width < partials.size(); i += 2 * width) merge(partials[i], partials[i + width]);
+        }
+    }
+}
+
+namespace Arkulib::Parallel {
+    /************************************************************************************************************
+     ************************************************** REDUCE **************************************************
+     ************************************************************************************************************/
+
+    /**
+     * @brief init op (x0 op x1 op ... op xn-1), computed by several threads. Every chunk is folded in order, then the
+     * chunks are merged in a fixed tree: the result is the same with any number of threads.
+     * @tparam RandomIterator
+     * @tparam Type
+     * @tparam BinaryOperation Must be associative (up to the rounding for ERational)
+     * @param first
+     * @param last
+     * @param init
+     * @param operation
+     * @param options
+     * @return The reduction
+     */
+    template<typename RandomIterator, typename Type, typename BinaryOperation>
+    Type reduce(RandomIterator first, RandomIterator last, Type init, BinaryOperation operation, const Options &options = {}) {
+        const std::size_t size = static_cast<std::size_t>(std::distance(first, last));
+        if (size == 0) return init;
+        const std::size_t chunkSize = std::max<std::size_t>(options.chunkSize, 1);
+        const std::size_t chunkCount = (size + chunkSize - 1) / chunkSize;
+
+        std::vector<std::optional<Type>> partials(chunkCount);
+        Tools::forEachChunk<typename Tools::ErrorPolicyOf<Type>::Policy>(chunkCount, options.threadCount, [&](const std::size_t chunk) {
+            RandomIterator current = first + static_cast<std::ptrdiff_t>(chunk * chunkSize);
+            const RandomIterator end = first + static_cast<std::ptrdiff_t>(std::min(size, (chunk + 1) * chunkSize));
+            Type partial = *current;
+            for (++current; current != end; ++current) partial = operation(partial, *current);
+            partials[chunk] = std::move(partial);
+        });
+
+        Tools::mergeInTreeOrder(partials, [&](std::optional<Type> &left, const std::optional<Type> &right) {
+            left = operation(*left, *right);
+        });
+        return operation(init, *partials[0]);
+    }
+
+    /**
+     * @brief Sum computed by several threads, with the same result for any number of threads.
+     * The Rational sums are exact (see Arkulib::sum): every chunk is accumulated over a common denominator, the
+     * accumulators are merged, and there is one gcd at the end. The others (ERational...) are reduced with +.
+     * @tparam RandomIterator
+     * @param first
+     * @param last
+     * @param options
+     * @return The sum
+     */
+    template<typename RandomIterator>
+    typename std::iterator_traits<RandomIterator>::value_type sum(RandomIterator first, RandomIterator last, const Options &options = {}) {
+        using Type = typename std::iterator_traits<RandomIterator>::value_type;
+        if constexpr (Tools::isRational<Type>) {
+            using Accumulator = Tools::ExactAccumulator<Type>;
+            const std::size_t size = static_cast<std::size_t>(std::distance(first, last));
+            const std::size_t chunkSize = std::max<std::size_t>(options.chunkSize, 1);
+            const std::size_t chunkCount = (size + chunkSize - 1) / chunkSize;
+            if (chunkCount == 0) return Type();
+
+            std::vector<Accumulator> partials(chunkCount);
+            Tools::forEachChunk<typename Tools::ErrorPolicyOf<Type>::Policy>(chunkCount, options.threadCount, [&](const std::size_t chunk) {
+                using WideType = typename Accumulator::WideType;
+                partials[chunk].addRange(
+                        first + static_cast<std::ptrdiff_t>(chunk * chunkSize),
+                        first + static_cast<std::ptrdiff_t>(std::min(size, (chunk + 1) * chunkSize)),
+                        [](const RandomIterator &iterator) {
+                            return std::pair<WideType, WideType>(iterator->getNumerator(), iterator->getDenominator());
+                        }
+                );
+            });
+
+            Tools::mergeInTreeOrder(partials, [](Accumulator &left, const Accumulator &right) { left.merge(right); });
+            return partials[0].toRational();
+        }
+        else {
+            return reduce(first, last, Type(), std::plus<>(), options);
+        }
+    }
+
+    /**
+     * @brief Exact sum of a container of rationals (std::vector, std::array...)
+     */
+    template<typename Container>
+    auto sum(const Container &values, const Options &options = {}) -> decltype(sum(std::begin(values), std::end(values), options)) {
+        return sum(std::begin(values), std::end(values), options);
+    }
+
+    /************************************************************************************************************
+     ************************************************* TRANSFORM ************************************************
+     ************************************************************************************************************/
+
+    /**
+     * @brief out[i] = operation(first[i]) for every element, computed by several threads
+     * @tparam RandomIterator
+     * @tparam OutputRandomIterator
+     * @tparam UnaryOperation
+     * @param first
+     * @param last
+     * @param out Has room for the whole range (can be first)
+     * @param operation
+     * @param options
+     * @return The end of the output range
+     */
+    template<typename RandomIterator, typename OutputRandomIterator, typename UnaryOperation>
+    OutputRandomIterator transform(
+            RandomIterator first, RandomIterator last, OutputRandomIterator out,
+            UnaryOperation operation, const Options &options = {}
+    ) {
+        const std::size_t size = static_cast<std::size_t>(std::distance(first, last));
+        const std::size_t chunkSize = std::max<std::size_t>(options.chunkSize, 1);
+        const std::size_t chunkCount = (size + chunkSize - 1) / chunkSize;
+
+        using ResultType = std::decay_t<decltype(operation(*first))>;
+        Tools::forEachChunk<typename Tools::ErrorPolicyOf<ResultType>::Policy>(chunkCount, options.threadCount, [&](const std::size_t chunk) {
+            const std::size_t begin = chunk * chunkSize, end = std::min(size, begin + chunkSize);
+            for (std::size_t i = begin; i < end; ++i) {
+                out[static_cast<std::ptrdiff_t>(i)] = operation(first[static_cast<std::ptrdiff_t>(i)]);
+            }
+        });
+        return out + static_cast<std::ptrdiff_t>(size);
+    }
+}
@@ -0,0 +1,161 @@
+/**
+ * @file      ErrorPolicies.hpp
+ * @author    Elise MASSA
+ * @author    Mattéo LECLERCQ
+ * @date      2022
+ * @brief     Choose how Rational and ERational report their errors (last template parameter)
+ * @copyright WTFPL
+ */
+
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <cstdlib>
+#include <type_traits>
+
+#include "../Exceptions/ArkulibError.hpp"
+#if defined(__cpp_exceptions) || defined(__EXCEPTIONS)
+#include "../Exceptions/Exceptions.hpp"
+#endif
+
+namespace Arkulib::Policies {
+    /**
+     * @brief Throw the exception matching the error (the historical behavior).
+     * Without exception support (-fno-exceptions), the program is aborted instead.
+     */
+    struct Throw {
+        static constexpr bool isNoexcept = false;
+
+        [[noreturn]] static inline void raise(const ArkulibError error) {
+#if defined(__cpp_exceptions) || defined(__EXCEPTIONS)
+            switch (error) {
+                case ArkulibError::DivideByZero: throw Exceptions::DivideByZeroException();
+                case ArkulibError::NegativeSqrt: throw Exceptions::NegativeSqrtException();
+                case ArkulibError::InvalidAccessArgument: throw Exceptions::InvalidAccessArgument();
+                case ArkulibError::FloatTypeGiven: throw Exceptions::FloatTypeGivenException();
+                case ArkulibError::IntTypeGiven: throw Exceptions::IntTypeGivenException();
+                case ArkulibError::NumberTooLarge: throw Exceptions::NumberTooLargeException();
+                case ArkulibError::DigitsTooLarge: throw Exceptions::DigitsTooLargeException();
+                case ArkulibError::None: break;
+            }
+#else
+            (void) error;
+#endif
+            std::abort();
+        }
+    };
+
+    /**
+     * @brief Sticky per-thread status flag: the first error is kept until clear() is called.
+     * The failing operation returns zero.
+     */
+    struct StatusFlag {
+        static constexpr bool isNoexcept = true;
+
+        static inline void raise(const ArkulibError error) noexcept {
+            if (status() == ArkulibError::None) status() = error;
+        }
+
+        /**
+         * @return The first error raised since the last clear() in this thread
+         */
+        static inline ArkulibError &status() noexcept {
+            thread_local ArkulibError error = ArkulibError::None;
+            return error;
+        }
+
+        [[nodiscard]] static inline bool hasError() noexcept { return status() != ArkulibError::None; }
+
+        static inline void clear() noexcept { status() = ArkulibError::None; }
+    };
+
+    /**
+     * @brief Only assert (nothing is checked with NDEBUG). The failing operation returns zero.
+     */
+    struct AssertOnly {
+        static constexpr bool isNoexcept = true;
+
+        static inline void raise([[maybe_unused]] const ArkulibError error) noexcept {
+            assert(error == ArkulibError::None && "An Arkulib operation failed");
+        }
+    };
+
+    /**
+     * @brief Throw when the exceptions are enabled, assert otherwise
+     */
+#if defined(__cpp_exceptions) || defined(__EXCEPTIONS)
+    using DefaultErrorPolicy = Throw;
+#else
+    using DefaultErrorPolicy = AssertOnly;
+#endif
+
+    /**
+     * @brief How much precision the overflow approximations of one thread lost
+     */
+    struct ApproximationStats {
+        std::size_t count = 0;
+        double maxError = 0.;
+        double totalError = 0.;
+
+        /**
+         * @return The mean absolute error of an approximation (0 if there was none)
+         */
+        [[nodiscard]] inline double meanError() const noexcept {
+            return count == 0 ? 0. : totalError / static_cast<double>(count);
+        }
+
+        /**
+         * @brief Add the approximations of other (the statistics of another thread)
+         * @param other
+         */
+        inline void merge(const ApproximationStats &other) noexcept {
+            count += other.count;
+            totalError += other.totalError;
+            if (other.maxError > maxError) maxError = other.maxError;
+        }
+    };
+
+    /**
+     * @brief When a result doesn't fit in IntType, return the closest rational that fits instead of reporting
+     * NumberTooLarge (values beyond the limits saturate to +-max / 1). The absolute error of every approximation
+     * is recorded in per-thread statistics. The other errors are reported by BasePolicy.
+     * @tparam BasePolicy
+     */
+    template<typename BasePolicy = DefaultErrorPolicy>
+    struct Approximate {
+        static constexpr bool isNoexcept = BasePolicy::isNoexcept;
+        static constexpr bool approximatesOverflow = true;
+
+        static inline void raise(const ArkulibError error) noexcept(isNoexcept) {
+            BasePolicy::raise(error);
+        }
+
+        /**
+         * @return The statistics of the approximations made in this thread since the last resetStats()
+         */
+        static inline ApproximationStats &stats() noexcept {
+            thread_local ApproximationStats approximationStats;
+            return approximationStats;
+        }
+
+        static inline void recordApproximation(const double absoluteError) noexcept {
+            ApproximationStats &approximationStats = stats();
+            ++approximationStats.count;
+            approximationStats.totalError += absoluteError;
+            if (absoluteError > approximationStats.maxError) approximationStats.maxError = absoluteError;
+        }
+
+        static inline void resetStats() noexcept { stats() = ApproximationStats(); }
+    };
+
+    /**
+     * @brief True if the error policy approximates the results that overflow (Policy::approximatesOverflow)
+     * @tparam Policy
+     */
+    template<typename Policy, typename = void>
+    constexpr bool isApproximating = false;
+
+    template<typename Policy>
+    constexpr bool isApproximating<Policy, std::void_t<decltype(Policy::approximatesOverflow)>> = Policy::approximatesOverflow;
+}
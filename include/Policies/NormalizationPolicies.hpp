@@ -0,0 +1,29 @@
+/**
+ * @file      NormalizationPolicies.hpp
+ * @author    Elise MASSA
+ * @author    Mattéo LECLERCQ
+ * @date      2022
+ * @brief     Choose when a Rational is reduced (second template parameter of Rational)
+ * @copyright WTFPL
+ */
+
+#pragma once
+
+namespace Arkulib::Policies {
+    /**
+     * @brief The rational is always stored in its reduced form (gcd(numerator, denominator) == 1, denominator > 0).
+     * Every construction pays a gcd, but == and != are plain field comparisons.
+     */
+    struct Canonical {
+        static constexpr bool isAlwaysReduced = true;
+    };
+
+    /**
+     * @brief The rational is only reduced on demand: by normalize(), when it is printed or when an operation
+     * would overflow. Useful for long chains of operations where one gcd at the end is enough.
+     * The denominator is still always kept positive.
+     */
+    struct Lazy {
+        static constexpr bool isAlwaysReduced = false;
+    };
+}
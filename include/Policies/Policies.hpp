@@ -0,0 +1,12 @@
+/**
+ * @file      Policies.hpp
+ * @author    Elise MASSA
+ * @author    Mattéo LECLERCQ
+ * @date      2022
+ * @copyright WTFPL
+ */
+
+#pragma once
+
+#include "NormalizationPolicies.hpp"
+#include "ErrorPolicies.hpp"
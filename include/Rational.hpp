@@ -11,20 +11,61 @@
 
 #include <cassert>
 #include <cmath>
+#if __has_include(<compare>)
+#include <compare>
+#endif
 #include <fstream>
 #include <iostream>
 #include <numeric>
+#include <ratio>
 
 #include "Exceptions/Exceptions.hpp"
+#include "Policies/Policies.hpp"
+#include "Tools/Approximation.hpp"
+#include "Tools/ArithmeticKernels.hpp"
+#include "Tools/Charconv.hpp"
+#include "Tools/Expected.hpp"
+#include "Tools/Comparison.hpp"
+#include "Tools/FloatDecomposition.hpp"
+#include "Tools/Gcd.hpp"
+#include "Tools/Hash.hpp"
+#include "Tools/IntegerTraits.hpp"
+#include "Tools/SquareRoot.hpp"
 #include "Tools/Utils.hpp"
 
+namespace Arkulib::Tools {
+    /**
+     * @brief True for the nodes of the expression templates (RationalExpression.hpp), tagged by IsRationalExpression:
+     * the arithmetic operators of Rational leave them to their own operators
+     */
+    template<typename Type, typename = void>
+    constexpr bool isRationalExpression = false;
+
+    template<typename Type>
+    constexpr bool isRationalExpression<Type, std::void_t<typename Type::IsRationalExpression>> = true;
+
+    /**
+     * @brief True for the types a rational is built from by value: the integers and the floating points. The other
+     * types (expressions, fixed rationals, ...) are converted by their own operators.
+     */
+    template<typename Type>
+    constexpr bool isRealNumber = IntegerTraits<Type>::isInteger || std::is_floating_point_v<Type>;
+}
+
 namespace Arkulib {
     /**
      * @brief This class can be used to express rationals
      * @tparam IntType
+     * @tparam NormalizationPolicy Policies::Canonical (always reduced) or Policies::Lazy (reduced on demand)
+     * @tparam ErrorPolicy Policies::Throw, Policies::StatusFlag, Policies::AssertOnly or Policies::Approximate
      */
-    template<typename IntType = int>
+    template<
+            typename IntType = int,
+            typename NormalizationPolicy = Policies::Canonical,
+            typename ErrorPolicy = Policies::DefaultErrorPolicy
+    >
     class Rational {
+        static_assert(Tools::IntegerTraits<IntType>::isInteger, "The type given to a rational must not be a floating point.");
 
     public:
 
@@ -35,43 +76,69 @@ namespace Arkulib {
         /**
          * @brief Instantiate an object without parameters.
          */
-        inline constexpr Rational() : m_numerator(0), m_denominator(1) { verifyTemplateType(); }
+        inline constexpr Rational() noexcept(ErrorPolicy::isNoexcept) : m_numerator(0), m_denominator(1) {}
 
         /**
          * @brief Create a rational from a numerator and a denominator.
          * @param numerator
          * @param denominator
-         * @param willBeReduce
+         * @param willBeReduce Only honoured by the Lazy policy: the Canonical policy always reduces
          * @param willDenominatorBeVerified
          */
         constexpr Rational(
                 IntType numerator,
                 IntType denominator,
-                bool willBeReduce = true,
+                bool willBeReduce = NormalizationPolicy::isAlwaysReduced,
                 bool willDenominatorBeVerified = true
-        );
+        ) noexcept(ErrorPolicy::isNoexcept);
 
         /**
          * @brief Create a rational from a floating number
          * @tparam FloatingType
          * @param nonRational
          */
-        template<typename FloatingType>
+        template<typename FloatingType, std::enable_if_t<Tools::isRealNumber<FloatingType>, int> = 0>
         constexpr explicit Rational(const FloatingType &nonRational);
 
+        /**
+         * @brief Create the rational exactly equal to a floating number (see fromFloatingPointExact)
+         * @tparam FloatingType
+         * @param nonRational
+         */
+        template<typename FloatingType>
+        constexpr Rational(const FloatingType &nonRational, ExactTag) noexcept(ErrorPolicy::isNoexcept)
+                : Rational(fromFloatingPointExact(nonRational)) {}
+
+        /**
+         * @brief Create a rational from a std::ratio (std::milli, std::ratio_add<...>, ...), checked at compile time
+         * @tparam Num
+         * @tparam Den
+         */
+        template<std::intmax_t Num, std::intmax_t Den>
+        constexpr explicit Rational(std::ratio<Num, Den>) noexcept
+                : Rational(IntType(std::ratio<Num, Den>::num), IntType(std::ratio<Num, Den>::den), false, false) {
+            static_assert(
+                    !Tools::IntegerTraits<IntType>::isBounded
+                    || (Tools::fitsIn<IntType>(std::ratio<Num, Den>::num) && Tools::fitsIn<IntType>(std::ratio<Num, Den>::den)),
+                    "The std::ratio doesn't fit in the IntType of the rational"
+            );
+        }
+
         /**
          * @brief Default copy constructor
          * @param reference
          */
-        inline constexpr Rational(const Rational<IntType> &reference) = default;
+        inline constexpr Rational(const Rational<IntType, NormalizationPolicy, ErrorPolicy> &reference) = default;
 
         /**
          * @brief Copy constructor with another int type
          * @tparam AnotherIntType
+         * @tparam AnotherPolicy
+         * @tparam AnotherErrorPolicy
          * @param copiedRational
          */
-        template<typename AnotherIntType>
-        constexpr explicit Rational(Rational<AnotherIntType> &copiedRational);
+        template<typename AnotherIntType, typename AnotherPolicy, typename AnotherErrorPolicy>
+        constexpr explicit Rational(Rational<AnotherIntType, AnotherPolicy, AnotherErrorPolicy> &copiedRational);
 
         /**
          * @brief Default Destructor
@@ -111,15 +178,28 @@ namespace Arkulib {
          ************************************************ SETTERS ***************************************************
          ************************************************************************************************************/
 
-        constexpr inline void setNumerator(IntType numerator) { m_numerator = numerator; };
+        /**
+         * @brief Set the numerator. The rational is reduced again with the Canonical policy.
+         * @param numerator
+         */
+        constexpr inline void setNumerator(IntType numerator) {
+            m_numerator = numerator;
+            if constexpr (NormalizationPolicy::isAlwaysReduced) normalize();
+        };
 
+        /**
+         * @brief Set the denominator. The rational is reduced again with the Canonical policy.
+         * @param denominator
+         */
         constexpr inline void setDenominator(IntType denominator) {
-            verifyDenominator(denominator);
             m_denominator = denominator;
+            verifyDenominator(denominator);
+            if constexpr (NormalizationPolicy::isAlwaysReduced) normalize();
         };
 
         /**
          * @brief Setter with [] operator. Example: rational[0] = 1 and rational[1] = 2 //// total => (1/2)
+         * @warning The reference bypasses the normalization policy: call normalize() after writing through it
          * @param id
          */
         inline IntType &operator[](const size_t &id);
@@ -136,12 +216,15 @@ namespace Arkulib {
         /**
          * @return True if the rational is an integer
          */
-        [[maybe_unused]] [[nodiscard]] inline bool isInteger() const noexcept { return getDenominator() == 1; };
+        [[maybe_unused]] [[nodiscard]] inline bool isInteger() const noexcept {
+            if constexpr (NormalizationPolicy::isAlwaysReduced) return getDenominator() == 1;
+            else return getNumerator() % getDenominator() == 0;
+        };
 
         /**
          * @return True if the rational is equal to zero
          */
-        [[maybe_unused]] [[nodiscard]] inline bool isZero() const noexcept { return getNumerator() == 0; };
+        [[maybe_unused]] [[nodiscard]] constexpr inline bool isZero() const noexcept { return getNumerator() == 0; };
 
         /************************************************************************************************************
          *********************************************** OPERATOR + *************************************************
@@ -152,7 +235,7 @@ namespace Arkulib {
          * @param anotherRational
          * @return The sum in Rational
          */
-        constexpr Rational<IntType> operator+(const Rational<IntType> &anotherRational) const;
+        constexpr Rational<IntType, NormalizationPolicy, ErrorPolicy> operator+(const Rational<IntType, NormalizationPolicy, ErrorPolicy> &anotherRational) const noexcept(ErrorPolicy::isNoexcept);
 
         /**
          * @brief Addition operation between a rational and another type. Example: Rational + int
@@ -160,9 +243,9 @@ namespace Arkulib {
          * @param nonRational
          * @return The sum in Rational
          */
-        template<typename NonRationalType>
-        constexpr inline Rational<IntType> operator+(const NonRationalType &nonRational) const {
-            return Rational<IntType>(nonRational) + *this;
+        template<typename NonRationalType, std::enable_if_t<!Tools::isRationalExpression<NonRationalType>, int> = 0>
+        constexpr inline Rational<IntType, NormalizationPolicy, ErrorPolicy> operator+(const NonRationalType &nonRational) const {
+            return Rational<IntType, NormalizationPolicy, ErrorPolicy>(nonRational) + *this;
         }
 
         /**
@@ -172,12 +255,12 @@ namespace Arkulib {
          * @param rational
          * @return The sum in Rational
          */
-        template<typename NonRationalType>
-        constexpr inline friend Rational<IntType> operator+(
+        template<typename NonRationalType, std::enable_if_t<!Tools::isRationalExpression<NonRationalType>, int> = 0>
+        constexpr inline friend Rational<IntType, NormalizationPolicy, ErrorPolicy> operator+(
                 const NonRationalType nonRational,
-                const Rational<IntType> &rational
+                const Rational<IntType, NormalizationPolicy, ErrorPolicy> &rational
         ) {
-            return Rational<IntType>(nonRational) + rational;
+            return Rational<IntType, NormalizationPolicy, ErrorPolicy>(nonRational) + rational;
         }
 
         /************************************************************************************************************
@@ -189,7 +272,7 @@ namespace Arkulib {
          * @param anotherRational
          * @return The subtraction in Rational
          */
-        constexpr Rational<IntType> operator-(const Rational<IntType> &anotherRational) const;
+        constexpr Rational<IntType, NormalizationPolicy, ErrorPolicy> operator-(const Rational<IntType, NormalizationPolicy, ErrorPolicy> &anotherRational) const noexcept(ErrorPolicy::isNoexcept);
 
         /**
          * @brief Subtraction operation between a rational and another type. Example: Rational - int
@@ -197,9 +280,9 @@ namespace Arkulib {
          * @param nonRational
          * @return The subtraction in Rational
          */
-        template<typename NonRationalType>
-        constexpr inline Rational<IntType> operator-(const NonRationalType &nonRational) const {
-            return *this - Rational<IntType>(nonRational);
+        template<typename NonRationalType, std::enable_if_t<!Tools::isRationalExpression<NonRationalType>, int> = 0>
+        constexpr inline Rational<IntType, NormalizationPolicy, ErrorPolicy> operator-(const NonRationalType &nonRational) const {
+            return *this - Rational<IntType, NormalizationPolicy, ErrorPolicy>(nonRational);
         }
 
         /**
@@ -209,12 +292,12 @@ namespace Arkulib {
          * @param rational
          * @return The subtraction in Rational
          */
-        template<typename NonRationalType>
-        constexpr inline friend Rational<IntType> operator-(
+        template<typename NonRationalType, std::enable_if_t<!Tools::isRationalExpression<NonRationalType>, int> = 0>
+        constexpr inline friend Rational<IntType, NormalizationPolicy, ErrorPolicy> operator-(
                 const NonRationalType nonRational,
-                const Rational<IntType> &rational
+                const Rational<IntType, NormalizationPolicy, ErrorPolicy> &rational
         ) {
-            return Rational<IntType>(nonRational) - rational;
+            return Rational<IntType, NormalizationPolicy, ErrorPolicy>(nonRational) - rational;
         }
 
         /**
@@ -223,7 +306,7 @@ namespace Arkulib {
          * @return The rational in negative
          */
         constexpr inline friend Rational operator-(const Rational &rational) {
-            return Rational<IntType>(-rational.getNumerator(), rational.getDenominator());
+            return Rational<IntType, NormalizationPolicy, ErrorPolicy>(-rational.getNumerator(), rational.getDenominator());
         }
 
         /************************************************************************************************************
@@ -235,7 +318,7 @@ namespace Arkulib {
          * @param anotherRational
          * @return The multiplication in Rational
          */
-        constexpr Rational<IntType> operator*(const Rational<IntType> &anotherRational) const;
+        constexpr Rational<IntType, NormalizationPolicy, ErrorPolicy> operator*(const Rational<IntType, NormalizationPolicy, ErrorPolicy> &anotherRational) const noexcept(ErrorPolicy::isNoexcept);
 
         /**
          * @brief Multiplication operation between a rational and another type. Example: Rational * int
@@ -243,9 +326,9 @@ namespace Arkulib {
          * @param nonRational
          * @return The multiplication in Rational
          */
-        template<typename NonRationalType>
-        constexpr inline Rational<IntType> operator*(const NonRationalType &nonRational) const {
-            return *this * Rational<IntType>(nonRational);
+        template<typename NonRationalType, std::enable_if_t<!Tools::isRationalExpression<NonRationalType>, int> = 0>
+        constexpr inline Rational<IntType, NormalizationPolicy, ErrorPolicy> operator*(const NonRationalType &nonRational) const {
+            return *this * Rational<IntType, NormalizationPolicy, ErrorPolicy>(nonRational);
         }
 
         /**
@@ -255,12 +338,12 @@ namespace Arkulib {
          * @param rational
          * @return The multiplication in Rational
          */
-        template<typename NonRationalType>
-        constexpr inline friend Rational<IntType> operator*(
+        template<typename NonRationalType, std::enable_if_t<!Tools::isRationalExpression<NonRationalType>, int> = 0>
+        constexpr inline friend Rational<IntType, NormalizationPolicy, ErrorPolicy> operator*(
                 const NonRationalType nonRational,
-                const Rational<IntType> &rational
+                const Rational<IntType, NormalizationPolicy, ErrorPolicy> &rational
         ) {
-            return Rational<IntType>(nonRational) * rational;
+            return Rational<IntType, NormalizationPolicy, ErrorPolicy>(nonRational) * rational;
         }
 
         /************************************************************************************************************
@@ -272,7 +355,7 @@ namespace Arkulib {
          * @param anotherRational
          * @return The division in Rational
          */
-        constexpr Rational<IntType> operator/(const Rational<IntType> &anotherRational) const;
+        constexpr Rational<IntType, NormalizationPolicy, ErrorPolicy> operator/(const Rational<IntType, NormalizationPolicy, ErrorPolicy> &anotherRational) const noexcept(ErrorPolicy::isNoexcept);
 
         /**
          * @brief Division operation between a rational and another type. Example: Rational / int
@@ -280,9 +363,9 @@ namespace Arkulib {
          * @param nonRational
          * @return The division in Rational
          */
-        template<typename NonRationalType>
-        constexpr inline Rational<IntType> operator/(const NonRationalType &nonRational) const {
-            return *this / Rational<IntType>(nonRational);
+        template<typename NonRationalType, std::enable_if_t<!Tools::isRationalExpression<NonRationalType>, int> = 0>
+        constexpr inline Rational<IntType, NormalizationPolicy, ErrorPolicy> operator/(const NonRationalType &nonRational) const {
+            return *this / Rational<IntType, NormalizationPolicy, ErrorPolicy>(nonRational);
         }
 
         /**
@@ -292,12 +375,12 @@ namespace Arkulib {
          * @param rational
          * @return The division in Rational
          */
-        template<typename NonRationalType>
-        constexpr inline friend Rational<IntType> operator/(
+        template<typename NonRationalType, std::enable_if_t<!Tools::isRationalExpression<NonRationalType>, int> = 0>
+        constexpr inline friend Rational<IntType, NormalizationPolicy, ErrorPolicy> operator/(
                 const NonRationalType nonRational,
-                const Rational<IntType> &rational
+                const Rational<IntType, NormalizationPolicy, ErrorPolicy> &rational
         ) {
-            return Rational<IntType>(nonRational) / rational;
+            return Rational<IntType, NormalizationPolicy, ErrorPolicy>(nonRational) / rational;
         }
 
         /************************************************************************************************************
@@ -309,12 +392,23 @@ namespace Arkulib {
          * @param anotherRational
          * @return True if the first rational is equal to the second
          */
-        constexpr inline bool operator==(const Rational<IntType> &anotherRational) const {
-            Rational<IntType> leftRational = simplify();
-            Rational<IntType> rightRational = anotherRational.simplify();
+        constexpr inline bool operator==(const Rational<IntType, NormalizationPolicy, ErrorPolicy> &anotherRational) const {
+            if constexpr (NormalizationPolicy::isAlwaysReduced) {
+                // Both rationals are reduced: the representation is unique
+                return getNumerator() == anotherRational.getNumerator()
+                       && getDenominator() == anotherRational.getDenominator();
+            }
+            else if constexpr (Tools::WiderInteger<IntType>::isWider) {
+                return static_cast<WideType>(getNumerator()) * anotherRational.getDenominator()
+                       == static_cast<WideType>(anotherRational.getNumerator()) * getDenominator();
+            }
+            else {
+                const Rational<IntType, NormalizationPolicy, ErrorPolicy> leftRational = simplify();
+                const Rational<IntType, NormalizationPolicy, ErrorPolicy> rightRational = anotherRational.simplify();
 
-            return (leftRational.getNumerator() == rightRational.getNumerator() &&
-                    leftRational.getDenominator() == rightRational.getDenominator());
+                return (leftRational.getNumerator() == rightRational.getNumerator() &&
+                        leftRational.getDenominator() == rightRational.getDenominator());
+            }
         }
 
         /**
@@ -325,7 +419,7 @@ namespace Arkulib {
          */
         template<typename NonRationalType>
         constexpr inline bool operator==(const NonRationalType &nonRational) const {
-            return Rational<IntType>(nonRational) == *this;
+            return Rational<IntType, NormalizationPolicy, ErrorPolicy>(nonRational) == *this;
         }
 
         /**
@@ -338,9 +432,9 @@ namespace Arkulib {
         template<typename NonRationalType>
         constexpr inline friend bool operator==(
                 const NonRationalType nonRational,
-                const Rational<IntType> &rational
+                const Rational<IntType, NormalizationPolicy, ErrorPolicy> &rational
         ) {
-            return Rational<IntType>(nonRational) == rational;
+            return Rational<IntType, NormalizationPolicy, ErrorPolicy>(nonRational) == rational;
         }
 
         /************************************************************************************************************
@@ -352,12 +446,8 @@ namespace Arkulib {
          * @param anotherRational
          * @return True if the first rational is different to the second
          */
-        constexpr inline bool operator!=(const Rational<IntType> &anotherRational) const {
-            Rational<IntType> leftRational = simplify();
-            Rational<IntType> rightRational = anotherRational.simplify();
-
-            return (leftRational.getNumerator() != rightRational.getNumerator() ||
-                    leftRational.getDenominator() != rightRational.getDenominator());
+        constexpr inline bool operator!=(const Rational<IntType, NormalizationPolicy, ErrorPolicy> &anotherRational) const {
+            return !(*this == anotherRational);
         }
 
         /**
@@ -368,7 +458,7 @@ namespace Arkulib {
         */
         template<typename NonRationalType>
         constexpr inline bool operator!=(const NonRationalType &nonRational) const {
-            return Rational<IntType>(nonRational) != *this;
+            return Rational<IntType, NormalizationPolicy, ErrorPolicy>(nonRational) != *this;
         }
 
         /**
@@ -381,9 +471,9 @@ namespace Arkulib {
         template<typename NonRationalType>
         constexpr inline friend bool operator!=(
                 const NonRationalType nonRational,
-                const Rational<IntType> &rational
+                const Rational<IntType, NormalizationPolicy, ErrorPolicy> &rational
         ) {
-            return Rational<IntType>(nonRational) != rational;
+            return Rational<IntType, NormalizationPolicy, ErrorPolicy>(nonRational) != rational;
         }
 
         /************************************************************************************************************
@@ -395,8 +485,11 @@ namespace Arkulib {
          * @param anotherRational
          * @return True if the first rational is inferior to the second
          */
-        constexpr inline bool operator<(const Rational<IntType> &anotherRational) const {
-            return toRealNumber() < anotherRational.toRealNumber();
+        constexpr inline bool operator<(const Rational<IntType, NormalizationPolicy, ErrorPolicy> &anotherRational) const noexcept {
+            return Tools::compareFractions(
+                    getNumerator(), getDenominator(),
+                    anotherRational.getNumerator(), anotherRational.getDenominator()
+            ) < 0;
         }
 
         /**
@@ -406,7 +499,7 @@ namespace Arkulib {
          * @return True if the rational is inferior to the second operand
          */
         template<typename NonRationalType>
-        constexpr inline bool operator<(const NonRationalType &nonRational) const { return *this < Rational<IntType>(nonRational); }
+        constexpr inline bool operator<(const NonRationalType &nonRational) const { return *this < Rational<IntType, NormalizationPolicy, ErrorPolicy>(nonRational); }
 
         /**
          * @brief < Comparison between a non-rational and a rational. Example: int < Rational
@@ -418,9 +511,9 @@ namespace Arkulib {
         template<typename NonRationalType>
         constexpr inline friend bool operator<(
                 const NonRationalType nonRational,
-                const Rational<IntType> &rational
+                const Rational<IntType, NormalizationPolicy, ErrorPolicy> &rational
         ) {
-            return Rational<IntType>(nonRational) < rational;
+            return Rational<IntType, NormalizationPolicy, ErrorPolicy>(nonRational) < rational;
         }
 
         /************************************************************************************************************
@@ -432,8 +525,11 @@ namespace Arkulib {
          * @param anotherRational
          * @return True if the first rational is inferior to the second
          */
-        constexpr inline bool operator<=(const Rational<IntType> &anotherRational) const {
-            return toRealNumber() <= anotherRational.toRealNumber();
+        constexpr inline bool operator<=(const Rational<IntType, NormalizationPolicy, ErrorPolicy> &anotherRational) const noexcept {
+            return Tools::compareFractions(
+                    getNumerator(), getDenominator(),
+                    anotherRational.getNumerator(), anotherRational.getDenominator()
+            ) <= 0;
         }
 
         /**
@@ -444,7 +540,7 @@ namespace Arkulib {
          */
         template<typename NonRationalType>
         constexpr inline bool operator<=(const NonRationalType &nonRational) const {
-            return *this <= Rational<IntType>(nonRational);
+            return *this <= Rational<IntType, NormalizationPolicy, ErrorPolicy>(nonRational);
         }
 
         /**
@@ -457,9 +553,9 @@ namespace Arkulib {
         template<typename NonRationalType>
         constexpr inline friend bool operator<=(
                 const NonRationalType nonRational,
-                const Rational<IntType> &rational
+                const Rational<IntType, NormalizationPolicy, ErrorPolicy> &rational
         ) {
-            return Rational<IntType>(nonRational) <= rational;
+            return Rational<IntType, NormalizationPolicy, ErrorPolicy>(nonRational) <= rational;
         }
 
         /************************************************************************************************************
@@ -471,8 +567,11 @@ namespace Arkulib {
          * @param anotherRational
          * @return True if the first rational is inferior to the second
          */
-        constexpr inline bool operator>(const Rational<IntType> &anotherRational) const {
-            return toRealNumber() > anotherRational.toRealNumber();
+        constexpr inline bool operator>(const Rational<IntType, NormalizationPolicy, ErrorPolicy> &anotherRational) const noexcept {
+            return Tools::compareFractions(
+                    getNumerator(), getDenominator(),
+                    anotherRational.getNumerator(), anotherRational.getDenominator()
+            ) > 0;
         }
 
         /**
@@ -483,7 +582,7 @@ namespace Arkulib {
          */
         template<typename NonRationalType>
         constexpr inline bool operator>(const NonRationalType &nonRational) const {
-            return *this > Rational<IntType>(nonRational);
+            return *this > Rational<IntType, NormalizationPolicy, ErrorPolicy>(nonRational);
         }
 
         /**
@@ -496,9 +595,9 @@ namespace Arkulib {
         template<typename NonRationalType>
         constexpr inline friend bool operator>(
                 const NonRationalType nonRational,
-                const Rational<IntType> &rational
+                const Rational<IntType, NormalizationPolicy, ErrorPolicy> &rational
         ) {
-            return Rational<IntType>(nonRational) > rational;
+            return Rational<IntType, NormalizationPolicy, ErrorPolicy>(nonRational) > rational;
         }
 
         /************************************************************************************************************
@@ -510,8 +609,11 @@ namespace Arkulib {
          * @param anotherRational
          * @return True if the first rational is inferior to the second
          */
-        constexpr inline bool operator>=(const Rational<IntType> &anotherRational) const {
-            return toRealNumber() >= anotherRational.toRealNumber();
+        constexpr inline bool operator>=(const Rational<IntType, NormalizationPolicy, ErrorPolicy> &anotherRational) const noexcept {
+            return Tools::compareFractions(
+                    getNumerator(), getDenominator(),
+                    anotherRational.getNumerator(), anotherRational.getDenominator()
+            ) >= 0;
         }
 
         /**
@@ -522,7 +624,7 @@ namespace Arkulib {
          */
         template<typename NonRationalType>
         constexpr inline bool operator>=(const NonRationalType &nonRational) const {
-            return *this >= Rational<IntType>(nonRational);
+            return *this >= Rational<IntType, NormalizationPolicy, ErrorPolicy>(nonRational);
         }
 
         /**
@@ -535,11 +637,45 @@ namespace Arkulib {
         template<typename NonRationalType>
         constexpr inline friend bool operator>=(
                 const NonRationalType nonRational,
-                const Rational<IntType> &rational
+                const Rational<IntType, NormalizationPolicy, ErrorPolicy> &rational
         ) {
-            return Rational<IntType>(nonRational) >= rational;
+            return Rational<IntType, NormalizationPolicy, ErrorPolicy>(nonRational) >= rational;
+        }
+
+#if defined(__cpp_impl_three_way_comparison) && defined(__cpp_lib_three_way_comparison)
+        /************************************************************************************************************
+         ********************************************** OPERATOR <=> ************************************************
+         ************************************************************************************************************/
+
+        /**
+         * @brief Ordering type: strong when the representation is unique (Canonical), weak otherwise (2/4 ~ 1/2)
+         */
+        using OrderingType = std::conditional_t<NormalizationPolicy::isAlwaysReduced, std::strong_ordering, std::weak_ordering>;
+
+        /**
+         * @brief Three-way comparison between 2 rationals (one exact comparison for sort and partition)
+         * @param anotherRational
+         * @return The ordering of the first rational relative to the second
+         */
+        constexpr inline OrderingType operator<=>(const Rational<IntType, NormalizationPolicy, ErrorPolicy> &anotherRational) const noexcept {
+            return Tools::compareFractions(
+                    getNumerator(), getDenominator(),
+                    anotherRational.getNumerator(), anotherRational.getDenominator()
+            ) <=> 0;
+        }
+
+        /**
+         * @brief Three-way comparison between a rational and a non-rational. Example: Rational <=> int
+         * @tparam NonRationalType
+         * @param nonRational
+         * @return The ordering of the rational relative to the second operand
+         */
+        template<typename NonRationalType>
+        constexpr inline OrderingType operator<=>(const NonRationalType &nonRational) const {
+            return *this <=> Rational<IntType, NormalizationPolicy, ErrorPolicy>(nonRational);
         }
 
+#endif
         /************************************************************************************************************
          *********************************************** OPERATOR += ************************************************
          ************************************************************************************************************/
@@ -549,7 +685,7 @@ namespace Arkulib {
          * @param anotherRational
          * @return The sum assignment in Rational
          */
-        constexpr Rational<IntType> operator+=(const Rational<IntType> &anotherRational) {
+        constexpr Rational<IntType, NormalizationPolicy, ErrorPolicy> operator+=(const Rational<IntType, NormalizationPolicy, ErrorPolicy> &anotherRational) noexcept(ErrorPolicy::isNoexcept) {
             *this = *this + anotherRational;
             return *this;
         }
@@ -561,8 +697,8 @@ namespace Arkulib {
          * @return The sum assigment in Rational
          */
         template<typename NonRationalType>
-        constexpr inline Rational<IntType> operator+=(const NonRationalType &nonRational) {
-            *this = *this + Rational<IntType>(nonRational);
+        constexpr inline Rational<IntType, NormalizationPolicy, ErrorPolicy> operator+=(const NonRationalType &nonRational) {
+            *this = *this + Rational<IntType, NormalizationPolicy, ErrorPolicy>(nonRational);
             return *this;
         }
 
@@ -584,7 +720,7 @@ namespace Arkulib {
          * @param anotherRational
          * @return The subtraction in Rational
          */
-        constexpr Rational<IntType> operator-=(const Rational<IntType> &anotherRational) {
+        constexpr Rational<IntType, NormalizationPolicy, ErrorPolicy> operator-=(const Rational<IntType, NormalizationPolicy, ErrorPolicy> &anotherRational) noexcept(ErrorPolicy::isNoexcept) {
             *this = *this - anotherRational;
             return *this;
         }
@@ -596,8 +732,8 @@ namespace Arkulib {
          * @return The subtraction assigment in Rational
          */
         template<typename NonRationalType>
-        constexpr inline Rational<IntType> operator-=(const NonRationalType &nonRational) {
-            *this = *this - Rational<IntType>(nonRational);
+        constexpr inline Rational<IntType, NormalizationPolicy, ErrorPolicy> operator-=(const NonRationalType &nonRational) {
+            *this = *this - Rational<IntType, NormalizationPolicy, ErrorPolicy>(nonRational);
             return *this;
         }
 
@@ -619,7 +755,7 @@ namespace Arkulib {
          * @param anotherRational
          * @return The multiplication in Rational
          */
-        constexpr inline Rational<IntType> operator*=(const Rational<IntType> &anotherRational) {
+        constexpr inline Rational<IntType, NormalizationPolicy, ErrorPolicy> operator*=(const Rational<IntType, NormalizationPolicy, ErrorPolicy> &anotherRational) noexcept(ErrorPolicy::isNoexcept) {
             *this = *this * anotherRational;
             return *this;
         }
@@ -631,8 +767,8 @@ namespace Arkulib {
          * @return The multiplication assigment in Rational
          */
         template<typename NonRationalType>
-        constexpr inline Rational<IntType> operator*=(const NonRationalType &nonRational) {
-            *this = *this * Rational<IntType>(nonRational);
+        constexpr inline Rational<IntType, NormalizationPolicy, ErrorPolicy> operator*=(const NonRationalType &nonRational) {
+            *this = *this * Rational<IntType, NormalizationPolicy, ErrorPolicy>(nonRational);
             return *this;
         }
 
@@ -645,7 +781,7 @@ namespace Arkulib {
          * @param anotherRational
          * @return The division in Rational
          */
-        constexpr inline Rational<IntType> operator/=(const Rational<IntType> &anotherRational) {
+        constexpr inline Rational<IntType, NormalizationPolicy, ErrorPolicy> operator/=(const Rational<IntType, NormalizationPolicy, ErrorPolicy> &anotherRational) noexcept(ErrorPolicy::isNoexcept) {
             *this = *this / anotherRational;
             return *this;
         }
@@ -657,8 +793,8 @@ namespace Arkulib {
          * @return The multiplication assigment in Rational
          */
         template<typename NonRationalType>
-        constexpr inline Rational<IntType> operator/=(const NonRationalType &nonRational) {
-            *this = *this / Rational<IntType>(nonRational);
+        constexpr inline Rational<IntType, NormalizationPolicy, ErrorPolicy> operator/=(const NonRationalType &nonRational) {
+            *this = *this / Rational<IntType, NormalizationPolicy, ErrorPolicy>(nonRational);
             return *this;
         }
 
@@ -671,27 +807,42 @@ namespace Arkulib {
          * @brief Inverse a rational : a / b into b / a
          * @return The inverted Rational
          */
-        [[maybe_unused]] [[nodiscard]] constexpr inline Rational<IntType> inverse() const {
-            return Rational<IntType>(getDenominator(), getNumerator());
+        [[maybe_unused]] [[nodiscard]] constexpr inline Rational<IntType, NormalizationPolicy, ErrorPolicy> inverse() const {
+            return Rational<IntType, NormalizationPolicy, ErrorPolicy>(getDenominator(), getNumerator());
         }
 
         /**
-        * @brief Give the square root of a rational
+        * @brief Give the square root of a rational. It's exact when the reduced numerator and denominator are perfect
+        * squares. Else it's floor(scale * sqrt) / scale for the largest scale that IntType can hold, then brought to a
+        * denominator <= sqrt(max of IntType) so that the product of two roots doesn't overflow. The error of a result
+        * p / q is then only below 1 / (q * sqrt(max of IntType)) (plus 1 / scale): down to about 1e-5 for int near a
+        * fraction with a small denominator. Use sqrt(maxError) for a guaranteed error.
+        * @return The square root as a Rational
+        */
+        [[maybe_unused]] [[nodiscard]] constexpr Rational<IntType, NormalizationPolicy, ErrorPolicy> sqrt() const noexcept(ErrorPolicy::isNoexcept);
+
+        /**
+        * @brief Give the square root of a rational with an error below maxError. It's exact when the reduced numerator
+        * and denominator are perfect squares, else floor(scale * sqrt) / scale with scale = ceil(1 / maxError):
+        * a single integer square root (Newton's iteration) of scale^2 * numerator / denominator.
+        * @param maxError Must be positive. NumberTooLarge is raised if scale^2 * numerator overflows the wide type.
         * @return The square root as a Rational
         */
-        [[maybe_unused]] [[nodiscard]] constexpr Rational<IntType> sqrt() const;
+        [[maybe_unused]] [[nodiscard]] constexpr Rational<IntType, NormalizationPolicy, ErrorPolicy> sqrt(
+                const Rational<IntType, NormalizationPolicy, ErrorPolicy> &maxError
+        ) const noexcept(ErrorPolicy::isNoexcept);
 
         /**
         * @brief Give the cosine of a rational
         * @return The cosine as a Rational
         */
-        [[maybe_unused]] [[nodiscard]] constexpr Rational<IntType> cos() const;
+        [[maybe_unused]] [[nodiscard]] constexpr Rational<IntType, NormalizationPolicy, ErrorPolicy> cos() const;
 
         /**
         * @brief Give the exponential of a rational
         * @return The exponential as a Rational
         */
-        [[maybe_unused]] [[nodiscard]] constexpr Rational<IntType> exp() const;
+        [[maybe_unused]] [[nodiscard]] constexpr Rational<IntType, NormalizationPolicy, ErrorPolicy> exp() const;
 
         /**
         * @brief Give the power of a rational
@@ -699,20 +850,27 @@ namespace Arkulib {
         */
 
         template<typename FloatingType>
-        [[maybe_unused]] [[nodiscard]] constexpr Rational<IntType> pow(const FloatingType &k) const;
+        [[maybe_unused]] [[nodiscard]] constexpr Rational<IntType, NormalizationPolicy, ErrorPolicy> pow(const FloatingType &k) const;
 
         /**
          * @brief Give the abs of a rational
          * @return The Rational in absolute value
          */
-        [[maybe_unused]] [[nodiscard]] constexpr inline Rational<IntType> abs() const {
-            return Rational<IntType>(std::abs(getNumerator()), std::abs(getDenominator()));
+        [[maybe_unused]] [[nodiscard]] constexpr inline Rational<IntType, NormalizationPolicy, ErrorPolicy> abs() const {
+            return getNumerator() < IntType(0) ? -*this : *this;
         };
 
         /**
          * @brief Simplify the Rational with GCD (called in constructor)
+         * @return A reduced copy of the rational
          */
-        [[maybe_unused]] [[nodiscard]] constexpr Rational<IntType> simplify() const noexcept;
+        [[maybe_unused]] [[nodiscard]] constexpr Rational<IntType, NormalizationPolicy, ErrorPolicy> simplify() const noexcept;
+
+        /**
+         * @brief Reduce the rational in place. Only useful with the Lazy policy.
+         * @return The reduced rational
+         */
+        constexpr Rational<IntType, NormalizationPolicy, ErrorPolicy> &normalize() noexcept;
 
         /************************************************************************************************************
          ************************************************* MINIMUM **************************************************
@@ -724,9 +882,9 @@ namespace Arkulib {
          * @param rational2
          * @return
          */
-        [[maybe_unused]] [[nodiscard]] constexpr static Rational<IntType> min(
-            Rational<IntType> rational1,
-            Rational<IntType> rational2
+        [[maybe_unused]] [[nodiscard]] constexpr static Rational<IntType, NormalizationPolicy, ErrorPolicy> min(
+            Rational<IntType, NormalizationPolicy, ErrorPolicy> rational1,
+            Rational<IntType, NormalizationPolicy, ErrorPolicy> rational2
         ) noexcept;
 
         /**
@@ -737,8 +895,8 @@ namespace Arkulib {
          * @return
          */
         template<typename ...Args>
-        [[maybe_unused]] [[nodiscard]] constexpr static Rational<IntType> min(
-            Rational<IntType> rational,
+        [[maybe_unused]] [[nodiscard]] constexpr static Rational<IntType, NormalizationPolicy, ErrorPolicy> min(
+            Rational<IntType, NormalizationPolicy, ErrorPolicy> rational,
             Args... args
         ) noexcept;
 
@@ -752,9 +910,9 @@ namespace Arkulib {
          * @param rational2
          * @return
          */
-        [[maybe_unused]] [[nodiscard]] constexpr static Rational<IntType> max(
-                Rational<IntType> rational1,
-                Rational<IntType> rational2
+        [[maybe_unused]] [[nodiscard]] constexpr static Rational<IntType, NormalizationPolicy, ErrorPolicy> max(
+                Rational<IntType, NormalizationPolicy, ErrorPolicy> rational1,
+                Rational<IntType, NormalizationPolicy, ErrorPolicy> rational2
         ) noexcept;
 
         /**
@@ -765,8 +923,8 @@ namespace Arkulib {
          * @return
          */
         template<typename ...Args>
-        [[maybe_unused]] [[nodiscard]] constexpr static Rational<IntType> max(
-                Rational<IntType> rational,
+        [[maybe_unused]] [[nodiscard]] constexpr static Rational<IntType, NormalizationPolicy, ErrorPolicy> max(
+                Rational<IntType, NormalizationPolicy, ErrorPolicy> rational,
                 Args... args
         ) noexcept;
 
@@ -778,25 +936,25 @@ namespace Arkulib {
          * @brief Return zero in Rational Type
          * @return Rational with 0 as numerator and 1 as denominator
          */
-        inline constexpr static Rational<IntType> Zero() noexcept { return Rational<IntType>(0, 1); }
+        inline constexpr static Rational<IntType, NormalizationPolicy, ErrorPolicy> Zero() noexcept { return Rational<IntType, NormalizationPolicy, ErrorPolicy>(0, 1); }
 
         /**
          * @brief Return one in Rational Type
          * @return Rational with 1 as numerator and 1 as denominator
          */
-        inline constexpr static Rational<IntType> One() noexcept { return Rational<IntType>(1, 1); }
+        inline constexpr static Rational<IntType, NormalizationPolicy, ErrorPolicy> One() noexcept { return Rational<IntType, NormalizationPolicy, ErrorPolicy>(1, 1); }
 
         /**
          * @brief Return Pi in Rational Type
          * @return An approximation of Pi
          */
-        inline constexpr static Rational<IntType> Pi() noexcept { return Rational<IntType>(355, 113, false); }
+        inline constexpr static Rational<IntType, NormalizationPolicy, ErrorPolicy> Pi() noexcept { return Rational<IntType, NormalizationPolicy, ErrorPolicy>(355, 113, false); }
 
         /**
          * @brief Return an approximation of +infinite in Rational Type
          * @return 1 as numerator and 0 as denominator
          */
-        [[maybe_unused]] inline constexpr static Rational<IntType> Infinite() noexcept { return Rational<IntType>(1, 0, false, false); }
+        [[maybe_unused]] inline constexpr static Rational<IntType, NormalizationPolicy, ErrorPolicy> Infinite() noexcept { return Rational<IntType, NormalizationPolicy, ErrorPolicy>(1, 0, false, false); }
 
         /************************************************************************************************************
          *********************************************** CONVERSION *************************************************
@@ -807,7 +965,7 @@ namespace Arkulib {
          * @param digitsKept
          * @return The approximated Ratio
          */
-        [[nodiscard]] inline constexpr Rational<IntType> toApproximation(
+        [[nodiscard]] inline constexpr Rational<IntType, NormalizationPolicy, ErrorPolicy> toApproximation(
                 unsigned int digitsKept = Constant::DEFAULT_KEPT_DIGITS_APPROXIMATE
         ) const;
 
@@ -828,7 +986,7 @@ namespace Arkulib {
         template<typename FloatingType = float>
         [[nodiscard]] inline constexpr FloatingType toRealNumber() const noexcept {
             assert(getDenominator() != 0 && "This denominator shouldn't never be equal to 0");
-            return getNumerator() / FloatingType(getDenominator());
+            return FloatingType(getNumerator()) / FloatingType(getDenominator());
         }
 
         /**
@@ -836,9 +994,45 @@ namespace Arkulib {
          * @return std::string
          */
         [[nodiscard]] inline std::string toString() const noexcept {
-            return "(" + std::to_string(getNumerator()) + " / " + std::to_string(getDenominator()) + ")";
+            const Rational<IntType, NormalizationPolicy, ErrorPolicy> reduced = NormalizationPolicy::isAlwaysReduced ? *this : simplify();
+            if constexpr (Tools::isBuiltinInteger<IntType>) {
+                // Formatted on the stack, the string is the only allocation
+                constexpr std::size_t DIGITS = Tools::maxDecimalChars<IntType>;
+                char buffer[2 * DIGITS + 5] = "(";
+                char *end = Tools::integerToChars(buffer + 1, buffer + 1 + DIGITS, reduced.getNumerator()).ptr;
+                std::memcpy(end, " / ", 3);
+                end = Tools::integerToChars(end + 3, end + 3 + DIGITS, reduced.getDenominator()).ptr;
+                *end++ = ')';
+                return std::string(buffer, end);
+            }
+            else {
+                using std::to_string;
+                return "(" + to_string(reduced.getNumerator()) + " / " + to_string(reduced.getDenominator()) + ")";
+            }
         }
 
+        /**
+         * @brief Write the reduced rational as "numerator/denominator" in [first, last), the format of the logs and of
+         * the bulk writers (RationalIO.hpp). Nothing is allocated for the builtin integer types.
+         * @param first
+         * @param last
+         * @return Same as std::to_chars: {end of the written characters, errc()} or {last, errc::value_too_large}
+         */
+        std::to_chars_result toChars(char *first, char *last) const noexcept(Tools::isBuiltinInteger<IntType>);
+
+        /**
+         * @brief Read a rational written "n/d", "(n / d)" (as toString), "n" or as an exact decimal number "3.125"
+         * from [first, last). Nothing is allocated for the builtin integer types.
+         * @param first
+         * @param last
+         * @param value Receives the rational, unchanged on failure
+         * @return Same as std::from_chars: errc::invalid_argument if nothing matches or if the denominator is zero,
+         * errc::result_out_of_range if the number doesn't fit in IntType
+         */
+        static std::from_chars_result fromChars(
+                const char *first, const char *last, Rational<IntType, NormalizationPolicy, ErrorPolicy> &value
+        ) noexcept(Tools::isBuiltinInteger<IntType>);
+
         /**
          * @brief A method who automatically set numerator and denominator to approach the float parameter
          * @tparam FloatingType
@@ -847,18 +1041,57 @@ namespace Arkulib {
          * @return The rational wanted
          */
         template<typename FloatingType = double>
-        [[nodiscard]] static constexpr Rational<IntType> fromFloatingPoint(
+        [[nodiscard]] static constexpr Rational<IntType, NormalizationPolicy, ErrorPolicy> fromFloatingPoint(
                 FloatingType floatingRatio,
                 size_t iter = Constant::DEFAULT_ITERATIONS_FROM_FP
         );
 
+        /**
+         * @brief Give the rational exactly equal to a floating number: mantissa / 2^-exponent, read from its bits
+         * in constant time. 0.1 gives 3602879701896397 / 36028797018963968. NumberTooLarge is raised if IntType
+         * can't hold it (or if the number is infinite or NaN).
+         * @tparam FloatingType
+         * @param floatingRatio
+         * @return The rational wanted (already reduced)
+         */
+        template<typename FloatingType = double>
+        [[nodiscard]] static constexpr Rational<IntType, NormalizationPolicy, ErrorPolicy> fromFloatingPointExact(
+                FloatingType floatingRatio
+        ) noexcept(ErrorPolicy::isNoexcept);
+
+        /**
+         * @brief Give the fraction closest to a floating number among those with a denominator <= maxDenominator.
+         * The floating number is taken exactly (fromFloatingPointExact), then its convergents and semiconvergents
+         * are walked: the result is provably the closest (the smaller denominator wins a tie).
+         * Example: bestApproximation(M_PI, 1000) gives 355 / 113.
+         * @tparam FloatingType
+         * @param floatingRatio
+         * @param maxDenominator Must be positive
+         * @return The closest rational (already reduced)
+         */
+        template<typename FloatingType = double>
+        [[nodiscard]] static constexpr Rational<IntType, NormalizationPolicy, ErrorPolicy> bestApproximation(
+                FloatingType floatingRatio,
+                IntType maxDenominator
+        ) noexcept(ErrorPolicy::isNoexcept);
+
+        /**
+         * @brief Give the rational closest to this one among those with a denominator <= maxDenominator
+         * (same algorithm as bestApproximation)
+         * @param maxDenominator Must be positive
+         * @return The closest rational (already reduced)
+         */
+        [[nodiscard]] constexpr Rational<IntType, NormalizationPolicy, ErrorPolicy> limitDenominator(
+                IntType maxDenominator
+        ) const noexcept(ErrorPolicy::isNoexcept);
+
         /**
          * @brief Print the value of a rational.
          * @tparam IntType
          * @param rational
          */
-        [[maybe_unused]] inline constexpr void static print(const Rational<IntType> rational) noexcept {
-            std::cout << rational.toString() << std::endl << std::endl;
+        [[maybe_unused]] inline constexpr void static print(const Rational<IntType, NormalizationPolicy, ErrorPolicy> rational) noexcept {
+            std::cout << rational.toString() << "\n\n";
         }
 
         /**
@@ -869,8 +1102,8 @@ namespace Arkulib {
          * @param args
          */
         template<typename... Args>
-        [[maybe_unused]] inline constexpr void static print(const Rational<IntType> rational, Args... args) noexcept {
-            std::cout << rational.toString() << std::endl;
+        [[maybe_unused]] inline constexpr void static print(const Rational<IntType, NormalizationPolicy, ErrorPolicy> rational, Args... args) noexcept {
+            std::cout << rational.toString() << '\n';
             print(args...);
         }
 
@@ -880,49 +1113,110 @@ namespace Arkulib {
          ********************************************* MEMBERS ******************************************************
          ************************************************************************************************************/
 
-        IntType m_numerator; /*!< Rational's numerator */
+        IntType m_numerator{}; /*!< Rational's numerator */
 
-        IntType m_denominator; /*!< Rational's denominator */
+        IntType m_denominator{1}; /*!< Rational's denominator */
 
         /************************************************************************************************************
          ********************************************* METHODS ******************************************************
          ************************************************************************************************************/
 
         /**
-         * @brief Verify if the template is correct. Throw an exception if the template is a floating point.
-         */
-        constexpr inline void verifyTemplateType() const {
-            if (!std::is_integral<IntType>()) throw Exceptions::FloatTypeGivenException();
-        };
-
-        /**
-         * @brief Verify if the denominator is null or negative
+         * @brief Verify if the denominator is null or negative. A negative denominator gives its sign to the numerator,
+         * NumberTooLarge is raised if the minimum of IntType must be negated and the reduced fraction doesn't fit.
          * @param denominator
          * @param checkIfDenominatorIsNull
          */
-        constexpr void verifyDenominator(IntType denominator, bool checkIfDenominatorIsNull = true);
+        constexpr void verifyDenominator(IntType denominator, bool checkIfDenominatorIsNull = true) noexcept(ErrorPolicy::isNoexcept);
 
         /**
          * @brief Verify if the operands are superior to the limit of IntType
          * @tparam AnotherIntType
+         * @tparam AnotherPolicy
+         * @tparam AnotherErrorPolicy
          * @param anotherRational
+         * @return True if the operands fit in IntType
+         */
+        template<typename AnotherIntType, typename AnotherPolicy, typename AnotherErrorPolicy>
+        constexpr bool verifyNumberLargeness(Rational<AnotherIntType, AnotherPolicy, AnotherErrorPolicy> &anotherRational) const noexcept(ErrorPolicy::isNoexcept);
+
+        /**
+         * @brief The integer type used when an operation overflows IntType (__int128 for 64-bit types)
          */
-        template<typename AnotherIntType>
-        constexpr void verifyNumberLargeness(Rational<AnotherIntType> &anotherRational) const;
+        using WideType = Tools::WiderIntegerType<IntType>;
 
         /**
-         * @brief Check for overflow before returning a value
+         * @brief Check for overflow before returning a value. The operands are reduced in the wide type then narrowed.
          * @param numerator
          * @param denominator
-         * @return The rational if there is no error. If these is an overflow error, it'll throw an exception
+         * @return The rational if there is no error. An overflow is reported through the ErrorPolicy
          */
-        constexpr inline static Rational<IntType> checkForOverflowThenReturn(
-                const long long int numerator,
-                const long long int denominator
-        ) {
-            Rational<long long int> errorChecker(numerator, denominator);
-            return Rational<IntType>(errorChecker);
-            // During the copy constructor, the method verifyLargeness will be executed.
+        constexpr static Rational<IntType, NormalizationPolicy, ErrorPolicy> checkForOverflowThenReturn(WideType numerator, WideType denominator) noexcept(ErrorPolicy::isNoexcept);
+
+        /**
+         * @brief Closest rational to numerator / denominator that fits in IntType (used by Policies::Approximate).
+         * The absolute error is recorded in the statistics of the ErrorPolicy.
+         * @param numerator
+         * @param denominator Must be positive
+         * @return The approximation, reduced
+         */
+        constexpr static Rational<IntType, NormalizationPolicy, ErrorPolicy> approximateOverflow(WideType numerator, WideType denominator) noexcept;
+
+        /**
+         * @brief Closest rational to +-(numerator / denominator) with a denominator <= denominatorBound that fits in IntType
+         * @tparam UnsignedType Wide enough to hold 2 * (floor(numerator / denominator) + 1) * denominatorBound^2
+         * @param isNegative
+         * @param numerator
+         * @param denominator Must not be 0
+         * @param denominatorBound Must not be 0
+         * @return The rational (already reduced)
+         */
+        template<typename UnsignedType>
+        constexpr static Rational<IntType, NormalizationPolicy, ErrorPolicy> closestWithBoundedDenominator(
+                bool isNegative,
+                UnsignedType numerator,
+                UnsignedType denominator,
+                UnsignedType denominatorBound
+        ) noexcept;
+
+        /**
+         * @brief floor(scale * sqrt(numerator / denominator)) / scale, from the integer square root of
+         * scale^2 * numerator / denominator
+         * @param numerator Must be positive
+         * @param denominator Must be positive
+         * @param scale Must be positive
+         * @return The root. NumberTooLarge is raised if scale^2 * numerator doesn't fit in WideType
+         */
+        constexpr static Rational<IntType, NormalizationPolicy, ErrorPolicy> scaledSqrt(
+                const WideType &numerator,
+                const WideType &denominator,
+                const WideType &scale
+        ) noexcept(ErrorPolicy::isNoexcept);
+
+        /**
+         * @brief Report an error through the ErrorPolicy
+         * @param error
+         * @return Zero, the result of the failed operation when the ErrorPolicy doesn't throw
+         */
+        constexpr inline static Rational<IntType, NormalizationPolicy, ErrorPolicy> raiseError(const ArkulibError error) noexcept(ErrorPolicy::isNoexcept) {
+            ErrorPolicy::raise(error);
+            return fromReducedOperands(0, 1);
+        }
+
+        /**
+         * @brief Build a rational from operands that are already reduced with a positive denominator (no gcd)
+         * @param numerator
+         * @param denominator
+         * @return The rational
+         */
+        constexpr inline static Rational<IntType, NormalizationPolicy, ErrorPolicy> fromReducedOperands(
+                const IntType numerator,
+                const IntType denominator
+        ) noexcept {
+            Rational<IntType, NormalizationPolicy, ErrorPolicy> rational;
+            rational.m_numerator = numerator;
+            rational.m_denominator = denominator;
+            return rational;
         }
     };
 
@@ -938,179 +1232,332 @@ namespace Arkulib {
      ********************************************* CONSTRUCTOR DEF **********************************************
      ************************************************************************************************************/
 
-    template<typename IntType>
-    constexpr Rational<IntType>::Rational(
+    template<typename IntType, typename NormalizationPolicy, typename ErrorPolicy>
+    constexpr Rational<IntType, NormalizationPolicy, ErrorPolicy>::Rational(
             const IntType numerator,
             const IntType denominator,
             const bool willBeReduce,
             const bool willDenominatorBeVerified
-    ) : m_numerator(numerator), m_denominator(denominator) {
-        verifyTemplateType();
+    ) noexcept(ErrorPolicy::isNoexcept) : m_numerator(numerator), m_denominator(denominator) {
         verifyDenominator(denominator, willDenominatorBeVerified);
 
-        if (willBeReduce) *this = simplify();
+        if (NormalizationPolicy::isAlwaysReduced || willBeReduce) normalize();
     }
 
     /************************************************************************************************************/
 
-    template<typename IntType>
-    template<typename FloatingType>
-    constexpr Rational<IntType>::Rational(const FloatingType &nonRational) {
-        verifyTemplateType();
-
-        if (std::is_integral<FloatingType>()) {
-            *this = Rational<IntType>(nonRational, 1);
+    template<typename IntType, typename NormalizationPolicy, typename ErrorPolicy>
+    template<typename FloatingType, std::enable_if_t<Tools::isRealNumber<FloatingType>, int>>
+    constexpr Rational<IntType, NormalizationPolicy, ErrorPolicy>::Rational(const FloatingType &nonRational) {
+        if constexpr (Tools::IntegerTraits<FloatingType>::isInteger) {
+            *this = Rational<IntType, NormalizationPolicy, ErrorPolicy>(nonRational, 1);
         }
 
         else {
-            Rational<long long int> tmpRational = Rational<long long int>::fromFloatingPoint(nonRational);
+            Rational<long long int, Policies::Canonical, ErrorPolicy> tmpRational =
+                    Rational<long long int, Policies::Canonical, ErrorPolicy>::fromFloatingPoint(nonRational);
 
-            if (tmpRational.isZero() && Tools::roundToWantedPrecision(nonRational) != static_cast<FloatingType>(0)) {
+            if (tmpRational.isZero() && !Tools::isRoundedToZero(nonRational)) {
                 // Because Very large number return 0
-                throw Exceptions::NumberTooLargeException();
+                *this = raiseError(ArkulibError::NumberTooLarge);
+                return;
             }
 
-            *this = Rational<IntType>(tmpRational);
+            *this = Rational<IntType, NormalizationPolicy, ErrorPolicy>(tmpRational);
         }
     }
 
     /************************************************************************************************************/
 
-    template<typename IntType>
-    template<typename AnotherIntType>
-    constexpr Rational<IntType>::Rational(Rational<AnotherIntType> &copiedRational)
+    template<typename IntType, typename NormalizationPolicy, typename ErrorPolicy>
+    template<typename AnotherIntType, typename AnotherPolicy, typename AnotherErrorPolicy>
+    constexpr Rational<IntType, NormalizationPolicy, ErrorPolicy>::Rational(Rational<AnotherIntType, AnotherPolicy, AnotherErrorPolicy> &copiedRational)
             : m_numerator(copiedRational.getNumerator()), m_denominator(copiedRational.getDenominator()){
-        verifyNumberLargeness(copiedRational);
+        if (!verifyNumberLargeness(copiedRational)) {
+            m_numerator = 0;
+            m_denominator = 1;
+            return;
+        }
+
+        if constexpr (NormalizationPolicy::isAlwaysReduced && !AnotherPolicy::isAlwaysReduced) normalize();
     }
 
     /************************************************************************************************************
      ********************************************* OPERATORS[] DEF **********************************************
      ************************************************************************************************************/
 
-    template<typename IntType>
-    const IntType &Rational<IntType>::operator[](const size_t &id) const {
-        if (id == 0) return getNumerator();
-        else if (id == 1) return getDenominator();
-        else throw Exceptions::InvalidAccessArgument();
+    template<typename IntType, typename NormalizationPolicy, typename ErrorPolicy>
+    const IntType &Rational<IntType, NormalizationPolicy, ErrorPolicy>::operator[](const size_t &id) const {
+        if (id == 1) return m_denominator;
+        if (id != 0) ErrorPolicy::raise(ArkulibError::InvalidAccessArgument);
+        return m_numerator;
     }
 
-    template<typename IntType>
-    IntType &Rational<IntType>::operator[](const size_t &id) {
-        if (id == 0) return m_numerator;
-        else if (id == 1) return m_denominator;
-        else throw Exceptions::InvalidAccessArgument();
+    template<typename IntType, typename NormalizationPolicy, typename ErrorPolicy>
+    IntType &Rational<IntType, NormalizationPolicy, ErrorPolicy>::operator[](const size_t &id) {
+        if (id == 1) return m_denominator;
+        if (id != 0) ErrorPolicy::raise(ArkulibError::InvalidAccessArgument);
+        return m_numerator;
     }
 
     /************************************************************************************************************
      ********************************************* OPERATOR + DEF ***********************************************
      ************************************************************************************************************/
 
-    template<typename IntType>
-    constexpr Rational<IntType> Rational<IntType>::operator+(const Rational<IntType> &anotherRational) const {
-        return Rational<IntType>::checkForOverflowThenReturn(
-                static_cast<long long int>(getNumerator()) * anotherRational.getDenominator() + getDenominator() * anotherRational.getNumerator(),
-                static_cast<long long int>(getDenominator()) * anotherRational.getDenominator()
-        );
+    template<typename IntType, typename NormalizationPolicy, typename ErrorPolicy>
+    constexpr Rational<IntType, NormalizationPolicy, ErrorPolicy> Rational<IntType, NormalizationPolicy, ErrorPolicy>::operator+(const Rational<IntType, NormalizationPolicy, ErrorPolicy> &anotherRational) const noexcept(ErrorPolicy::isNoexcept) {
+        IntType numerator{}, denominator{};
+        if constexpr (NormalizationPolicy::isAlwaysReduced) {
+            if (!Tools::reducedAddOverflow(
+                    getNumerator(), getDenominator(),
+                    anotherRational.getNumerator(), anotherRational.getDenominator(),
+                    numerator, denominator)) {
+                return fromReducedOperands(numerator, denominator);
+            }
+        }
+        else if (!Tools::crossAddOverflow(getNumerator(), anotherRational.getDenominator(), getDenominator(), anotherRational.getNumerator(), numerator)
+                && !Tools::multiplyOverflow(getDenominator(), anotherRational.getDenominator(), denominator)) {
+            return Rational<IntType, NormalizationPolicy, ErrorPolicy>(numerator, denominator);
+        }
+
+        // An intermediate overflowed IntType: the operation is done again in the wide type then reduced
+        WideType wideNumerator{}, wideDenominator{};
+        if (Tools::crossAddOverflow<WideType>(getNumerator(), anotherRational.getDenominator(), getDenominator(), anotherRational.getNumerator(), wideNumerator)
+            || Tools::multiplyOverflow<WideType>(getDenominator(), anotherRational.getDenominator(), wideDenominator)) {
+            return raiseError(ArkulibError::NumberTooLarge);
+        }
+        return Rational<IntType, NormalizationPolicy, ErrorPolicy>::checkForOverflowThenReturn(wideNumerator, wideDenominator);
     }
 
     /************************************************************************************************************
      ********************************************* OPERATOR - DEF ***********************************************
      ************************************************************************************************************/
 
-    template<typename IntType>
-    constexpr Rational<IntType> Rational<IntType>::operator-(const Rational<IntType> &anotherRational) const {
-        return Rational<IntType>::checkForOverflowThenReturn(
-                static_cast<long long int>(getNumerator()) * anotherRational.getDenominator() - getDenominator() * anotherRational.getNumerator(),
-                static_cast<long long int>(getDenominator()) * anotherRational.getDenominator()
-        );
+    template<typename IntType, typename NormalizationPolicy, typename ErrorPolicy>
+    constexpr Rational<IntType, NormalizationPolicy, ErrorPolicy> Rational<IntType, NormalizationPolicy, ErrorPolicy>::operator-(const Rational<IntType, NormalizationPolicy, ErrorPolicy> &anotherRational) const noexcept(ErrorPolicy::isNoexcept) {
+        IntType numerator{}, denominator{};
+        if constexpr (NormalizationPolicy::isAlwaysReduced) {
+            if (!Tools::reducedSubtractOverflow(
+                    getNumerator(), getDenominator(),
+                    anotherRational.getNumerator(), anotherRational.getDenominator(),
+                    numerator, denominator)) {
+                return fromReducedOperands(numerator, denominator);
+            }
+        }
+        else if (!Tools::crossSubtractOverflow(getNumerator(), anotherRational.getDenominator(), getDenominator(), anotherRational.getNumerator(), numerator)
+                && !Tools::multiplyOverflow(getDenominator(), anotherRational.getDenominator(), denominator)) {
+            return Rational<IntType, NormalizationPolicy, ErrorPolicy>(numerator, denominator);
+        }
+
+        // An intermediate overflowed IntType: the operation is done again in the wide type then reduced
+        WideType wideNumerator{}, wideDenominator{};
+        if (Tools::crossSubtractOverflow<WideType>(getNumerator(), anotherRational.getDenominator(), getDenominator(), anotherRational.getNumerator(), wideNumerator)
+            || Tools::multiplyOverflow<WideType>(getDenominator(), anotherRational.getDenominator(), wideDenominator)) {
+            return raiseError(ArkulibError::NumberTooLarge);
+        }
+        return Rational<IntType, NormalizationPolicy, ErrorPolicy>::checkForOverflowThenReturn(wideNumerator, wideDenominator);
     }
 
     /************************************************************************************************************
      ********************************************* OPERATOR * DEF ***********************************************
      ************************************************************************************************************/
 
-    template<typename IntType>
-    constexpr Rational<IntType> Rational<IntType>::operator*(const Rational<IntType> &anotherRational) const {
-        return Rational<IntType>::checkForOverflowThenReturn(
-                static_cast<long long int>(getNumerator()) * anotherRational.getNumerator(),
-                static_cast<long long int>(getDenominator()) * anotherRational.getDenominator()
-        );
+    template<typename IntType, typename NormalizationPolicy, typename ErrorPolicy>
+    constexpr Rational<IntType, NormalizationPolicy, ErrorPolicy> Rational<IntType, NormalizationPolicy, ErrorPolicy>::operator*(const Rational<IntType, NormalizationPolicy, ErrorPolicy> &anotherRational) const noexcept(ErrorPolicy::isNoexcept) {
+        IntType numerator{}, denominator{};
+        if constexpr (NormalizationPolicy::isAlwaysReduced) {
+            if (!Tools::reducedMultiplyOverflow(
+                    getNumerator(), getDenominator(),
+                    anotherRational.getNumerator(), anotherRational.getDenominator(),
+                    numerator, denominator)) {
+                return fromReducedOperands(numerator, denominator);
+            }
+        }
+        else if (!Tools::multiplyOverflow(getNumerator(), anotherRational.getNumerator(), numerator)
+                && !Tools::multiplyOverflow(getDenominator(), anotherRational.getDenominator(), denominator)) {
+            return Rational<IntType, NormalizationPolicy, ErrorPolicy>(numerator, denominator);
+        }
+
+        // An intermediate overflowed IntType: the operation is done again in the wide type then reduced
+        WideType wideNumerator{}, wideDenominator{};
+        if (Tools::multiplyOverflow<WideType>(getNumerator(), anotherRational.getNumerator(), wideNumerator)
+            || Tools::multiplyOverflow<WideType>(getDenominator(), anotherRational.getDenominator(), wideDenominator)) {
+            return raiseError(ArkulibError::NumberTooLarge);
+        }
+        return Rational<IntType, NormalizationPolicy, ErrorPolicy>::checkForOverflowThenReturn(wideNumerator, wideDenominator);
     }
 
     /************************************************************************************************************
      ********************************************* OPERATOR / DEF ***********************************************
      ************************************************************************************************************/
 
-    template<typename IntType>
-    constexpr Rational<IntType> Rational<IntType>::operator/(const Rational<IntType> &anotherRational) const {
-        return Rational<IntType>::checkForOverflowThenReturn(
-                static_cast<long long int>(getNumerator()) * anotherRational.getDenominator(),
-                static_cast<long long int>(getDenominator()) * anotherRational.getNumerator()
-        );
+    template<typename IntType, typename NormalizationPolicy, typename ErrorPolicy>
+    constexpr Rational<IntType, NormalizationPolicy, ErrorPolicy> Rational<IntType, NormalizationPolicy, ErrorPolicy>::operator/(const Rational<IntType, NormalizationPolicy, ErrorPolicy> &anotherRational) const noexcept(ErrorPolicy::isNoexcept) {
+        if (anotherRational.isZero()) return raiseError(ArkulibError::DivideByZero);
+
+        IntType numerator{}, denominator{};
+        if constexpr (NormalizationPolicy::isAlwaysReduced) {
+            if (!Tools::reducedDivideOverflow(
+                    getNumerator(), getDenominator(),
+                    anotherRational.getNumerator(), anotherRational.getDenominator(),
+                    numerator, denominator)) {
+                return fromReducedOperands(numerator, denominator);
+            }
+        }
+        else if (!Tools::multiplyOverflow(getNumerator(), anotherRational.getDenominator(), numerator)
+                && !Tools::multiplyOverflow(getDenominator(), anotherRational.getNumerator(), denominator)) {
+            return Rational<IntType, NormalizationPolicy, ErrorPolicy>(numerator, denominator);
+        }
+
+        // An intermediate overflowed IntType: the operation is done again in the wide type then reduced
+        WideType wideNumerator{}, wideDenominator{};
+        if (Tools::multiplyOverflow<WideType>(getNumerator(), anotherRational.getDenominator(), wideNumerator)
+            || Tools::multiplyOverflow<WideType>(getDenominator(), anotherRational.getNumerator(), wideDenominator)) {
+            return raiseError(ArkulibError::NumberTooLarge);
+        }
+        return Rational<IntType, NormalizationPolicy, ErrorPolicy>::checkForOverflowThenReturn(wideNumerator, wideDenominator);
     }
 
     /************************************************************************************************************
      ************************************************ MATHS DEF *************************************************
      ************************************************************************************************************/
 
-    template<typename IntType>
-    constexpr Rational<IntType> Rational<IntType>::sqrt() const {
-        if (isNegative()) throw Exceptions::NegativeSqrtException();
-        return Rational<IntType>(
-                std::sqrt(static_cast<double>(getNumerator()) / getDenominator())
-        );
+    template<typename IntType, typename NormalizationPolicy, typename ErrorPolicy>
+    constexpr Rational<IntType, NormalizationPolicy, ErrorPolicy> Rational<IntType, NormalizationPolicy, ErrorPolicy>::sqrt() const noexcept(ErrorPolicy::isNoexcept) {
+        if (isNegative()) return raiseError(ArkulibError::NegativeSqrt);
+
+        const Rational<IntType, NormalizationPolicy, ErrorPolicy> reduced = NormalizationPolicy::isAlwaysReduced ? *this : simplify();
+        IntType numeratorRoot(0), denominatorRoot(0);
+        if (Tools::isPerfectSquare(reduced.getNumerator(), numeratorRoot) && Tools::isPerfectSquare(reduced.getDenominator(), denominatorRoot))
+            return fromReducedOperands(numeratorRoot, denominatorRoot);
+
+        const WideType numerator(reduced.getNumerator());
+        const WideType denominator(reduced.getDenominator());
+
+        if constexpr (Tools::IntegerTraits<IntType>::isBounded) {
+            const auto maxOf = [](const auto zero) {
+                using UnsignedType = Tools::UnsignedIntegerType<decltype(zero)>;
+                return static_cast<decltype(zero)>(static_cast<UnsignedType>(~UnsignedType(0)) >> 1);
+            };
+            const WideType maxInt(maxOf(IntType(0)));
+
+            // The root < scale * (isqrt(n / d) + 1) fits in IntType and scale^2 * n fits in WideType
+            const WideType rootBound = maxInt / (Tools::isqrt(numerator / denominator) + WideType(1));
+            const WideType squareBound = Tools::isqrt(maxOf(WideType(0)) / numerator);
+            const Rational<IntType, NormalizationPolicy, ErrorPolicy> root = scaledSqrt(
+                    numerator, denominator, rootBound < squareBound ? rootBound : squareBound
+            );
+
+            if constexpr (Tools::WiderInteger<IntType>::isWider) return root.limitDenominator(Tools::isqrt(maxOf(IntType(0))));
+            else return root;
+        }
+        else {
+            return scaledSqrt(numerator, denominator, WideType(Constant::DEFAULT_SQRT_SCALE_UNBOUNDED));
+        }
+    }
+
+    template<typename IntType, typename NormalizationPolicy, typename ErrorPolicy>
+    constexpr Rational<IntType, NormalizationPolicy, ErrorPolicy> Rational<IntType, NormalizationPolicy, ErrorPolicy>::sqrt(
+            const Rational<IntType, NormalizationPolicy, ErrorPolicy> &maxError
+    ) const noexcept(ErrorPolicy::isNoexcept) {
+        if (isNegative()) return raiseError(ArkulibError::NegativeSqrt);
+        if (maxError.getNumerator() <= IntType(0)) return raiseError(ArkulibError::DivideByZero);
+
+        const Rational<IntType, NormalizationPolicy, ErrorPolicy> reduced = NormalizationPolicy::isAlwaysReduced ? *this : simplify();
+        IntType numeratorRoot(0), denominatorRoot(0);
+        if (Tools::isPerfectSquare(reduced.getNumerator(), numeratorRoot) && Tools::isPerfectSquare(reduced.getDenominator(), denominatorRoot))
+            return fromReducedOperands(numeratorRoot, denominatorRoot);
+
+        // ceil(1 / maxError): the error of floor(scale * sqrt) / scale is below 1 / scale
+        const WideType errorNumerator(maxError.getNumerator());
+        const WideType scale = (WideType(maxError.getDenominator()) + errorNumerator - WideType(1)) / errorNumerator;
+        return scaledSqrt(WideType(reduced.getNumerator()), WideType(reduced.getDenominator()), scale);
     }
 
-    template<typename IntType>
-    Rational<IntType> constexpr Rational<IntType>::cos() const {
-        return Rational<IntType>(
-                std::cos(static_cast<double>(getNumerator()) / getDenominator())
+    template<typename IntType, typename NormalizationPolicy, typename ErrorPolicy>
+    Rational<IntType, NormalizationPolicy, ErrorPolicy> constexpr Rational<IntType, NormalizationPolicy, ErrorPolicy>::cos() const {
+        return Rational<IntType, NormalizationPolicy, ErrorPolicy>(
+                std::cos(toRealNumber<double>())
         );
     }
 
-    template<typename IntType>
-    Rational<IntType> constexpr Rational<IntType>::exp() const {
-        return Rational<IntType>(
-                std::exp(static_cast<double>(getNumerator()) / getDenominator())
+    template<typename IntType, typename NormalizationPolicy, typename ErrorPolicy>
+    Rational<IntType, NormalizationPolicy, ErrorPolicy> constexpr Rational<IntType, NormalizationPolicy, ErrorPolicy>::exp() const {
+        return Rational<IntType, NormalizationPolicy, ErrorPolicy>(
+                std::exp(toRealNumber<double>())
         );
     }
 
-    template<typename IntType>
+    template<typename IntType, typename NormalizationPolicy, typename ErrorPolicy>
     template<typename FloatingType>
-    constexpr Rational<IntType> Rational<IntType>::pow(const FloatingType &k) const {
-        return Rational<IntType>(
-                std::pow(static_cast<double>(getNumerator()) / getDenominator(), k)
+    constexpr Rational<IntType, NormalizationPolicy, ErrorPolicy> Rational<IntType, NormalizationPolicy, ErrorPolicy>::pow(const FloatingType &k) const {
+        return Rational<IntType, NormalizationPolicy, ErrorPolicy>(
+                std::pow(toRealNumber<double>(), k)
         );
     }
 
-    template<typename IntType>
-    Rational<IntType> constexpr Rational<IntType>::simplify() const noexcept {
-        const int gcd = std::gcd(getNumerator(), getDenominator());
+    template<typename IntType, typename NormalizationPolicy, typename ErrorPolicy>
+    Rational<IntType, NormalizationPolicy, ErrorPolicy> constexpr Rational<IntType, NormalizationPolicy, ErrorPolicy>::simplify() const noexcept {
+        Rational<IntType, NormalizationPolicy, ErrorPolicy> reduced = *this;
+        return reduced.normalize();
+    }
+
+    template<typename IntType, typename NormalizationPolicy, typename ErrorPolicy>
+    constexpr Rational<IntType, NormalizationPolicy, ErrorPolicy> &Rational<IntType, NormalizationPolicy, ErrorPolicy>::normalize() noexcept {
+        const IntType gcd = Tools::gcd(getNumerator(), getDenominator());
         assert(gcd != 0 && "GCD shouldn't be equal to 0");
 
-        return Rational<IntType>(
-                getNumerator() / gcd,
-                getDenominator() / gcd,
-                false
-        );
+        m_numerator /= gcd;
+        m_denominator /= gcd;
+        return *this;
+    }
+
+    /************************************************************************************************************
+     ********************************************* CHARACTERS DEF ***********************************************
+     ************************************************************************************************************/
+
+    template<typename IntType, typename NormalizationPolicy, typename ErrorPolicy>
+    std::to_chars_result Rational<IntType, NormalizationPolicy, ErrorPolicy>::toChars(
+            char *first,
+            char *last
+    ) const noexcept(Tools::isBuiltinInteger<IntType>) {
+        const Rational<IntType, NormalizationPolicy, ErrorPolicy> reduced = NormalizationPolicy::isAlwaysReduced ? *this : simplify();
+        const std::to_chars_result result = Tools::integerToChars(first, last, reduced.getNumerator());
+        if (result.ec != std::errc()) return result;
+        if (result.ptr == last) return {last, std::errc::value_too_large};
+
+        *result.ptr = '/';
+        return Tools::integerToChars(result.ptr + 1, last, reduced.getDenominator());
+    }
+
+    template<typename IntType, typename NormalizationPolicy, typename ErrorPolicy>
+    std::from_chars_result Rational<IntType, NormalizationPolicy, ErrorPolicy>::fromChars(
+            const char *first,
+            const char *last,
+            Rational<IntType, NormalizationPolicy, ErrorPolicy> &value
+    ) noexcept(Tools::isBuiltinInteger<IntType>) {
+        IntType numerator(0), denominator(1);
+        const std::from_chars_result result = Tools::parseFraction(first, last, numerator, denominator);
+        if (result.ec == std::errc()) value = Rational<IntType, NormalizationPolicy, ErrorPolicy>(numerator, denominator);
+        return result;
     }
 
     /************************************************************************************************************
      ************************************************ MINIMUM DEF ***********************************************
      ************************************************************************************************************/
 
-    template<typename IntType>
-    constexpr Rational<IntType> Rational<IntType>::min(
-            const Rational<IntType> rational1,
-            const Rational<IntType> rational2
+    template<typename IntType, typename NormalizationPolicy, typename ErrorPolicy>
+    constexpr Rational<IntType, NormalizationPolicy, ErrorPolicy> Rational<IntType, NormalizationPolicy, ErrorPolicy>::min(
+            const Rational<IntType, NormalizationPolicy, ErrorPolicy> rational1,
+            const Rational<IntType, NormalizationPolicy, ErrorPolicy> rational2
     ) noexcept {
         return rational1 < rational2 ? rational1 : rational2;
     }
 
-    template<typename IntType>
+    template<typename IntType, typename NormalizationPolicy, typename ErrorPolicy>
     template<typename... Args>
-    constexpr Rational<IntType> Rational<IntType>::min(
-            const Rational<IntType> rational,
+    constexpr Rational<IntType, NormalizationPolicy, ErrorPolicy> Rational<IntType, NormalizationPolicy, ErrorPolicy>::min(
+            const Rational<IntType, NormalizationPolicy, ErrorPolicy> rational,
             Args... args
     ) noexcept {
         return min(rational, min(args...));
@@ -1120,18 +1567,18 @@ namespace Arkulib {
      ************************************************ MAXIMUM DEF ***********************************************
      ************************************************************************************************************/
 
-    template<typename IntType>
-    constexpr Rational<IntType> Rational<IntType>::max(
-            const Rational<IntType> rational1,
-            const Rational<IntType> rational2
+    template<typename IntType, typename NormalizationPolicy, typename ErrorPolicy>
+    constexpr Rational<IntType, NormalizationPolicy, ErrorPolicy> Rational<IntType, NormalizationPolicy, ErrorPolicy>::max(
+            const Rational<IntType, NormalizationPolicy, ErrorPolicy> rational1,
+            const Rational<IntType, NormalizationPolicy, ErrorPolicy> rational2
     ) noexcept {
         return rational1 < rational2 ? rational2 : rational1;
     }
 
-    template<typename IntType>
+    template<typename IntType, typename NormalizationPolicy, typename ErrorPolicy>
     template<typename... Args>
-    constexpr Rational<IntType> Rational<IntType>::max(
-            const Rational<IntType> rational,
+    constexpr Rational<IntType, NormalizationPolicy, ErrorPolicy> Rational<IntType, NormalizationPolicy, ErrorPolicy>::max(
+            const Rational<IntType, NormalizationPolicy, ErrorPolicy> rational,
             Args... args
     ) noexcept {
         return max(rational, max(args...));
@@ -1141,15 +1588,15 @@ namespace Arkulib {
      ********************************************** CONVERSION DEF **********************************************
      ************************************************************************************************************/
 
-    template<typename IntType>
-    constexpr Rational<IntType> Rational<IntType>::toApproximation(const unsigned int digitsKept) const  {
-        if (digitsKept > Constant::DEFAULT_MAX_DIGITS_APPROXIMATE) throw Exceptions::DigitsTooLargeException();
-        return Rational<IntType>(Tools::roundToWantedPrecision(toRealNumber<double>(), std::pow(10,digitsKept)));
+    template<typename IntType, typename NormalizationPolicy, typename ErrorPolicy>
+    constexpr Rational<IntType, NormalizationPolicy, ErrorPolicy> Rational<IntType, NormalizationPolicy, ErrorPolicy>::toApproximation(const unsigned int digitsKept) const  {
+        if (digitsKept > Constant::DEFAULT_MAX_DIGITS_APPROXIMATE) return raiseError(ArkulibError::DigitsTooLarge);
+        return Rational<IntType, NormalizationPolicy, ErrorPolicy>(Tools::roundToWantedPrecision(toRealNumber<double>(), std::pow(10,digitsKept)));
     }
 
-    template<typename IntType>
+    template<typename IntType, typename NormalizationPolicy, typename ErrorPolicy>
     template<typename FloatingType>
-    Rational<IntType> constexpr Rational<IntType>::fromFloatingPoint(
+    Rational<IntType, NormalizationPolicy, ErrorPolicy> constexpr Rational<IntType, NormalizationPolicy, ErrorPolicy>::fromFloatingPoint(
             const FloatingType floatingRatio,
             size_t iter
     ) {
@@ -1161,7 +1608,7 @@ namespace Arkulib {
         }
 
         if (floatingRatio <= static_cast<FloatingType>(Constant::DEFAULT_THRESHOLD_FROM_FP) || iter == 0) {
-            return Rational<IntType>::Zero();
+            return Rational<IntType, NormalizationPolicy, ErrorPolicy>::Zero();
         }
 
         if (floatingRatio < ONE) {
@@ -1171,41 +1618,268 @@ namespace Arkulib {
 
         auto integerPart = static_cast<IntType>(floatingRatio);
         return fromFloatingPoint(floatingRatio - integerPart, iter - 1)
-               + Rational<IntType>(integerPart, ONE);
+               + Rational<IntType, NormalizationPolicy, ErrorPolicy>(integerPart, ONE);
+    }
+
+    template<typename IntType, typename NormalizationPolicy, typename ErrorPolicy>
+    template<typename FloatingType>
+    constexpr Rational<IntType, NormalizationPolicy, ErrorPolicy> Rational<IntType, NormalizationPolicy, ErrorPolicy>::fromFloatingPointExact(
+            const FloatingType floatingRatio
+    ) noexcept(ErrorPolicy::isNoexcept) {
+        const Tools::DyadicDecomposition dyadic = Tools::decomposeFloatingPoint(floatingRatio);
+        if (!dyadic.isFinite) return raiseError(ArkulibError::NumberTooLarge);
+        if (dyadic.mantissa == 0) return Zero();
+
+        const unsigned int shift = dyadic.exponent < 0 ? -dyadic.exponent : dyadic.exponent;
+        if constexpr (Tools::IntegerTraits<IntType>::isBounded) {
+            // The numerator needs bitWidth(mantissa) + exponent bits, the denominator 2^-exponent one more than -exponent
+            constexpr int DIGITS = std::numeric_limits<IntType>::digits;
+            const int mantissaBits = 64 - Tools::countLeadingZeros(dyadic.mantissa);
+            const bool doesOverflow = dyadic.exponent >= 0
+                                      ? mantissaBits + dyadic.exponent > DIGITS
+                                      : mantissaBits > DIGITS || -dyadic.exponent >= DIGITS;
+            if (doesOverflow) return raiseError(ArkulibError::NumberTooLarge);
+        }
+
+        const auto mantissa = static_cast<IntType>(dyadic.mantissa);
+        const IntType numerator = dyadic.exponent > 0 ? IntType(mantissa * Tools::powerOfTwo<IntType>(shift)) : mantissa;
+        const IntType denominator = dyadic.exponent < 0 ? Tools::powerOfTwo<IntType>(shift) : IntType(1);
+        return fromReducedOperands(dyadic.isNegative ? IntType(-numerator) : numerator, denominator);
+    }
+
+    template<typename IntType, typename NormalizationPolicy, typename ErrorPolicy>
+    template<typename FloatingType>
+    constexpr Rational<IntType, NormalizationPolicy, ErrorPolicy> Rational<IntType, NormalizationPolicy, ErrorPolicy>::bestApproximation(
+            const FloatingType floatingRatio,
+            const IntType maxDenominator
+    ) noexcept(ErrorPolicy::isNoexcept) {
+        if (maxDenominator < IntType(1)) return raiseError(ArkulibError::DivideByZero);
+
+        const Tools::DyadicDecomposition dyadic = Tools::decomposeFloatingPoint(floatingRatio);
+        if (!dyadic.isFinite) return raiseError(ArkulibError::NumberTooLarge);
+        if (dyadic.mantissa == 0) return Zero();
+
+        const unsigned int shift = dyadic.exponent < 0 ? -dyadic.exponent : dyadic.exponent;
+        if constexpr (Tools::IntegerTraits<IntType>::isBounded) {
+#ifdef __SIZEOF_INT128__
+            using UnsignedType = Tools::UInt128;
+#else
+            using UnsignedType = std::uint64_t;
+#endif
+            constexpr int BITS = sizeof(UnsignedType) * 8;
+            constexpr int DIGITS = std::numeric_limits<IntType>::digits;
+            static_assert(BITS >= 65 + DIGITS, "bestApproximation needs an unsigned integer twice as wide as IntType");
+
+            // Above max(IntType): nothing to approximate with
+            const int mantissaBits = 64 - Tools::countLeadingZeros(dyadic.mantissa);
+            if (dyadic.exponent >= 0 && mantissaBits + dyadic.exponent > DIGITS) return raiseError(ArkulibError::NumberTooLarge);
+
+            // 2^-exponent doesn't fit in UnsignedType: the value is below 2^(64 - BITS) <= 1 / (2 * maxDenominator),
+            // so 0 is closer than 1 / maxDenominator
+            if (dyadic.exponent <= -BITS) return Zero();
+
+            // The 64-bit divisions are several times faster than the 128-bit ones: used whenever everything fits
+            if (dyadic.exponent > -64 && dyadic.exponent < 64 - mantissaBits) {
+                const std::uint64_t numerator = dyadic.exponent > 0 ? dyadic.mantissa << shift : dyadic.mantissa;
+                const std::uint64_t denominator = dyadic.exponent < 0 ? std::uint64_t(1) << shift : 1;
+                const auto denominatorBound = static_cast<std::uint64_t>(maxDenominator);
+                std::uint64_t numeratorBound{}, product{};
+                if (!Tools::multiplyOverflow<std::uint64_t>(numerator / denominator + 1, denominatorBound, numeratorBound)
+                    && !Tools::multiplyOverflow<std::uint64_t>(numeratorBound, 2 * denominatorBound, product)) {
+                    return closestWithBoundedDenominator<std::uint64_t>(dyadic.isNegative, numerator, denominator, denominatorBound);
+                }
+            }
+
+            const UnsignedType mantissa = dyadic.mantissa;
+            return closestWithBoundedDenominator<UnsignedType>(
+                    dyadic.isNegative,
+                    dyadic.exponent > 0 ? UnsignedType(mantissa << shift) : mantissa,
+                    dyadic.exponent < 0 ? UnsignedType(UnsignedType(1) << shift) : UnsignedType(1),
+                    static_cast<UnsignedType>(maxDenominator)
+            );
+        }
+        else {
+            const auto mantissa = static_cast<IntType>(dyadic.mantissa);
+            return closestWithBoundedDenominator<IntType>(
+                    dyadic.isNegative,
+                    dyadic.exponent > 0 ? IntType(mantissa * Tools::powerOfTwo<IntType>(shift)) : mantissa,
+                    dyadic.exponent < 0 ? Tools::powerOfTwo<IntType>(shift) : IntType(1),
+                    maxDenominator
+            );
+        }
+    }
+
+    template<typename IntType, typename NormalizationPolicy, typename ErrorPolicy>
+    constexpr Rational<IntType, NormalizationPolicy, ErrorPolicy> Rational<IntType, NormalizationPolicy, ErrorPolicy>::limitDenominator(
+            const IntType maxDenominator
+    ) const noexcept(ErrorPolicy::isNoexcept) {
+        if (maxDenominator < IntType(1)) return raiseError(ArkulibError::DivideByZero);
+        if (getDenominator() <= maxDenominator) return NormalizationPolicy::isAlwaysReduced ? *this : simplify();
+
+        if constexpr (Tools::IntegerTraits<IntType>::isBounded) {
+            static_assert(Tools::WiderInteger<IntType>::isWider, "limitDenominator needs a wider integer type than IntType");
+            using UnsignedType = Tools::UnsignedIntegerType<WideType>;
+            return closestWithBoundedDenominator<UnsignedType>(
+                    isNegative(),
+                    static_cast<UnsignedType>(Tools::unsignedAbs(getNumerator())),
+                    static_cast<UnsignedType>(getDenominator()),
+                    static_cast<UnsignedType>(maxDenominator)
+            );
+        }
+        else {
+            using std::abs;
+            return closestWithBoundedDenominator<IntType>(isNegative(), abs(getNumerator()), getDenominator(), maxDenominator);
+        }
     }
 
     /************************************************************************************************************
      ************************************************ METHODS DEF ***********************************************
      ************************************************************************************************************/
 
-    template<typename IntType>
-    template<typename AnotherIntType>
-    constexpr void Rational<IntType>::verifyNumberLargeness(
-            Rational<AnotherIntType> &anotherRational
-    ) const {
+    template<typename IntType, typename NormalizationPolicy, typename ErrorPolicy>
+    template<typename AnotherIntType, typename AnotherPolicy, typename AnotherErrorPolicy>
+    constexpr bool Rational<IntType, NormalizationPolicy, ErrorPolicy>::verifyNumberLargeness(
+            Rational<AnotherIntType, AnotherPolicy, AnotherErrorPolicy> &anotherRational
+    ) const noexcept(ErrorPolicy::isNoexcept) {
+        if constexpr (!Tools::IntegerTraits<IntType>::isBounded) return true;
+
         // If the value of the other rational is above the limits of IntType
         if ((std::numeric_limits<IntType>::max() < anotherRational.getLargerOperand() ||
              std::numeric_limits<IntType>::lowest() > anotherRational.getLowerOperand())) {
-            throw Exceptions::NumberTooLargeException();
+            ErrorPolicy::raise(ArkulibError::NumberTooLarge);
+            return false;
         }
         // We assume (sadly) that the user won't go beyond long long int max (so naive)
+        return true;
+    }
+
+    template<typename IntType, typename NormalizationPolicy, typename ErrorPolicy>
+    constexpr Rational<IntType, NormalizationPolicy, ErrorPolicy> Rational<IntType, NormalizationPolicy, ErrorPolicy>::scaledSqrt(
+            const WideType &numerator,
+            const WideType &denominator,
+            const WideType &scale
+    ) noexcept(ErrorPolicy::isNoexcept) {
+        WideType radicand(0);
+        if (Tools::multiplyOverflow(scale, scale, radicand) || Tools::multiplyOverflow(radicand, numerator, radicand))
+            return raiseError(ArkulibError::NumberTooLarge);
+
+        return checkForOverflowThenReturn(Tools::isqrt(WideType(radicand / denominator)), scale);
+    }
+
+    template<typename IntType, typename NormalizationPolicy, typename ErrorPolicy>
+    constexpr Rational<IntType, NormalizationPolicy, ErrorPolicy> Rational<IntType, NormalizationPolicy, ErrorPolicy>::checkForOverflowThenReturn(
+            WideType numerator,
+            WideType denominator
+    ) noexcept(ErrorPolicy::isNoexcept) {
+        if (denominator == WideType(0)) return raiseError(ArkulibError::DivideByZero);
+
+        const WideType gcd = Tools::gcd(numerator, denominator);
+        numerator /= gcd;
+        denominator /= gcd;
+        if (denominator < WideType(0)) {
+            numerator = -numerator;
+            denominator = -denominator;
+        }
+
+        if (!Tools::fitsIn<IntType>(numerator) || !Tools::fitsIn<IntType>(denominator)) {
+            if constexpr (Policies::isApproximating<ErrorPolicy> && Tools::WiderInteger<IntType>::isWider)
+                return approximateOverflow(numerator, denominator);
+            return raiseError(ArkulibError::NumberTooLarge);
+        }
+
+        return fromReducedOperands(static_cast<IntType>(numerator), static_cast<IntType>(denominator));
+    }
+
+    template<typename IntType, typename NormalizationPolicy, typename ErrorPolicy>
+    constexpr Rational<IntType, NormalizationPolicy, ErrorPolicy> Rational<IntType, NormalizationPolicy, ErrorPolicy>::approximateOverflow(
+            const WideType numerator,
+            const WideType denominator
+    ) noexcept {
+        using UnsignedWideType = Tools::UnsignedIntegerType<WideType>;
+        constexpr auto BOUND = static_cast<UnsignedWideType>(std::numeric_limits<IntType>::max());
+
+        UnsignedWideType approximatedNumerator{}, approximatedDenominator{};
+        Tools::boundedBestApproximation(
+                Tools::unsignedAbs(numerator), static_cast<UnsignedWideType>(denominator),
+                BOUND, BOUND,
+                approximatedNumerator, approximatedDenominator
+        );
+
+        const auto newNumerator = static_cast<IntType>(numerator < WideType(0) ? -static_cast<IntType>(approximatedNumerator) : static_cast<IntType>(approximatedNumerator));
+        const auto newDenominator = static_cast<IntType>(approximatedDenominator);
+
+        const long double error = static_cast<long double>(numerator) / static_cast<long double>(denominator)
+                                  - static_cast<long double>(newNumerator) / static_cast<long double>(newDenominator);
+        ErrorPolicy::recordApproximation(static_cast<double>(error < 0 ? -error : error));
+
+        return fromReducedOperands(newNumerator, newDenominator);
+    }
+
+    template<typename IntType, typename NormalizationPolicy, typename ErrorPolicy>
+    template<typename UnsignedType>
+    constexpr Rational<IntType, NormalizationPolicy, ErrorPolicy> Rational<IntType, NormalizationPolicy, ErrorPolicy>::closestWithBoundedDenominator(
+            const bool isNegative,
+            const UnsignedType numerator,
+            const UnsignedType denominator,
+            const UnsignedType denominatorBound
+    ) noexcept {
+        // Every candidate is at most floor(value) + 1: no numerator goes beyond (floor(value) + 1) * denominatorBound
+        UnsignedType numeratorBound = (numerator / denominator + UnsignedType(1)) * denominatorBound;
+        if constexpr (Tools::IntegerTraits<IntType>::isBounded) {
+            constexpr auto MAX = static_cast<UnsignedType>(std::numeric_limits<IntType>::max());
+            if (MAX < numeratorBound) numeratorBound = MAX;
+        }
+
+        UnsignedType bestNumerator{}, bestDenominator{};
+        Tools::boundedBestApproximation(numerator, denominator, numeratorBound, denominatorBound, bestNumerator, bestDenominator);
+
+        const auto resultNumerator = static_cast<IntType>(bestNumerator);
+        return fromReducedOperands(isNegative ? IntType(-resultNumerator) : resultNumerator, static_cast<IntType>(bestDenominator));
     }
 
-    template<typename IntType>
-    constexpr void Rational<IntType>::verifyDenominator(
+    template<typename IntType, typename NormalizationPolicy, typename ErrorPolicy>
+    constexpr void Rational<IntType, NormalizationPolicy, ErrorPolicy>::verifyDenominator(
             const IntType denominator,
             const bool checkIfDenominatorIsNull
-    ) {
-        constexpr IntType ZERO = 0;
-        if (denominator == ZERO && checkIfDenominatorIsNull)
-            throw Exceptions::DivideByZeroException();
+    ) noexcept(ErrorPolicy::isNoexcept) {
+        const IntType ZERO(0);
+        if (denominator == ZERO && checkIfDenominatorIsNull) {
+            // The rational becomes 0 / 1 when the ErrorPolicy doesn't throw
+            ErrorPolicy::raise(ArkulibError::DivideByZero);
+            m_numerator = ZERO;
+            m_denominator = 1;
+            return;
+        }
 
         if (denominator < ZERO) {
-            m_numerator = -m_numerator;
-            m_denominator = -denominator;
+            IntType numerator(ZERO), positiveDenominator(ZERO);
+            if (Tools::subtractOverflow(ZERO, m_numerator, numerator) || Tools::subtractOverflow(ZERO, denominator, positiveDenominator)) {
+                // The minimum of IntType has no opposite: the signs are swapped in the wide type and the fraction is
+                // reduced there (2 / INT_MIN = -1 / 2^30), what still doesn't fit goes through the ErrorPolicy
+                if constexpr (Tools::WiderInteger<IntType>::isWider) {
+                    *this = checkForOverflowThenReturn(-WideType(m_numerator), -WideType(denominator));
+                }
+                else *this = raiseError(ArkulibError::NumberTooLarge);
+                return;
+            }
+            m_numerator = numerator;
+            m_denominator = positiveDenominator;
         }
     }
 
+    /************************************************************************************************************
+     ************************************************* STD::RATIO ***********************************************
+     ************************************************************************************************************/
+
+    /**
+     * @brief The std::ratio of a constexpr rational with static storage, the reverse of Rational(std::ratio<N, D>):
+     * static constexpr Rational<long long> half(1, 2);
+     * using Half = Arkulib::RatioOf<half>; // std::ratio<1, 2>
+     * @tparam Value
+     */
+    template<const auto &Value>
+    using RatioOf = std::ratio<Value.getNumerator(), Value.getDenominator()>;
+
     /************************************************************************************************************
      ******************************************* STD::COUT OVERRIDE *********************************************
      ************************************************************************************************************/
@@ -1213,13 +1887,32 @@ namespace Arkulib {
     /**
      * @brief << operator override to allow std::cout
      * @tparam IntType
+     * @tparam NormalizationPolicy
+     * @tparam ErrorPolicy
      * @param stream
      * @param rational
      * @return The stream with the rational to string.
      */
-    template<typename IntType>
-    std::ostream &operator<<(std::ostream &stream, const Rational<IntType> &rational) {
+    template<typename IntType, typename NormalizationPolicy, typename ErrorPolicy>
+    std::ostream &operator<<(std::ostream &stream, const Rational<IntType, NormalizationPolicy, ErrorPolicy> &rational) {
         return stream << rational.toString();
     }
 }
 
+namespace std {
+    /**
+     * @brief Hash of the reduced form: 2 / 4 and 1 / 2 have the same hash, even with the Lazy policy
+     */
+    template<typename IntType, typename NormalizationPolicy, typename ErrorPolicy>
+    struct hash<Arkulib::Rational<IntType, NormalizationPolicy, ErrorPolicy>> {
+        inline std::size_t operator()(const Arkulib::Rational<IntType, NormalizationPolicy, ErrorPolicy> &rational) const noexcept {
+            if constexpr (NormalizationPolicy::isAlwaysReduced) {
+                return static_cast<std::size_t>(Arkulib::Tools::hashFraction(rational.getNumerator(), rational.getDenominator()));
+            }
+            else {
+                const Arkulib::Rational<IntType, NormalizationPolicy, ErrorPolicy> reduced = rational.simplify();
+                return static_cast<std::size_t>(Arkulib::Tools::hashFraction(reduced.getNumerator(), reduced.getDenominator()));
+            }
+        }
+    };
+}
@@ -0,0 +1,281 @@
+/**
+ * @file      RationalExpression.hpp
+ * @author    Elise MASSA
+ * @author    Mattéo LECLERCQ
+ * @date      2022
+ * @brief     Opt-in expression templates: a chain like a * b + c * d - e / f is evaluated as a whole on wide
+ *            integers, with one overflow check and one normalization instead of one per operator
+ * @copyright WTFPL
+ */
+
+#pragma once
+
+#include <tuple>
+#include <type_traits>
+
+#include "Algorithms.hpp"
+#include "BigInt.hpp"
+#include "Rational.hpp"
+#include "Tools/FractionAccumulator.hpp"
+
+namespace Arkulib::Expressions {
+    /**
+     * @brief Result of the evaluation of a node
+     */
+    enum class Status { Ok, Overflow, DivideByZero };
+
+    /**
+     * @brief The integer type of the evaluation: the widest builtin integer (__int128 for int and long long), or
+     * IntType itself when it isn't a builtin integer (BigInt)
+     */
+    template<typename IntType>
+    using EvaluationType = std::conditional_t<
+            Tools::isBuiltinInteger<IntType>, Tools::WiderIntegerType<Tools::WiderIntegerType<IntType>>, IntType
+    >;
+
+    /**
+     * @brief Base of the nodes (CRTP). The conversion to the rational evaluates the tree: the numerator and the
+     * denominator are computed without any gcd, in EvaluationType, then in BigInt if it overflows. The result is
+     * normalized once, and NumberTooLarge is raised only if it doesn't fit in IntType.
+     * @tparam Derived
+     * @tparam RationalType
+     */
+    template<typename Derived, typename RationalType>
+    class Expression {
+
+    public:
+        using Rational = RationalType;
+        using IsRationalExpression = void;
+
+        /**
+         * @return The value of the expression
+         */
+        [[nodiscard]] RationalType evaluate() const noexcept(Tools::RationalTraits<RationalType>::Error::isNoexcept);
+
+        inline operator RationalType() const noexcept(Tools::RationalTraits<RationalType>::Error::isNoexcept) { return evaluate(); } // NOLINT(google-explicit-constructor)
+
+    protected:
+        inline const Derived &derived() const noexcept { return static_cast<const Derived &>(*this); }
+    };
+
+    /**
+     * @brief A rational operand, stored by value (a Rational is two integers)
+     */
+    template<typename RationalType>
+    class Leaf : public Expression<Leaf<RationalType>, RationalType> {
+
+    public:
+        inline constexpr explicit Leaf(const RationalType &value) noexcept : m_value(value) {}
+
+        template<typename WideType>
+        inline Status fraction(WideType &numerator, WideType &denominator) const {
+            numerator = WideType(m_value.getNumerator());
+            denominator = WideType(m_value.getDenominator());
+            return Status::Ok;
+        }
+
+    private:
+        RationalType m_value;
+    };
+
+    /**
+     * @brief Operations of the nodes: numerator / denominator = left op right, the denominator can be negative
+     */
+    struct Add {
+        template<typename WideType>
+        static inline bool overflow(const WideType &n1, const WideType &d1, const WideType &n2, const WideType &d2, WideType &numerator, WideType &denominator) {
+            if (d1 == d2) {
+                denominator = d1;
+                return Tools::addOverflow(n1, n2, numerator);
+            }
+            WideType left{}, right{};
+            return Tools::multiplyOverflow(n1, d2, left) || Tools::multiplyOverflow(n2, d1, right)
+                   || Tools::addOverflow(left, right, numerator) || Tools::multiplyOverflow(d1, d2, denominator);
+        }
+    };
+
+    struct Subtract {
+        template<typename WideType>
+        static inline bool overflow(const WideType &n1, const WideType &d1, const WideType &n2, const WideType &d2, WideType &numerator, WideType &denominator) {
+            if (d1 == d2) {
+                denominator = d1;
+                return Tools::subtractOverflow(n1, n2, numerator);
+            }
+            WideType left{}, right{};
+            return Tools::multiplyOverflow(n1, d2, left) || Tools::multiplyOverflow(n2, d1, right)
+                   || Tools::subtractOverflow(left, right, numerator) || Tools::multiplyOverflow(d1, d2, denominator);
+        }
+    };
+
+    struct Multiply {
+        template<typename WideType>
+        static inline bool overflow(const WideType &n1, const WideType &d1, const WideType &n2, const WideType &d2, WideType &numerator, WideType &denominator) {
+            return Tools::multiplyOverflow(n1, n2, numerator) || Tools::multiplyOverflow(d1, d2, denominator);
+        }
+    };
+
+    struct Divide {
+        template<typename WideType>
+        static inline bool overflow(const WideType &n1, const WideType &d1, const WideType &n2, const WideType &d2, WideType &numerator, WideType &denominator) {
+            return Tools::multiplyOverflow(n1, d2, numerator) || Tools::multiplyOverflow(d1, n2, denominator);
+        }
+    };
+
+    /**
+     * @brief left op right
+     */
+    template<typename Operation, typename Left, typename Right>
+    class Node : public Expression<Node<Operation, Left, Right>, typename Left::Rational> {
+        static_assert(std::is_same_v<typename Left::Rational, typename Right::Rational>, "The operands of an expression must have the same Rational type");
+
+    public:
+        inline constexpr Node(const Left &left, const Right &right) noexcept : m_left(left), m_right(right) {}
+
+        template<typename WideType>
+        Status fraction(WideType &numerator, WideType &denominator) const {
+            WideType n1{}, d1{}, n2{}, d2{};
+            Status status = m_left.fraction(n1, d1);
+            if (status != Status::Ok) return status;
+            status = m_right.fraction(n2, d2);
+            if (status != Status::Ok) return status;
+            if constexpr (std::is_same_v<Operation, Divide>) {
+                if (n2 == WideType(0)) return Status::DivideByZero;
+            }
+            return Operation::overflow(n1, d1, n2, d2, numerator, denominator) ? Status::Overflow : Status::Ok;
+        }
+
+    private:
+        Left m_left;
+        Right m_right;
+    };
+
+    /**
+     * @brief -operand
+     */
+    template<typename Operand>
+    class Negate : public Expression<Negate<Operand>, typename Operand::Rational> {
+
+    public:
+        inline constexpr explicit Negate(const Operand &operand) noexcept : m_operand(operand) {}
+
+        template<typename WideType>
+        Status fraction(WideType &numerator, WideType &denominator) const {
+            const Status status = m_operand.fraction(numerator, denominator);
+            if (status != Status::Ok) return status;
+            return Tools::subtractOverflow(WideType(0), numerator, numerator) ? Status::Overflow : Status::Ok;
+        }
+
+    private:
+        Operand m_operand;
+    };
+
+    /************************************************************************************************************
+     ************************************************* EVALUATION ***********************************************
+     ************************************************************************************************************/
+
+    template<typename Derived, typename RationalType>
+    RationalType Expression<Derived, RationalType>::evaluate() const noexcept(Tools::RationalTraits<RationalType>::Error::isNoexcept) {
+        using ErrorPolicy = typename Tools::RationalTraits<RationalType>::Error;
+        using WideType = EvaluationType<typename Tools::RationalTraits<RationalType>::Int>;
+
+        // The denominator is made positive, then the fraction is reduced once (if the negation overflows, BigInt)
+        const auto isNormalized = [](auto &fraction) {
+            using Type = std::decay_t<decltype(fraction.denominator)>;
+            return !(fraction.denominator < Type(0))
+                   || (!Tools::subtractOverflow(Type(0), fraction.numerator, fraction.numerator)
+                       && !Tools::subtractOverflow(Type(0), fraction.denominator, fraction.denominator));
+        };
+
+        Tools::FractionAccumulator<WideType> wide;
+        Status status = derived().fraction(wide.numerator, wide.denominator);
+        if (status == Status::Ok && isNormalized(wide)) return Tools::finalFraction<RationalType>(wide);
+
+        if (status != Status::DivideByZero) {
+            Tools::FractionAccumulator<BigInt> big;
+            status = derived().fraction(big.numerator, big.denominator);
+            if (status == Status::Ok && isNormalized(big)) return Tools::finalFraction<RationalType>(big);
+        }
+        ErrorPolicy::raise(ArkulibError::DivideByZero);
+        return RationalType();
+    }
+
+    /************************************************************************************************************
+     ************************************************* OPERATORS ************************************************
+     ************************************************************************************************************/
+
+    /**
+     * @brief The node of an operand: itself for an expression, a leaf for a rational
+     */
+    template<typename Type, bool = Tools::isRational<Type>>
+    struct OperandOf {
+        using Node = Leaf<Type>;
+
+        static inline constexpr Node wrap(const Type &value) noexcept { return Node(value); }
+    };
+
+    template<typename Type>
+    struct OperandOf<Type, false> {
+        using Node = Type;
+
+        static inline constexpr const Type &wrap(const Type &value) noexcept { return value; }
+    };
+
+    // At least one operand is an expression, the other one is an expression or a rational
+    template<typename Left, typename Right>
+    constexpr bool areOperands = (Tools::isRationalExpression<Left> && (Tools::isRationalExpression<Right> || Tools::isRational<Right>))
+                                 || (Tools::isRational<Left> && Tools::isRationalExpression<Right>);
+
+    template<typename Operation, typename Left, typename Right>
+    using NodeOf = Node<Operation, typename OperandOf<Left>::Node, typename OperandOf<Right>::Node>;
+
+    template<typename Left, typename Right, std::enable_if_t<areOperands<Left, Right>, int> = 0>
+    inline constexpr NodeOf<Add, Left, Right> operator+(const Left &left, const Right &right) noexcept {
+        return {OperandOf<Left>::wrap(left), OperandOf<Right>::wrap(right)};
+    }
+
+    template<typename Left, typename Right, std::enable_if_t<areOperands<Left, Right>, int> = 0>
+    inline constexpr NodeOf<Subtract, Left, Right> operator-(const Left &left, const Right &right) noexcept {
+        return {OperandOf<Left>::wrap(left), OperandOf<Right>::wrap(right)};
+    }
+
+    template<typename Left, typename Right, std::enable_if_t<areOperands<Left, Right>, int> = 0>
+    inline constexpr NodeOf<Multiply, Left, Right> operator*(const Left &left, const Right &right) noexcept {
+        return {OperandOf<Left>::wrap(left), OperandOf<Right>::wrap(right)};
+    }
+
+    template<typename Left, typename Right, std::enable_if_t<areOperands<Left, Right>, int> = 0>
+    inline constexpr NodeOf<Divide, Left, Right> operator/(const Left &left, const Right &right) noexcept {
+        return {OperandOf<Left>::wrap(left), OperandOf<Right>::wrap(right)};
+    }
+
+    template<typename Operand, std::enable_if_t<Tools::isRationalExpression<Operand>, int> = 0>
+    inline constexpr Negate<Operand> operator-(const Operand &operand) noexcept {
+        return Negate<Operand>(operand);
+    }
+
+    /************************************************************************************************************
+     *************************************************** ENTRY **************************************************
+     ************************************************************************************************************/
+
+    /**
+     * @brief Opt in for one operand: lazy(a) * b + lazy(c) * d builds an expression, evaluated when it's converted
+     * to the rational
+     * @param value
+     * @return The leaf of value
+     */
+    template<typename IntType, typename NormalizationPolicy, typename ErrorPolicy>
+    inline constexpr Leaf<Rational<IntType, NormalizationPolicy, ErrorPolicy>> lazy(const Rational<IntType, NormalizationPolicy, ErrorPolicy> &value) noexcept {
+        return Leaf<Rational<IntType, NormalizationPolicy, ErrorPolicy>>(value);
+    }
+
+    /**
+     * @brief Opt in for several operands, the formula itself doesn't change:
+     * auto [A, B, C, D, E, F] = lazy(a, b, c, d, e, f);
+     * Rational<long long> result = A * B + C * D - E / F;
+     * @return A tuple of leaves
+     */
+    template<typename... RationalTypes, std::enable_if_t<(sizeof...(RationalTypes) > 1), int> = 0>
+    inline constexpr std::tuple<Leaf<RationalTypes>...> lazy(const RationalTypes &... values) noexcept {
+        return std::tuple<Leaf<RationalTypes>...>(Leaf<RationalTypes>(values)...);
+    }
+}
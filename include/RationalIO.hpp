@@ -0,0 +1,614 @@
+/**
+ * @file      RationalIO.hpp
+ * @author    Elise MASSA
+ * @author    Mattéo LECLERCQ
+ * @date      2022
+ * @brief     Buffered bulk writing and reading of rationals in streams: as text, formatted and parsed in place
+ *            (Rational::toChars / fromChars), or in a compact binary format read in place from a memory-mapped file
+ * @copyright WTFPL
+ */
+
+#pragma once
+
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <istream>
+#include <iterator>
+#include <ostream>
+#include <string>
+#include <system_error>
+#include <utility>
+#include <vector>
+#if __has_include(<sys/mman.h>)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define ARKULIB_HAS_MMAP
+#endif
+
+#include "Algorithms.hpp"
+#include "Rational.hpp"
+#include "Tools/Varint.hpp"
+
+namespace Arkulib::IO {
+    constexpr std::size_t DEFAULT_BUFFER_SIZE = 1 << 16; /*!< Default size of the buffers of the writers and the readers */
+
+    /**
+     * @brief Write rationals as text, one "numerator/denominator" followed by a separator per value. The text is
+     * written in the stream when the buffer is full, by flush() and by the destructor.
+     */
+    class TextWriter {
+
+    public:
+        /**
+         * @param stream The destination
+         * @param bufferSize
+         * @param separator Written after each value
+         */
+        explicit TextWriter(std::ostream &stream, const std::size_t bufferSize = DEFAULT_BUFFER_SIZE, const char separator = '\n')
+                : m_stream(stream), m_buffer(bufferSize < 2 ? 2 : bufferSize), m_separator(separator) {}
+
+        TextWriter(const TextWriter &) = delete;
+
+        TextWriter &operator=(const TextWriter &) = delete;
+
+        inline ~TextWriter() { flush(); }
+
+        /**
+         * @brief Append a value (a value larger than the buffer, with BigInt, makes the buffer grow)
+         * @tparam RationalType
+         * @param value
+         */
+        template<typename RationalType>
+        void write(const RationalType &value) {
+            for (;;) {
+                char *const begin = m_buffer.data() + m_size, *const end = m_buffer.data() + m_buffer.size();
+                const std::to_chars_result result = value.toChars(begin, end);
+                if (result.ec == std::errc() && result.ptr != end) {
+                    *result.ptr = m_separator;
+                    m_size = static_cast<std::size_t>(result.ptr + 1 - m_buffer.data());
+                    return;
+                }
+
+                if (m_size == 0) m_buffer.resize(m_buffer.size() * 2);
+                else flush();
+            }
+        }
+
+        /**
+         * @brief Append the values of [first, last)
+         */
+        template<typename Iterator>
+        void write(Iterator first, const Iterator last) {
+            for (; first != last; ++first) write(*first);
+        }
+
+        /**
+         * @brief Write the buffered text in the stream (the stream itself isn't flushed)
+         */
+        void flush() {
+            if (m_size == 0) return;
+            m_stream.write(m_buffer.data(), static_cast<std::streamsize>(m_size));
+            m_size = 0;
+        }
+
+    private:
+        std::ostream &m_stream;
+        std::vector<char> m_buffer;
+        std::size_t m_size = 0; /*!< Number of buffered characters */
+        char m_separator;
+    };
+
+    /**
+     * @brief Read rationals written as text ("n/d", "(n / d)", "n" or "3.125"), separated by blanks, line breaks or
+     * commas. A value must be shorter than half the buffer.
+     */
+    class TextReader {
+
+    public:
+        /**
+         * @param stream The source
+         * @param bufferSize
+         */
+        explicit TextReader(std::istream &stream, const std::size_t bufferSize = DEFAULT_BUFFER_SIZE)
+                : m_stream(stream), m_buffer(bufferSize < 2 ? 2 : bufferSize) {}
+
+        TextReader(const TextReader &) = delete;
+
+        TextReader &operator=(const TextReader &) = delete;
+
+        /**
+         * @brief Read the next value
+         * @tparam RationalType
+         * @param value Receives the value
+         * @return False at the end of the stream, or if the next value is malformed (then status() tells why and the
+         * reading stops)
+         */
+        template<typename RationalType>
+        bool read(RationalType &value) {
+            if (m_status != std::errc()) return false;
+
+            for (;;) {
+                while (m_position != m_size && isSeparator(m_buffer[m_position])) ++m_position;
+                if (m_position != m_size || !refill()) break;
+            }
+            if (m_position == m_size) return false;
+            if (m_size - m_position < m_buffer.size() / 2) refill();
+
+            const char *const begin = m_buffer.data() + m_position;
+            const std::from_chars_result result = RationalType::fromChars(begin, m_buffer.data() + m_size, value);
+            if (result.ec != std::errc()) {
+                m_status = result.ec;
+                return false;
+            }
+            m_position += static_cast<std::size_t>(result.ptr - begin);
+            return true;
+        }
+
+        /**
+         * @brief Read the values up to the end of the stream (or up to a malformed value)
+         * @tparam RationalType
+         */
+        template<typename RationalType>
+        std::vector<RationalType> readAll() {
+            std::vector<RationalType> values;
+            RationalType value;
+            while (read(value)) values.push_back(value);
+            return values;
+        }
+
+        /**
+         * @return errc() or the error of the malformed value which stopped the reading
+         */
+        [[nodiscard]] inline std::errc status() const noexcept { return m_status; }
+
+    private:
+        std::istream &m_stream;
+        std::vector<char> m_buffer;
+        std::size_t m_position = 0; /*!< First unread character */
+        std::size_t m_size = 0; /*!< End of the buffered characters */
+        bool m_isEnd = false;
+        std::errc m_status = std::errc();
+
+        static constexpr inline bool isSeparator(const char character) noexcept {
+            return character == ' ' || character == '\n' || character == '\r' || character == '\t' || character == ',';
+        }
+
+        /**
+         * @brief Move the unread characters to the front of the buffer and fill the rest from the stream
+         * @return False if nothing more could be read
+         */
+        bool refill() {
+            if (m_isEnd) return false;
+            std::memmove(m_buffer.data(), m_buffer.data() + m_position, m_size - m_position);
+            m_size -= m_position;
+            m_position = 0;
+
+            m_stream.read(m_buffer.data() + m_size, static_cast<std::streamsize>(m_buffer.size() - m_size));
+            const auto count = static_cast<std::size_t>(m_stream.gcount());
+            m_size += count;
+            if (count == 0 || !m_stream) m_isEnd = true;
+            return count != 0;
+        }
+    };
+
+    /************************************************************************************************************
+     ************************************************** BINARY **************************************************
+     ************************************************************************************************************/
+
+    /*
+     * Binary format, version 1 (little endian):
+     *  - header: "ARKR", the version (1 byte), the flags (1 byte, BINARY_DELTA), 2 zero bytes
+     *  - blocks: the number of values (4 bytes), the size of the payload in bytes (4 bytes), then the payload: the
+     *    numerator and the denominator of each value as zigzag varints. With BINARY_DELTA, they are the differences
+     *    to the previous numerator and denominator of the block (modulo 2^64): sorted columns, ticks or common
+     *    denominators take one or two bytes per value. The first value of a block is stored as is.
+     * The integers are 64-bit. A block is skipped with its header and decoded without the previous ones.
+     */
+    constexpr unsigned char BINARY_MAGIC[4] = {'A', 'R', 'K', 'R'};
+    constexpr unsigned char BINARY_VERSION = 1;
+    constexpr unsigned char BINARY_DELTA = 1; /*!< Flag of the delta encoding */
+    constexpr std::size_t BINARY_HEADER_SIZE = 8;
+    constexpr std::size_t BINARY_BLOCK_HEADER_SIZE = 8;
+
+    /**
+     * @brief Options of the BinaryWriter
+     */
+    struct BinaryOptions {
+        std::size_t valuesPerBlock = 4096; /*!< The granularity of the random access */
+        bool isDelta = false; /*!< Delta encoding, for the sorted columns */
+    };
+
+    /**
+     * @brief Write rationals in the binary format. A block is written in the stream when it's full, by flush() (which
+     * closes the current block) and by the destructor.
+     */
+    class BinaryWriter {
+
+    public:
+        /**
+         * @param stream The destination, opened in binary mode
+         * @param options
+         */
+        explicit BinaryWriter(std::ostream &stream, const BinaryOptions &options = BinaryOptions())
+                : m_stream(stream), m_options(options) {
+            if (m_options.valuesPerBlock == 0) m_options.valuesPerBlock = 1;
+            const unsigned char header[BINARY_HEADER_SIZE] = {
+                    BINARY_MAGIC[0], BINARY_MAGIC[1], BINARY_MAGIC[2], BINARY_MAGIC[3],
+                    BINARY_VERSION, static_cast<unsigned char>(m_options.isDelta ? BINARY_DELTA : 0), 0, 0
+            };
+            writeBytes(header, BINARY_HEADER_SIZE);
+        }
+
+        BinaryWriter(const BinaryWriter &) = delete;
+
+        BinaryWriter &operator=(const BinaryWriter &) = delete;
+
+        inline ~BinaryWriter() { flush(); }
+
+        /**
+         * @brief Append a value, as it is (a Lazy rational isn't reduced)
+         * @tparam RationalType A rational with a builtin integer type of 64 bits at most
+         * @param value
+         */
+        template<typename RationalType>
+        void write(const RationalType &value) {
+            using IntType = typename Tools::RationalTraits<RationalType>::Int;
+            static_assert(Tools::isBuiltinInteger<IntType> && sizeof(IntType) <= sizeof(std::int64_t), "The binary format stores 64-bit integers");
+
+            const auto numerator = static_cast<std::uint64_t>(static_cast<std::int64_t>(value.getNumerator()));
+            const auto denominator = static_cast<std::uint64_t>(static_cast<std::int64_t>(value.getDenominator()));
+
+            unsigned char bytes[2 * Tools::MAX_VARINT_BYTES];
+            unsigned char *end = Tools::writeVarint(Tools::zigzagEncode(static_cast<std::int64_t>(numerator - m_previousNumerator)), bytes);
+            end = Tools::writeVarint(Tools::zigzagEncode(static_cast<std::int64_t>(denominator - m_previousDenominator)), end);
+            m_payload.insert(m_payload.end(), bytes, end);
+            if (m_options.isDelta) {
+                m_previousNumerator = numerator;
+                m_previousDenominator = denominator;
+            }
+
+            if (++m_count == m_options.valuesPerBlock) flush();
+        }
+
+        /**
+         * @brief Append the values of [first, last)
+         */
+        template<typename Iterator>
+        void write(Iterator first, const Iterator last) {
+            for (; first != last; ++first) write(*first);
+        }
+
+        /**
+         * @brief Write the current block in the stream, the next values start a new block
+         */
+        void flush() {
+            if (m_count == 0) return;
+            unsigned char header[BINARY_BLOCK_HEADER_SIZE];
+            storeLittleEndian(header, static_cast<std::uint32_t>(m_count));
+            storeLittleEndian(header + 4, static_cast<std::uint32_t>(m_payload.size()));
+            writeBytes(header, BINARY_BLOCK_HEADER_SIZE);
+            writeBytes(m_payload.data(), m_payload.size());
+
+            m_payload.clear();
+            m_count = 0;
+            m_previousNumerator = m_previousDenominator = 0;
+        }
+
+    private:
+        std::ostream &m_stream;
+        BinaryOptions m_options;
+        std::vector<unsigned char> m_payload; /*!< Payload of the current block */
+        std::size_t m_count = 0; /*!< Number of values in the current block */
+        std::uint64_t m_previousNumerator = 0, m_previousDenominator = 0; /*!< Always 0 without the delta encoding */
+
+        static inline void storeLittleEndian(unsigned char *output, const std::uint32_t value) noexcept {
+            for (int i = 0; i < 4; ++i) output[i] = static_cast<unsigned char>(value >> (8 * i));
+        }
+
+        inline void writeBytes(const unsigned char *bytes, const std::size_t count) {
+            m_stream.write(reinterpret_cast<const char *>(bytes), static_cast<std::streamsize>(count));
+        }
+    };
+
+#ifdef ARKULIB_HAS_MMAP
+    /**
+     * @brief A file mapped read-only in memory (POSIX): the pages are loaded by the system when they are read
+     */
+    class MappedFile {
+
+    public:
+        /**
+         * @param path
+         */
+        explicit MappedFile(const std::string &path) {
+            const int descriptor = ::open(path.c_str(), O_RDONLY);
+            if (descriptor < 0) {
+                m_status = static_cast<std::errc>(errno);
+                return;
+            }
+
+            struct stat information{};
+            if (::fstat(descriptor, &information) != 0) {
+                m_status = static_cast<std::errc>(errno);
+            }
+            else if (information.st_size > 0) {
+                void *data = ::mmap(nullptr, static_cast<std::size_t>(information.st_size), PROT_READ, MAP_PRIVATE, descriptor, 0);
+                if (data == MAP_FAILED) m_status = static_cast<std::errc>(errno);
+                else {
+                    m_data = data;
+                    m_size = static_cast<std::size_t>(information.st_size);
+                    ::madvise(data, m_size, MADV_SEQUENTIAL);
+                }
+            }
+            ::close(descriptor);
+        }
+
+        MappedFile(const MappedFile &) = delete;
+
+        MappedFile &operator=(const MappedFile &) = delete;
+
+        MappedFile(MappedFile &&other) noexcept
+                : m_data(std::exchange(other.m_data, nullptr)), m_size(std::exchange(other.m_size, 0)), m_status(other.m_status) {}
+
+        MappedFile &operator=(MappedFile &&other) noexcept {
+            if (this != &other) {
+                unmap();
+                m_data = std::exchange(other.m_data, nullptr);
+                m_size = std::exchange(other.m_size, 0);
+                m_status = other.m_status;
+            }
+            return *this;
+        }
+
+        inline ~MappedFile() { unmap(); }
+
+        [[nodiscard]] inline const void *data() const noexcept { return m_data; }
+
+        [[nodiscard]] inline std::size_t size() const noexcept { return m_size; }
+
+        /**
+         * @return errc() or the error of the system when the file couldn't be opened or mapped
+         */
+        [[nodiscard]] inline std::errc status() const noexcept { return m_status; }
+
+    private:
+        void *m_data = nullptr;
+        std::size_t m_size = 0;
+        std::errc m_status = std::errc();
+
+        inline void unmap() noexcept {
+            if (m_data != nullptr) ::munmap(m_data, m_size);
+        }
+    };
+#endif
+
+    /**
+     * @brief Read-only view of rationals in the binary format, over memory owned by someone else (a MappedFile, a
+     * buffer). Only the block headers are read at construction: the values are decoded one at a time by the
+     * iterators, nothing is copied.
+     * As in the conversion between two rationals (verifyNumberLargeness), a value that doesn't fit in the IntType of
+     * RationalType raises NumberTooLarge through its ErrorPolicy and is read as 0.
+     * @tparam RationalType
+     */
+    template<typename RationalType>
+    class BinaryView {
+
+    public:
+        class Iterator;
+
+        /**
+         * @param data The bytes of the format, kept alive by the caller
+         * @param size
+         */
+        BinaryView(const void *data, const std::size_t size) {
+            const auto *bytes = static_cast<const unsigned char *>(data);
+            if (size < BINARY_HEADER_SIZE || std::memcmp(bytes, BINARY_MAGIC, sizeof(BINARY_MAGIC)) != 0) {
+                m_status = std::errc::invalid_argument;
+                return;
+            }
+            if (bytes[4] != BINARY_VERSION) {
+                m_status = std::errc::not_supported;
+                return;
+            }
+            m_isDelta = (bytes[5] & BINARY_DELTA) != 0;
+
+            const unsigned char *position = bytes + BINARY_HEADER_SIZE, *const last = bytes + size;
+            while (position != last) {
+                if (static_cast<std::size_t>(last - position) < BINARY_BLOCK_HEADER_SIZE) break;
+                const std::uint32_t count = loadLittleEndian(position), payloadSize = loadLittleEndian(position + 4);
+                position += BINARY_BLOCK_HEADER_SIZE;
+                if (static_cast<std::size_t>(last - position) < payloadSize) break;
+
+                m_blocks.push_back({position, position + payloadSize, m_size, count});
+                m_size += count;
+                position += payloadSize;
+            }
+            if (position != last) m_status = std::errc::invalid_argument;
+        }
+
+#ifdef ARKULIB_HAS_MMAP
+        explicit BinaryView(const MappedFile &file) : BinaryView(file.data(), file.size()) {}
+#endif
+
+        /**
+         * @return errc() if the header and the blocks are well-formed, invalid_argument if the data is truncated or
+         * isn't in the format, not_supported for another version of the format (the blocks read before the error
+         * are still available)
+         */
+        [[nodiscard]] inline std::errc status() const noexcept { return m_status; }
+
+        /**
+         * @return The number of values
+         */
+        [[nodiscard]] inline std::size_t size() const noexcept { return m_size; }
+
+        [[nodiscard]] inline bool empty() const noexcept { return m_size == 0; }
+
+        [[nodiscard]] inline std::size_t blockCount() const noexcept { return m_blocks.size(); }
+
+        [[nodiscard]] inline bool isDelta() const noexcept { return m_isDelta; }
+
+        [[nodiscard]] inline Iterator begin() const { return blockBegin(0); }
+
+        [[nodiscard]] inline Iterator end() const { return Iterator(this, m_blocks.size(), m_size); }
+
+        /**
+         * @return An iterator on the first value of a block (end() if there is no such block)
+         */
+        [[nodiscard]] inline Iterator blockBegin(const std::size_t block) const {
+            if (block >= m_blocks.size()) return end();
+            return Iterator(this, block, m_blocks[block].firstIndex);
+        }
+
+        /**
+         * @brief Random access: the block of the value is found by a binary search, then decoded up to the value
+         * @param index Below size()
+         * @return The value at index
+         */
+        [[nodiscard]] RationalType at(const std::size_t index) const {
+            if (index >= m_size) {
+                Tools::RationalTraits<RationalType>::Error::raise(ArkulibError::InvalidAccessArgument);
+                return RationalType();
+            }
+
+            std::size_t low = 0, high = m_blocks.size();
+            while (high - low > 1) {
+                const std::size_t middle = low + (high - low) / 2;
+                if (m_blocks[middle].firstIndex <= index) low = middle;
+                else high = middle;
+            }
+            while (m_blocks[low].count == 0) ++low;
+
+            Iterator iterator = blockBegin(low);
+            for (std::size_t i = m_blocks[low].firstIndex; i < index; ++i) ++iterator;
+            return *iterator;
+        }
+
+    private:
+        struct Block {
+            const unsigned char *payload;
+            const unsigned char *payloadEnd;
+            std::size_t firstIndex; /*!< Index of the first value of the block */
+            std::uint32_t count;
+        };
+
+        std::vector<Block> m_blocks;
+        std::size_t m_size = 0;
+        bool m_isDelta = false;
+        std::errc m_status = std::errc();
+
+        static inline std::uint32_t loadLittleEndian(const unsigned char *input) noexcept {
+            std::uint32_t value = 0;
+            for (int i = 0; i < 4; ++i) value |= static_cast<std::uint32_t>(input[i]) << (8 * i);
+            return value;
+        }
+
+        /**
+         * @brief The rational of a decoded fraction, checked against IntType by the conversion between rationals
+         */
+        static inline RationalType toRational(const std::uint64_t numerator, const std::uint64_t denominator) {
+            using ErrorPolicy = typename Tools::RationalTraits<RationalType>::Error;
+            Rational<std::int64_t, Policies::Lazy, ErrorPolicy> wide(
+                    static_cast<std::int64_t>(numerator), static_cast<std::int64_t>(denominator), false
+            );
+            return RationalType(wide);
+        }
+
+    public:
+        /**
+         * @brief Input iterator decoding the values one at a time
+         */
+        class Iterator {
+
+        public:
+            using iterator_category = std::input_iterator_tag;
+            using value_type = RationalType;
+            using difference_type = std::ptrdiff_t;
+            using pointer = const RationalType *;
+            using reference = const RationalType &;
+
+            Iterator() = default;
+
+            inline reference operator*() const noexcept { return m_value; }
+
+            inline pointer operator->() const noexcept { return &m_value; }
+
+            inline Iterator &operator++() {
+                ++m_index;
+                decode();
+                return *this;
+            }
+
+            inline Iterator operator++(int) {
+                Iterator previous = *this;
+                ++*this;
+                return previous;
+            }
+
+            /**
+             * @return The index of the current value in the view
+             */
+            [[nodiscard]] inline std::size_t index() const noexcept { return m_index; }
+
+            inline friend bool operator==(const Iterator &a, const Iterator &b) noexcept { return a.m_index == b.m_index; }
+
+            inline friend bool operator!=(const Iterator &a, const Iterator &b) noexcept { return a.m_index != b.m_index; }
+
+        private:
+            friend class BinaryView;
+
+            const BinaryView *m_view = nullptr;
+            std::size_t m_block = 0;
+            std::size_t m_index = 0;
+            const unsigned char *m_position = nullptr;
+            std::uint32_t m_remaining = 0; /*!< Values of the current block not decoded yet */
+            std::uint64_t m_numerator = 0, m_denominator = 0;
+            RationalType m_value;
+
+            Iterator(const BinaryView *view, const std::size_t block, const std::size_t index) : m_view(view), m_block(block), m_index(index) {
+                if (block < view->m_blocks.size()) enterBlock();
+                decode();
+            }
+
+            inline void enterBlock() noexcept {
+                const Block &block = m_view->m_blocks[m_block];
+                m_position = block.payload;
+                m_remaining = block.count;
+                m_numerator = m_denominator = 0;
+            }
+
+            void decode() {
+                if (m_index >= m_view->m_size) return;
+                while (m_remaining == 0) {
+                    ++m_block;
+                    enterBlock();
+                }
+
+                // A malformed varint reads as 0 / 0 (DivideByZero) instead of leaving the payload
+                const unsigned char *const payloadEnd = m_view->m_blocks[m_block].payloadEnd;
+                std::uint64_t numerator = 0, denominator = 0;
+                if (!Tools::readVarint(m_position, payloadEnd, numerator) || !Tools::readVarint(m_position, payloadEnd, denominator)) {
+                    m_position = payloadEnd;
+                    numerator = denominator = 0;
+                    m_numerator = m_denominator = 0;
+                }
+                else if (m_view->m_isDelta) {
+                    m_numerator += static_cast<std::uint64_t>(Tools::zigzagDecode(numerator));
+                    m_denominator += static_cast<std::uint64_t>(Tools::zigzagDecode(denominator));
+                    numerator = m_numerator;
+                    denominator = m_denominator;
+                }
+                else {
+                    numerator = static_cast<std::uint64_t>(Tools::zigzagDecode(numerator));
+                    denominator = static_cast<std::uint64_t>(Tools::zigzagDecode(denominator));
+                }
+                --m_remaining;
+                m_value = toRational(numerator, denominator);
+            }
+        };
+    };
+}
@@ -0,0 +1,273 @@
+/**
+ * @file      RationalMap.hpp
+ * @author    Elise MASSA
+ * @author    Mattéo LECLERCQ
+ * @date      2022
+ * @brief     Open-addressing hash map and set keyed by rationals, for the deduplication of large ratio tables
+ * @copyright WTFPL
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "Algorithms.hpp"
+#include "Rational.hpp"
+#include "Tools/Hash.hpp"
+
+namespace Arkulib {
+    /**
+     * @brief Hash map from rationals to values, by open addressing with linear probing. The slots are a structure of
+     * arrays: one control byte per slot (0 if empty, else 7 bits of the hash), the numerators, the denominators and
+     * the values. A probe reads the control bytes and only compares the keys whose 7 bits match: a Rational<int>
+     * key costs 9 bytes per slot. The keys are stored reduced, so 2 / 4 and 1 / 2 are the same key.
+     * The erasure shifts the next keys back (no tombstone).
+     * @tparam RationalType
+     * @tparam Value Default constructible. void gives a set (RationalSet).
+     */
+    template<typename RationalType, typename Value>
+    class RationalMap {
+        using IntType = typename Tools::RationalTraits<RationalType>::Int;
+        using Values = std::conditional_t<std::is_void_v<Value>, std::nullptr_t, std::vector<std::conditional_t<std::is_void_v<Value>, char, Value>>>;
+
+        static constexpr std::size_t MIN_CAPACITY = 16;
+        static constexpr std::uint8_t EMPTY = 0;
+
+    public:
+
+        /************************************************************************************************************
+         ****************************************** CONSTRUCTOR / DESTRUCTOR ****************************************
+         ************************************************************************************************************/
+
+        RationalMap() = default;
+
+        /**
+         * @param expectedSize The table won't grow before this number of keys
+         */
+        explicit RationalMap(const std::size_t expectedSize) { reserve(expectedSize); }
+
+        /************************************************************************************************************
+         ************************************************* CAPACITY *************************************************
+         ************************************************************************************************************/
+
+        [[nodiscard]] inline std::size_t size() const noexcept { return m_size; }
+
+        [[nodiscard]] inline bool empty() const noexcept { return m_size == 0; }
+
+        /**
+         * @return The number of slots (a power of 2, at most 7 / 8 of them are used)
+         */
+        [[nodiscard]] inline std::size_t capacity() const noexcept { return m_controls.size(); }
+
+        /**
+         * @brief Allocate the slots of expectedSize keys
+         */
+        void reserve(const std::size_t expectedSize) {
+            std::size_t capacity = MIN_CAPACITY;
+            while (capacity / 8 * 7 < expectedSize) capacity *= 2;
+            if (capacity > m_controls.size()) rehash(capacity);
+        }
+
+        /**
+         * @brief Remove the keys, the slots are kept
+         */
+        void clear() noexcept {
+            std::fill(m_controls.begin(), m_controls.end(), EMPTY);
+            m_size = 0;
+        }
+
+        /************************************************************************************************************
+         ************************************************* LOOKUP ***************************************************
+         ************************************************************************************************************/
+
+        [[nodiscard]] inline bool contains(const RationalType &key) const { return findSlot(reduce(key)) != NOT_FOUND; }
+
+        /**
+         * @return A pointer to the value of key, nullptr if it isn't in the map
+         */
+        template<typename V = Value, std::enable_if_t<!std::is_void_v<V>, int> = 0>
+        [[nodiscard]] V *find(const RationalType &key) {
+            const std::size_t slot = findSlot(reduce(key));
+            return slot == NOT_FOUND ? nullptr : &m_values[slot];
+        }
+
+        template<typename V = Value, std::enable_if_t<!std::is_void_v<V>, int> = 0>
+        [[nodiscard]] const V *find(const RationalType &key) const {
+            const std::size_t slot = findSlot(reduce(key));
+            return slot == NOT_FOUND ? nullptr : &m_values[slot];
+        }
+
+        /************************************************************************************************************
+         ************************************************ MODIFIERS *************************************************
+         ************************************************************************************************************/
+
+        /**
+         * @brief Insert a key in a set
+         * @return True if the key wasn't already in the set
+         */
+        template<typename V = Value, std::enable_if_t<std::is_void_v<V>, int> = 0>
+        bool insert(const RationalType &key) {
+            return insertSlot(reduce(key)).second;
+        }
+
+        /**
+         * @brief Insert a key and its value, the value of a key already in the map is left unchanged
+         * @return The value of the key and true if it was inserted
+         */
+        template<typename V = Value, std::enable_if_t<!std::is_void_v<V>, int> = 0>
+        std::pair<V *, bool> insert(const RationalType &key, const V &value) {
+            const auto [slot, isInserted] = insertSlot(reduce(key));
+            if (isInserted) m_values[slot] = value;
+            return {&m_values[slot], isInserted};
+        }
+
+        /**
+         * @return The value of key, default constructed if the key is inserted
+         */
+        template<typename V = Value, std::enable_if_t<!std::is_void_v<V>, int> = 0>
+        V &operator[](const RationalType &key) {
+            return m_values[insertSlot(reduce(key)).first];
+        }
+
+        /**
+         * @return True if the key was in the map
+         */
+        bool erase(const RationalType &key) {
+            std::size_t hole = findSlot(reduce(key));
+            if (hole == NOT_FOUND) return false;
+
+            // Backward shift: a following key moves into the hole if the hole is between its home slot and its slot
+            const std::size_t mask = capacity() - 1;
+            for (std::size_t slot = (hole + 1) & mask; m_controls[slot] != EMPTY; slot = (slot + 1) & mask) {
+                const std::size_t home = Tools::hashFraction(m_numerators[slot], m_denominators[slot]) & mask;
+                if (((slot - home) & mask) >= ((slot - hole) & mask)) {
+                    moveSlot(slot, hole);
+                    hole = slot;
+                }
+            }
+            m_controls[hole] = EMPTY;
+            --m_size;
+            return true;
+        }
+
+        /**
+         * @brief Call function(key) for a set, function(key, value) for a map, on every key (in no particular order)
+         */
+        template<typename Function>
+        void forEach(Function &&function) const {
+            for (std::size_t slot = 0; slot < capacity(); ++slot) {
+                if (m_controls[slot] == EMPTY) continue;
+                const RationalType key(m_numerators[slot], m_denominators[slot]);
+                if constexpr (std::is_void_v<Value>) function(key);
+                else function(key, m_values[slot]);
+            }
+        }
+
+    private:
+        static constexpr std::size_t NOT_FOUND = ~std::size_t(0);
+
+        std::vector<std::uint8_t> m_controls;
+        std::vector<IntType> m_numerators;
+        std::vector<IntType> m_denominators;
+        Values m_values{};
+        std::size_t m_size = 0;
+
+        struct Key {
+            IntType numerator;
+            IntType denominator;
+            std::uint64_t hash;
+        };
+
+        static inline Key reduce(const RationalType &key) {
+            if constexpr (Tools::RationalTraits<RationalType>::Normalization::isAlwaysReduced) {
+                return {key.getNumerator(), key.getDenominator(), Tools::hashFraction(key.getNumerator(), key.getDenominator())};
+            }
+            else {
+                const RationalType reduced = key.simplify();
+                return {reduced.getNumerator(), reduced.getDenominator(), Tools::hashFraction(reduced.getNumerator(), reduced.getDenominator())};
+            }
+        }
+
+        // The 7 high bits of the hash, with the high bit set so that it's never EMPTY
+        static constexpr inline std::uint8_t controlOf(const std::uint64_t hash) noexcept {
+            return static_cast<std::uint8_t>((hash >> 57) | 0x80U);
+        }
+
+        std::size_t findSlot(const Key &key) const {
+            if (m_size == 0) return NOT_FOUND;
+            const std::size_t mask = capacity() - 1;
+            const std::uint8_t control = controlOf(key.hash);
+            for (std::size_t slot = key.hash & mask; m_controls[slot] != EMPTY; slot = (slot + 1) & mask) {
+                if (m_controls[slot] == control && m_numerators[slot] == key.numerator && m_denominators[slot] == key.denominator) {
+                    return slot;
+                }
+            }
+            return NOT_FOUND;
+        }
+
+        /**
+         * @return The slot of the key and true if it was inserted
+         */
+        std::pair<std::size_t, bool> insertSlot(const Key &key) {
+            if ((m_size + 1) * 8 > capacity() * 7) rehash(capacity() == 0 ? MIN_CAPACITY : capacity() * 2);
+
+            const std::size_t mask = capacity() - 1;
+            const std::uint8_t control = controlOf(key.hash);
+            std::size_t slot = key.hash & mask;
+            for (; m_controls[slot] != EMPTY; slot = (slot + 1) & mask) {
+                if (m_controls[slot] == control && m_numerators[slot] == key.numerator && m_denominators[slot] == key.denominator) {
+                    return {slot, false};
+                }
+            }
+
+            m_controls[slot] = control;
+            m_numerators[slot] = key.numerator;
+            m_denominators[slot] = key.denominator;
+            if constexpr (!std::is_void_v<Value>) m_values[slot] = Value();
+            ++m_size;
+            return {slot, true};
+        }
+
+        inline void moveSlot(const std::size_t from, const std::size_t to) {
+            m_controls[to] = m_controls[from];
+            m_numerators[to] = std::move(m_numerators[from]);
+            m_denominators[to] = std::move(m_denominators[from]);
+            if constexpr (!std::is_void_v<Value>) m_values[to] = std::move(m_values[from]);
+        }
+
+        void rehash(const std::size_t newCapacity) {
+            RationalMap<RationalType, Value> table;
+            table.m_controls.assign(newCapacity, EMPTY);
+            table.m_numerators.resize(newCapacity);
+            table.m_denominators.resize(newCapacity);
+            if constexpr (!std::is_void_v<Value>) table.m_values.resize(newCapacity);
+
+            const std::size_t mask = newCapacity - 1;
+            for (std::size_t slot = 0; slot < capacity(); ++slot) {
+                if (m_controls[slot] == EMPTY) continue;
+                const std::uint64_t hash = Tools::hashFraction(m_numerators[slot], m_denominators[slot]);
+                std::size_t target = hash & mask;
+                while (table.m_controls[target] != EMPTY) target = (target + 1) & mask;
+
+                table.m_controls[target] = m_controls[slot];
+                table.m_numerators[target] = std::move(m_numerators[slot]);
+                table.m_denominators[target] = std::move(m_denominators[slot]);
+                if constexpr (!std::is_void_v<Value>) table.m_values[target] = std::move(m_values[slot]);
+            }
+            table.m_size = m_size;
+            *this = std::move(table);
+        }
+    };
+
+    /**
+     * @brief Open-addressing hash set of rationals (see RationalMap)
+     * @tparam RationalType
+     */
+    template<typename RationalType>
+    using RationalSet = RationalMap<RationalType, void>;
+}
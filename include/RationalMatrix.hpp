@@ -0,0 +1,814 @@
+/**
+ * @file      RationalMatrix.hpp
+ * @author    Elise MASSA
+ * @author    Mattéo LECLERCQ
+ * @date      2022
+ * @brief     Exact matrix of rationals: determinant, rank, solve and inverse by fraction-free Bareiss elimination
+ *            (integer entries, exact divisions, no gcd per step), a multi-modular solver for the large systems, and
+ *            the classic Gaussian elimination to compare
+ * @copyright WTFPL
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <ostream>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "BigInt.hpp"
+#include "Parallel.hpp"
+#include "Rational.hpp"
+#include "Tools/AlignedAllocator.hpp"
+#include "Tools/Modular.hpp"
+
+namespace Arkulib {
+    /**
+     * @brief Dense matrix of rationals, row-major. Every row starts on a cache line (the stride is padded) and the
+     * product goes through the matrices by blocks, so a block of each operand stays in the cache.
+     * The elimination algorithms work on BigInt: the Bareiss entries are minors of the matrix and may not fit in IntType.
+     * @tparam IntType
+     * @tparam ErrorPolicy
+     */
+    template<typename IntType = long long, typename ErrorPolicy = Policies::DefaultErrorPolicy>
+    class RationalMatrix {
+
+    public:
+        using RationalType = Rational<IntType, Policies::Canonical, ErrorPolicy>;
+
+        /************************************************************************************************************
+         ****************************************** CONSTRUCTOR / DESTRUCTOR ****************************************
+         ************************************************************************************************************/
+
+        /**
+         * @brief Instantiate an empty matrix
+         */
+        inline RationalMatrix() noexcept = default;
+
+        /**
+         * @brief Instantiate a matrix of zeros
+         * @param rowCount
+         * @param columnCount
+         */
+        RationalMatrix(std::size_t rowCount, std::size_t columnCount);
+
+        /**
+         * @brief Create a matrix from its rows. Example: RationalMatrix<>({{1, 2}, {RationalType(1, 3), 4}})
+         * @param rows Must all have the same size
+         */
+        RationalMatrix(std::initializer_list<std::initializer_list<RationalType>> rows);
+
+        /**
+         * @brief The identity matrix
+         * @param size
+         */
+        [[nodiscard]] static RationalMatrix Identity(std::size_t size);
+
+        /************************************************************************************************************
+         ************************************************* ACCESSORS ************************************************
+         ************************************************************************************************************/
+
+        [[nodiscard]] inline std::size_t rowCount() const noexcept { return m_rowCount; }
+
+        [[nodiscard]] inline std::size_t columnCount() const noexcept { return m_columnCount; }
+
+        [[nodiscard]] inline bool isSquare() const noexcept { return m_rowCount == m_columnCount; }
+
+        /**
+         * @brief The element at (row, column), without bound checking
+         */
+        [[nodiscard]] inline const RationalType &operator()(const std::size_t row, const std::size_t column) const noexcept {
+            return m_elements[row * m_stride + column];
+        }
+
+        inline RationalType &operator()(const std::size_t row, const std::size_t column) noexcept {
+            return m_elements[row * m_stride + column];
+        }
+
+        /**
+         * @brief The element at (row, column). InvalidAccessArgument is raised when it's outside of the matrix.
+         */
+        [[nodiscard]] const RationalType &at(std::size_t row, std::size_t column) const noexcept(ErrorPolicy::isNoexcept);
+
+        /************************************************************************************************************
+         ************************************************* OPERATORS ************************************************
+         ************************************************************************************************************/
+
+        RationalMatrix operator+(const RationalMatrix &anotherMatrix) const;
+
+        RationalMatrix operator-(const RationalMatrix &anotherMatrix) const;
+
+        /**
+         * @brief Product by blocks of BLOCK_SIZE x BLOCK_SIZE
+         */
+        RationalMatrix operator*(const RationalMatrix &anotherMatrix) const;
+
+        bool operator==(const RationalMatrix &anotherMatrix) const noexcept;
+
+        inline bool operator!=(const RationalMatrix &anotherMatrix) const noexcept { return !(*this == anotherMatrix); }
+
+        [[nodiscard]] RationalMatrix transpose() const;
+
+        /************************************************************************************************************
+         ********************************************* BAREISS ELIMINATION ******************************************
+         ************************************************************************************************************/
+
+        /**
+         * @brief Determinant by Bareiss elimination. Every row is multiplied by the lcm of its denominators, then the
+         * k-th step computes the minors of order k + 1: a(i, j) = (a(k, k) * a(i, j) - a(i, k) * a(k, j)) / a(k-1, k-1).
+         * The divisions are exact, so the entries stay integers without any gcd.
+         * @return The determinant (InvalidAccessArgument is raised if the matrix isn't square)
+         */
+        [[nodiscard]] RationalType determinant() const;
+
+        /**
+         * @brief Rank by Bareiss elimination
+         */
+        [[nodiscard]] std::size_t rank() const;
+
+        /**
+         * @brief Solve this * x = rightHandSide by fraction-free Gauss-Jordan elimination (Bareiss on every row).
+         * At the end every diagonal entry is the determinant of the scaled system and x = column / determinant.
+         * @param rightHandSide One column per system to solve
+         * @return x (DivideByZero is raised if the matrix is singular)
+         */
+        [[nodiscard]] RationalMatrix solve(const RationalMatrix &rightHandSide) const;
+
+        /**
+         * @return The inverse (DivideByZero is raised if the matrix is singular)
+         */
+        [[nodiscard]] inline RationalMatrix inverse() const { return solve(Identity(m_rowCount)); }
+
+#ifdef __SIZEOF_INT128__
+        /************************************************************************************************************
+         ******************************************** MULTI-MODULAR SOLVER ******************************************
+         ************************************************************************************************************/
+
+        /**
+         * @brief Solve this * x = rightHandSide modulo 63-bit primes, in parallel (the primes are independent).
+         * The residues are combined by the Chinese remainder theorem and x is found back by rational reconstruction.
+         * It stops as soon as a reconstructed x is confirmed by the primes of the next round, or when the product of
+         * the primes exceeds the Hadamard bound of the solution (then the reconstruction is certain).
+         * Unlike Bareiss, the size of the numbers stays a word during the elimination: it's the fast way for the
+         * large systems (hundreds of rows).
+         * @param rightHandSide One column per system to solve
+         * @param options The number of threads (the chunk size is unused)
+         * @return x (DivideByZero is raised if the matrix is singular)
+         */
+        [[nodiscard]] RationalMatrix solveModular(const RationalMatrix &rightHandSide, const Parallel::Options &options = {}) const;
+#endif
+
+        /************************************************************************************************************
+         ******************************************** GAUSSIAN ELIMINATION ******************************************
+         ************************************************************************************************************/
+
+        /**
+         * @brief Determinant by the classic Gaussian elimination on rationals (a gcd per operation, and the partial
+         * results must fit in IntType). The pivot is the largest element of the column in absolute value.
+         */
+        [[nodiscard]] RationalType determinantGaussian() const;
+
+        /**
+         * @brief Solve this * x = rightHandSide by the classic Gauss-Jordan elimination on rationals
+         */
+        [[nodiscard]] RationalMatrix solveGaussian(const RationalMatrix &rightHandSide) const;
+
+        /************************************************************************************************************
+         ************************************************** OTHERS **************************************************
+         ************************************************************************************************************/
+
+        template<typename AnotherIntType, typename AnotherErrorPolicy>
+        friend std::ostream &operator<<(std::ostream &stream, const RationalMatrix<AnotherIntType, AnotherErrorPolicy> &matrix);
+
+    private:
+        static constexpr std::size_t CACHE_LINE = 64;
+        static constexpr std::size_t BLOCK_SIZE = 32;
+
+        // Number of elements in a cache line (at least 1)
+        static constexpr std::size_t LINE_ELEMENTS = sizeof(RationalType) >= CACHE_LINE ? 1 : CACHE_LINE / sizeof(RationalType);
+
+        std::vector<RationalType, Tools::AlignedAllocator<RationalType, CACHE_LINE>> m_elements;
+        std::size_t m_rowCount = 0;
+        std::size_t m_columnCount = 0;
+        std::size_t m_stride = 0;
+
+        /**
+         * @brief Integer matrix of BigInt, row-major, for the eliminations
+         */
+        struct IntegerMatrix {
+            std::vector<BigInt> entries;
+            std::size_t columnCount = 0;
+
+            inline BigInt &operator()(const std::size_t row, const std::size_t column) { return entries[row * columnCount + column]; }
+
+            inline const BigInt &operator()(const std::size_t row, const std::size_t column) const { return entries[row * columnCount + column]; }
+        };
+
+        /**
+         * @brief Multiply every row of [this | rightHandSide] by the lcm of its denominators
+         * @param rightHandSide Can be null
+         * @param scales If not null, receives the product of the row multipliers
+         */
+        IntegerMatrix toIntegerMatrix(const RationalMatrix *rightHandSide, BigInt *scales) const;
+
+        /**
+         * @brief Bareiss forward elimination, columns without pivot are skipped
+         * @return The rank. The last pivot and the sign of the row permutation are given when not null.
+         */
+        static std::size_t bareissForward(IntegerMatrix &matrix, std::size_t rowCount, std::size_t columnCount, BigInt *lastPivot, int *sign);
+
+        /**
+         * @brief The rational numerator / denominator. NumberTooLarge is raised if it doesn't fit in IntType.
+         */
+        static RationalType fromBigFraction(BigInt numerator, BigInt denominator);
+
+#ifdef __SIZEOF_INT128__
+        /**
+         * @brief Solve the integer system [A | B] modulo a prime by Gaussian elimination in the Montgomery form
+         * @param matrix The augmented matrix, with size rows
+         * @param size
+         * @param prime
+         * @param solution Receives the size x (columnCount - size) residues of x, row-major
+         * @return False if A is singular modulo prime
+         */
+        static bool solveModuloPrime(const IntegerMatrix &matrix, std::size_t size, std::uint64_t prime, std::vector<std::uint64_t> &solution);
+#endif
+
+        /**
+         * @brief Row of the largest element in absolute value in the column, from the row first (exact comparison)
+         */
+        std::size_t gaussianPivot(std::size_t column, std::size_t first) const;
+
+        inline void swapRows(const std::size_t row1, const std::size_t row2) {
+            std::swap_ranges(
+                    m_elements.begin() + static_cast<std::ptrdiff_t>(row1 * m_stride),
+                    m_elements.begin() + static_cast<std::ptrdiff_t>(row1 * m_stride + m_columnCount),
+                    m_elements.begin() + static_cast<std::ptrdiff_t>(row2 * m_stride)
+            );
+        }
+    };
+
+
+
+
+    /************************************************************************************************************
+     ************************************************************************************************************/
+
+
+
+
+    /************************************************************************************************************
+     ****************************************** CONSTRUCTOR / DESTRUCTOR ****************************************
+     ************************************************************************************************************/
+
+    template<typename IntType, typename ErrorPolicy>
+    RationalMatrix<IntType, ErrorPolicy>::RationalMatrix(const std::size_t rowCount, const std::size_t columnCount)
+            : m_rowCount(rowCount), m_columnCount(columnCount),
+              m_stride((columnCount + LINE_ELEMENTS - 1) / LINE_ELEMENTS * LINE_ELEMENTS) {
+        m_elements.resize(m_rowCount * m_stride);
+    }
+
+    template<typename IntType, typename ErrorPolicy>
+    RationalMatrix<IntType, ErrorPolicy>::RationalMatrix(const std::initializer_list<std::initializer_list<RationalType>> rows)
+            : RationalMatrix(rows.size(), rows.size() == 0 ? 0 : rows.begin()->size()) {
+        std::size_t row = 0;
+        for (const auto &elements: rows) {
+            if (elements.size() != m_columnCount) {
+                ErrorPolicy::raise(ArkulibError::InvalidAccessArgument);
+                return;
+            }
+            std::copy(elements.begin(), elements.end(), m_elements.begin() + static_cast<std::ptrdiff_t>(row++ * m_stride));
+        }
+    }
+
+    template<typename IntType, typename ErrorPolicy>
+    RationalMatrix<IntType, ErrorPolicy> RationalMatrix<IntType, ErrorPolicy>::Identity(const std::size_t size) {
+        RationalMatrix identity(size, size);
+        for (std::size_t i = 0; i < size; ++i) identity(i, i) = RationalType(1, 1);
+        return identity;
+    }
+
+    /************************************************************************************************************
+     ************************************************* ACCESSORS ************************************************
+     ************************************************************************************************************/
+
+    template<typename IntType, typename ErrorPolicy>
+    const typename RationalMatrix<IntType, ErrorPolicy>::RationalType &
+    RationalMatrix<IntType, ErrorPolicy>::at(const std::size_t row, const std::size_t column) const noexcept(ErrorPolicy::isNoexcept) {
+        if (row >= m_rowCount || column >= m_columnCount) {
+            ErrorPolicy::raise(ArkulibError::InvalidAccessArgument);
+            static const RationalType zero;
+            return zero;
+        }
+        return (*this)(row, column);
+    }
+
+    /************************************************************************************************************
+     ************************************************* OPERATORS ************************************************
+     ************************************************************************************************************/
+
+    template<typename IntType, typename ErrorPolicy>
+    RationalMatrix<IntType, ErrorPolicy> RationalMatrix<IntType, ErrorPolicy>::operator+(const RationalMatrix &anotherMatrix) const {
+        if (m_rowCount != anotherMatrix.m_rowCount || m_columnCount != anotherMatrix.m_columnCount) {
+            ErrorPolicy::raise(ArkulibError::InvalidAccessArgument);
+            return {};
+        }
+        RationalMatrix result(m_rowCount, m_columnCount);
+        for (std::size_t i = 0; i < m_rowCount; ++i) {
+            for (std::size_t j = 0; j < m_columnCount; ++j) result(i, j) = (*this)(i, j) + anotherMatrix(i, j);
+        }
+        return result;
+    }
+
+    template<typename IntType, typename ErrorPolicy>
+    RationalMatrix<IntType, ErrorPolicy> RationalMatrix<IntType, ErrorPolicy>::operator-(const RationalMatrix &anotherMatrix) const {
+        if (m_rowCount != anotherMatrix.m_rowCount || m_columnCount != anotherMatrix.m_columnCount) {
+            ErrorPolicy::raise(ArkulibError::InvalidAccessArgument);
+            return {};
+        }
+        RationalMatrix result(m_rowCount, m_columnCount);
+        for (std::size_t i = 0; i < m_rowCount; ++i) {
+            for (std::size_t j = 0; j < m_columnCount; ++j) result(i, j) = (*this)(i, j) - anotherMatrix(i, j);
+        }
+        return result;
+    }
+
+    template<typename IntType, typename ErrorPolicy>
+    RationalMatrix<IntType, ErrorPolicy> RationalMatrix<IntType, ErrorPolicy>::operator*(const RationalMatrix &anotherMatrix) const {
+        if (m_columnCount != anotherMatrix.m_rowCount) {
+            ErrorPolicy::raise(ArkulibError::InvalidAccessArgument);
+            return {};
+        }
+        RationalMatrix result(m_rowCount, anotherMatrix.m_columnCount);
+
+        // i-k-j order inside the blocks: the innermost loop goes along the rows of the result and of anotherMatrix
+        for (std::size_t iBlock = 0; iBlock < m_rowCount; iBlock += BLOCK_SIZE) {
+            for (std::size_t kBlock = 0; kBlock < m_columnCount; kBlock += BLOCK_SIZE) {
+                for (std::size_t jBlock = 0; jBlock < anotherMatrix.m_columnCount; jBlock += BLOCK_SIZE) {
+                    const std::size_t iEnd = std::min(iBlock + BLOCK_SIZE, m_rowCount);
+                    const std::size_t kEnd = std::min(kBlock + BLOCK_SIZE, m_columnCount);
+                    const std::size_t jEnd = std::min(jBlock + BLOCK_SIZE, anotherMatrix.m_columnCount);
+                    for (std::size_t i = iBlock; i < iEnd; ++i) {
+                        for (std::size_t k = kBlock; k < kEnd; ++k) {
+                            const RationalType &factor = (*this)(i, k);
+                            if (factor.isZero()) continue;
+                            for (std::size_t j = jBlock; j < jEnd; ++j) result(i, j) += factor * anotherMatrix(k, j);
+                        }
+                    }
+                }
+            }
+        }
+        return result;
+    }
+
+    template<typename IntType, typename ErrorPolicy>
+    bool RationalMatrix<IntType, ErrorPolicy>::operator==(const RationalMatrix &anotherMatrix) const noexcept {
+        if (m_rowCount != anotherMatrix.m_rowCount || m_columnCount != anotherMatrix.m_columnCount) return false;
+        for (std::size_t i = 0; i < m_rowCount; ++i) {
+            for (std::size_t j = 0; j < m_columnCount; ++j) if ((*this)(i, j) != anotherMatrix(i, j)) return false;
+        }
+        return true;
+    }
+
+    template<typename IntType, typename ErrorPolicy>
+    RationalMatrix<IntType, ErrorPolicy> RationalMatrix<IntType, ErrorPolicy>::transpose() const {
+        RationalMatrix result(m_columnCount, m_rowCount);
+        for (std::size_t i = 0; i < m_rowCount; ++i) {
+            for (std::size_t j = 0; j < m_columnCount; ++j) result(j, i) = (*this)(i, j);
+        }
+        return result;
+    }
+
+    /************************************************************************************************************
+     ********************************************* BAREISS ELIMINATION ******************************************
+     ************************************************************************************************************/
+
+    template<typename IntType, typename ErrorPolicy>
+    typename RationalMatrix<IntType, ErrorPolicy>::IntegerMatrix
+    RationalMatrix<IntType, ErrorPolicy>::toIntegerMatrix(const RationalMatrix *rightHandSide, BigInt *scales) const {
+        const std::size_t extraColumns = rightHandSide ? rightHandSide->m_columnCount : 0;
+        IntegerMatrix matrix;
+        matrix.columnCount = m_columnCount + extraColumns;
+        matrix.entries.resize(m_rowCount * matrix.columnCount);
+        if (scales) *scales = BigInt(1);
+
+        const auto elementOf = [&](const std::size_t row, const std::size_t column) -> const RationalType & {
+            return column < m_columnCount ? (*this)(row, column) : (*rightHandSide)(row, column - m_columnCount);
+        };
+
+        for (std::size_t i = 0; i < m_rowCount; ++i) {
+            // The lcm of the denominators: most of the time they divide it already, a modulo is enough
+            BigInt multiplier(1);
+            for (std::size_t j = 0; j < matrix.columnCount; ++j) {
+                const BigInt denominator(elementOf(i, j).getDenominator());
+                if (!(multiplier % denominator).isZero()) multiplier = multiplier / BigInt::gcd(multiplier, denominator) * denominator;
+            }
+            for (std::size_t j = 0; j < matrix.columnCount; ++j) {
+                const RationalType &element = elementOf(i, j);
+                matrix(i, j) = BigInt(element.getNumerator()) * (multiplier / BigInt(element.getDenominator()));
+            }
+            if (scales) *scales *= multiplier;
+        }
+        return matrix;
+    }
+
+    template<typename IntType, typename ErrorPolicy>
+    std::size_t RationalMatrix<IntType, ErrorPolicy>::bareissForward(
+            IntegerMatrix &matrix, const std::size_t rowCount, const std::size_t columnCount, BigInt *lastPivot, int *sign
+    ) {
+        BigInt previousPivot(1);
+        std::size_t rank = 0;
+        if (sign) *sign = 1;
+
+        for (std::size_t column = 0; column < columnCount && rank < rowCount; ++column) {
+            std::size_t pivotRow = rank;
+            while (pivotRow < rowCount && matrix(pivotRow, column).isZero()) ++pivotRow;
+            if (pivotRow == rowCount) continue;
+            if (pivotRow != rank) {
+                for (std::size_t j = 0; j < matrix.columnCount; ++j) std::swap(matrix(pivotRow, j), matrix(rank, j));
+                if (sign) *sign = -*sign;
+            }
+
+            const BigInt &pivot = matrix(rank, column);
+            for (std::size_t i = rank + 1; i < rowCount; ++i) {
+                const BigInt factor = matrix(i, column);
+                for (std::size_t j = column + 1; j < matrix.columnCount; ++j) {
+                    matrix(i, j) = (pivot * matrix(i, j) - factor * matrix(rank, j)) / previousPivot;
+                }
+                matrix(i, column) = BigInt();
+            }
+            previousPivot = pivot;
+            ++rank;
+        }
+        if (lastPivot) *lastPivot = previousPivot;
+        return rank;
+    }
+
+    template<typename IntType, typename ErrorPolicy>
+    typename RationalMatrix<IntType, ErrorPolicy>::RationalType
+    RationalMatrix<IntType, ErrorPolicy>::fromBigFraction(BigInt numerator, BigInt denominator) {
+        if (denominator.isNegative()) {
+            numerator = -numerator;
+            denominator = -denominator;
+        }
+        const BigInt divisor = BigInt::gcd(numerator, denominator);
+        if (divisor != BigInt(1)) {
+            numerator /= divisor;
+            denominator /= divisor;
+        }
+        if constexpr (std::is_same_v<IntType, BigInt>) {
+            return RationalType(numerator, denominator);
+        }
+        else {
+            if (!Tools::fitsIn<IntType>(numerator) || !Tools::fitsIn<IntType>(denominator)) {
+                ErrorPolicy::raise(ArkulibError::NumberTooLarge);
+                return RationalType();
+            }
+            return RationalType(static_cast<IntType>(numerator), static_cast<IntType>(denominator));
+        }
+    }
+
+    template<typename IntType, typename ErrorPolicy>
+    typename RationalMatrix<IntType, ErrorPolicy>::RationalType RationalMatrix<IntType, ErrorPolicy>::determinant() const {
+        if (!isSquare()) {
+            ErrorPolicy::raise(ArkulibError::InvalidAccessArgument);
+            return RationalType();
+        }
+        if (m_rowCount == 0) return RationalType(1, 1);
+
+        // det(A) = det(scaled A) / (product of the row multipliers)
+        BigInt scales, lastPivot;
+        int sign = 1;
+        IntegerMatrix matrix = toIntegerMatrix(nullptr, &scales);
+        if (bareissForward(matrix, m_rowCount, m_columnCount, &lastPivot, &sign) < m_rowCount) return RationalType();
+        return fromBigFraction(sign < 0 ? -lastPivot : lastPivot, scales);
+    }
+
+    template<typename IntType, typename ErrorPolicy>
+    std::size_t RationalMatrix<IntType, ErrorPolicy>::rank() const {
+        IntegerMatrix matrix = toIntegerMatrix(nullptr, nullptr);
+        return bareissForward(matrix, m_rowCount, m_columnCount, nullptr, nullptr);
+    }
+
+    template<typename IntType, typename ErrorPolicy>
+    RationalMatrix<IntType, ErrorPolicy> RationalMatrix<IntType, ErrorPolicy>::solve(const RationalMatrix &rightHandSide) const {
+        if (!isSquare() || rightHandSide.m_rowCount != m_rowCount) {
+            ErrorPolicy::raise(ArkulibError::InvalidAccessArgument);
+            return {};
+        }
+        const std::size_t size = m_rowCount;
+        IntegerMatrix matrix = toIntegerMatrix(&rightHandSide, nullptr);
+
+        // Fraction-free Gauss-Jordan: the rows above the pivot are eliminated too, every division stays exact
+        BigInt previousPivot(1);
+        for (std::size_t k = 0; k < size; ++k) {
+            std::size_t pivotRow = k;
+            while (pivotRow < size && matrix(pivotRow, k).isZero()) ++pivotRow;
+            if (pivotRow == size) {
+                ErrorPolicy::raise(ArkulibError::DivideByZero);
+                return {};
+            }
+            if (pivotRow != k) {
+                for (std::size_t j = 0; j < matrix.columnCount; ++j) std::swap(matrix(pivotRow, j), matrix(k, j));
+            }
+
+            const BigInt &pivot = matrix(k, k);
+            for (std::size_t i = 0; i < size; ++i) {
+                if (i == k) continue;
+                const BigInt factor = matrix(i, k);
+                for (std::size_t j = 0; j < matrix.columnCount; ++j) {
+                    if (j == k) continue;
+                    matrix(i, j) = (pivot * matrix(i, j) - factor * matrix(k, j)) / previousPivot;
+                }
+                matrix(i, k) = BigInt();
+            }
+            previousPivot = pivot;
+        }
+
+        // Every diagonal entry is now the determinant of the scaled matrix
+        RationalMatrix solution(size, rightHandSide.m_columnCount);
+        for (std::size_t i = 0; i < size; ++i) {
+            for (std::size_t j = 0; j < rightHandSide.m_columnCount; ++j) {
+                solution(i, j) = fromBigFraction(matrix(i, size + j), previousPivot);
+            }
+        }
+        return solution;
+    }
+
+#ifdef __SIZEOF_INT128__
+    /************************************************************************************************************
+     ******************************************** MULTI-MODULAR SOLVER ******************************************
+     ************************************************************************************************************/
+
+    template<typename IntType, typename ErrorPolicy>
+    bool RationalMatrix<IntType, ErrorPolicy>::solveModuloPrime(
+            const IntegerMatrix &matrix, const std::size_t size, const std::uint64_t prime, std::vector<std::uint64_t> &solution
+    ) {
+        const Tools::Montgomery arithmetic(prime);
+        const std::size_t columnCount = matrix.columnCount;
+        std::vector<std::uint64_t> residues(matrix.entries.size());
+        for (std::size_t i = 0; i < residues.size(); ++i) residues[i] = arithmetic.toMontgomery(matrix.entries[i].residue(prime));
+        const auto entry = [&](const std::size_t row, const std::size_t column) -> std::uint64_t & {
+            return residues[row * columnCount + column];
+        };
+
+        // Forward elimination, every pivot row is scaled to 1
+        for (std::size_t k = 0; k < size; ++k) {
+            std::size_t pivotRow = k;
+            while (pivotRow < size && entry(pivotRow, k) == 0) ++pivotRow;
+            if (pivotRow == size) return false;
+            if (pivotRow != k) {
+                std::swap_ranges(&entry(k, k), &entry(k, 0) + columnCount, &entry(pivotRow, k));
+            }
+
+            const std::uint64_t inverse = arithmetic.inverse(entry(k, k));
+            for (std::size_t j = k; j < columnCount; ++j) entry(k, j) = arithmetic.multiply(entry(k, j), inverse);
+            const std::uint64_t *pivotLine = &entry(k, 0);
+            for (std::size_t i = k + 1; i < size; ++i) {
+                const std::uint64_t factor = entry(i, k);
+                if (factor == 0) continue;
+                std::uint64_t *line = &entry(i, 0);
+                for (std::size_t j = k; j < columnCount; ++j) {
+                    line[j] = arithmetic.subtract(line[j], arithmetic.multiply(factor, pivotLine[j]));
+                }
+            }
+        }
+
+        // Back substitution on the right-hand side columns
+        const std::size_t extraColumns = columnCount - size;
+        solution.assign(size * extraColumns, 0);
+        for (std::size_t i = size; i-- > 0;) {
+            for (std::size_t j = 0; j < extraColumns; ++j) {
+                std::uint64_t value = entry(i, size + j);
+                for (std::size_t k = i + 1; k < size; ++k) {
+                    value = arithmetic.subtract(value, arithmetic.multiply(entry(i, k), solution[k * extraColumns + j]));
+                }
+                solution[i * extraColumns + j] = value;
+            }
+        }
+        for (std::uint64_t &value: solution) value = arithmetic.fromMontgomery(value);
+        return true;
+    }
+
+    template<typename IntType, typename ErrorPolicy>
+    RationalMatrix<IntType, ErrorPolicy> RationalMatrix<IntType, ErrorPolicy>::solveModular(
+            const RationalMatrix &rightHandSide, const Parallel::Options &options
+    ) const {
+        if (!isSquare() || rightHandSide.m_rowCount != m_rowCount) {
+            ErrorPolicy::raise(ArkulibError::InvalidAccessArgument);
+            return {};
+        }
+        constexpr std::size_t PRIME_BITS = 62;
+        const std::size_t size = m_rowCount, extraColumns = rightHandSide.m_columnCount, entryCount = size * extraColumns;
+        if (entryCount == 0) return RationalMatrix(size, extraColumns);
+        const IntegerMatrix matrix = toIntegerMatrix(&rightHandSide, nullptr);
+
+        // Hadamard bound: by Cramer's rule, the numerators and the denominator of x are determinants of n columns of
+        // [A | B], so they are below the product of the row norms: prod(sqrt(n + k) * 2^(largest bit length of the row))
+        std::size_t logSqrt = 0;
+        while ((std::size_t(1) << (2 * logSqrt)) < matrix.columnCount) ++logSqrt;
+        std::size_t hadamardBits = 0;
+        for (std::size_t i = 0; i < size; ++i) {
+            std::size_t rowBits = 0;
+            for (std::size_t j = 0; j < matrix.columnCount; ++j) rowBits = std::max(rowBits, matrix(i, j).bitLength());
+            hadamardBits += rowBits + logSqrt;
+        }
+        // A non-singular matrix is singular modulo at most hadamardBits / PRIME_BITS primes: they divide its determinant
+        const std::size_t maxUnluckyPrimes = hadamardBits / PRIME_BITS;
+
+        std::size_t threadCount = options.threadCount;
+        if (threadCount == 0) threadCount = std::max(1U, std::thread::hardware_concurrency());
+        const std::size_t primesPerRound = std::max<std::size_t>(threadCount, 2);
+
+        std::uint64_t nextPrime = std::uint64_t(1) << 63;
+        std::size_t unluckyPrimes = 0;
+        BigInt modulus(1);
+        std::vector<BigInt> combined(entryCount);
+        std::vector<BigInt> numerators(entryCount), denominators(entryCount);
+        bool hasCandidate = false;
+        BigInt previousNumerator, previousDenominator(0);
+
+        while (true) {
+            std::vector<std::uint64_t> primes(primesPerRound);
+            for (std::uint64_t &prime: primes) prime = nextPrime = Tools::previousPrime(nextPrime);
+
+            std::vector<std::vector<std::uint64_t>> residues(primesPerRound);
+            std::vector<char> isLucky(primesPerRound);
+            Tools::forEachChunk(primesPerRound, threadCount, [&](const std::size_t chunk) {
+                isLucky[chunk] = solveModuloPrime(matrix, size, primes[chunk], residues[chunk]);
+            });
+
+            // The candidate of the previous round must agree with every new residue: numerator = residue * denominator
+            bool isConfirmed = hasCandidate;
+            std::size_t checkedPrimes = 0;
+            for (std::size_t p = 0; p < primesPerRound; ++p) {
+                if (!isLucky[p]) {
+                    if (++unluckyPrimes > maxUnluckyPrimes) {
+                        ErrorPolicy::raise(ArkulibError::DivideByZero);
+                        return {};
+                    }
+                    continue;
+                }
+                ++checkedPrimes;
+                const Tools::Montgomery arithmetic(primes[p]);
+                for (std::size_t i = 0; i < entryCount && isConfirmed; ++i) {
+                    const std::uint64_t product = arithmetic.fromMontgomery(arithmetic.multiply(
+                            arithmetic.toMontgomery(residues[p][i]), arithmetic.toMontgomery(denominators[i].residue(primes[p]))
+                    ));
+                    isConfirmed = isConfirmed && product == numerators[i].residue(primes[p]);
+                }
+            }
+            if (isConfirmed && checkedPrimes > 0) break;
+            hasCandidate = false;
+
+            // Chinese remainder theorem: x = x + modulus * ((r - x) / modulus mod p), then modulus *= p
+            for (std::size_t p = 0; p < primesPerRound; ++p) {
+                if (!isLucky[p]) continue;
+                const Tools::Montgomery arithmetic(primes[p]);
+                const std::uint64_t inverse = arithmetic.inverse(arithmetic.toMontgomery(modulus.residue(primes[p])));
+                for (std::size_t i = 0; i < entryCount; ++i) {
+                    const std::uint64_t difference = arithmetic.subtract(
+                            arithmetic.toMontgomery(residues[p][i]), arithmetic.toMontgomery(combined[i].residue(primes[p]))
+                    );
+                    const std::uint64_t factor = arithmetic.fromMontgomery(arithmetic.multiply(difference, inverse));
+                    if (factor != 0) combined[i] += modulus * BigInt(factor);
+                }
+                modulus *= BigInt(primes[p]);
+            }
+            if (modulus == BigInt(1)) continue;
+
+            // |numerator|, denominator < 2^half with 2 * 2^(2 * half) < modulus
+            const std::size_t modulusBits = modulus.bitLength();
+            const bool isCertain = modulusBits > 2 * hadamardBits + 2;
+            std::size_t half = (modulusBits - 2) / 2;
+            BigInt bound(1);
+            for (BigInt power(2); half != 0; half >>= 1, power *= power) if (half & 1U) bound *= power;
+
+            // Cheap probe on the last entry: the whole vector is reconstructed when it stops changing
+            BigInt probeNumerator, probeDenominator;
+            if (!isCertain) {
+                if (!Tools::rationalReconstruction(combined.back(), modulus, bound, probeNumerator, probeDenominator)) continue;
+                const bool isStable = probeNumerator == previousNumerator && probeDenominator == previousDenominator;
+                previousNumerator = probeNumerator;
+                previousDenominator = probeDenominator;
+                if (!isStable) continue;
+            }
+
+            hasCandidate = true;
+            for (std::size_t i = 0; i < entryCount && hasCandidate; ++i) {
+                hasCandidate = Tools::rationalReconstruction(combined[i], modulus, bound, numerators[i], denominators[i]);
+            }
+            if (hasCandidate && isCertain) break;
+        }
+
+        RationalMatrix solution(size, extraColumns);
+        for (std::size_t i = 0; i < size; ++i) {
+            for (std::size_t j = 0; j < extraColumns; ++j) {
+                solution(i, j) = fromBigFraction(numerators[i * extraColumns + j], denominators[i * extraColumns + j]);
+            }
+        }
+        return solution;
+    }
+#endif
+
+    /************************************************************************************************************
+     ******************************************** GAUSSIAN ELIMINATION ******************************************
+     ************************************************************************************************************/
+
+    template<typename IntType, typename ErrorPolicy>
+    std::size_t RationalMatrix<IntType, ErrorPolicy>::gaussianPivot(const std::size_t column, const std::size_t first) const {
+        std::size_t pivotRow = first;
+        RationalType largest = (*this)(first, column).abs();
+        for (std::size_t i = first + 1; i < m_rowCount; ++i) {
+            const RationalType candidate = (*this)(i, column).abs();
+            if (largest < candidate) {
+                largest = candidate;
+                pivotRow = i;
+            }
+        }
+        return pivotRow;
+    }
+
+    template<typename IntType, typename ErrorPolicy>
+    typename RationalMatrix<IntType, ErrorPolicy>::RationalType RationalMatrix<IntType, ErrorPolicy>::determinantGaussian() const {
+        if (!isSquare()) {
+            ErrorPolicy::raise(ArkulibError::InvalidAccessArgument);
+            return RationalType();
+        }
+        RationalMatrix matrix = *this;
+        RationalType determinant(1, 1);
+        for (std::size_t k = 0; k < m_rowCount; ++k) {
+            const std::size_t pivotRow = matrix.gaussianPivot(k, k);
+            if (matrix(pivotRow, k).isZero()) return RationalType();
+            if (pivotRow != k) {
+                matrix.swapRows(pivotRow, k);
+                determinant = -determinant;
+            }
+
+            const RationalType pivot = matrix(k, k);
+            determinant *= pivot;
+            for (std::size_t i = k + 1; i < m_rowCount; ++i) {
+                if (matrix(i, k).isZero()) continue;
+                const RationalType factor = matrix(i, k) / pivot;
+                for (std::size_t j = k + 1; j < m_columnCount; ++j) matrix(i, j) -= factor * matrix(k, j);
+            }
+        }
+        return determinant;
+    }
+
+    template<typename IntType, typename ErrorPolicy>
+    RationalMatrix<IntType, ErrorPolicy> RationalMatrix<IntType, ErrorPolicy>::solveGaussian(const RationalMatrix &rightHandSide) const {
+        if (!isSquare() || rightHandSide.m_rowCount != m_rowCount) {
+            ErrorPolicy::raise(ArkulibError::InvalidAccessArgument);
+            return {};
+        }
+        const std::size_t size = m_rowCount, extraColumns = rightHandSide.m_columnCount;
+
+        // The augmented matrix [this | rightHandSide]
+        RationalMatrix matrix(size, size + extraColumns);
+        for (std::size_t i = 0; i < size; ++i) {
+            for (std::size_t j = 0; j < size; ++j) matrix(i, j) = (*this)(i, j);
+            for (std::size_t j = 0; j < extraColumns; ++j) matrix(i, size + j) = rightHandSide(i, j);
+        }
+
+        for (std::size_t k = 0; k < size; ++k) {
+            const std::size_t pivotRow = matrix.gaussianPivot(k, k);
+            if (matrix(pivotRow, k).isZero()) {
+                ErrorPolicy::raise(ArkulibError::DivideByZero);
+                return {};
+            }
+            if (pivotRow != k) matrix.swapRows(pivotRow, k);
+
+            const RationalType pivot = matrix(k, k);
+            for (std::size_t j = k; j < matrix.m_columnCount; ++j) matrix(k, j) /= pivot;
+            for (std::size_t i = 0; i < size; ++i) {
+                if (i == k || matrix(i, k).isZero()) continue;
+                const RationalType factor = matrix(i, k);
+                for (std::size_t j = k; j < matrix.m_columnCount; ++j) matrix(i, j) -= factor * matrix(k, j);
+            }
+        }
+
+        RationalMatrix solution(size, extraColumns);
+        for (std::size_t i = 0; i < size; ++i) {
+            for (std::size_t j = 0; j < extraColumns; ++j) solution(i, j) = matrix(i, size + j);
+        }
+        return solution;
+    }
+
+    /************************************************************************************************************
+     ************************************************** OTHERS **************************************************
+     ************************************************************************************************************/
+
+    template<typename IntType, typename ErrorPolicy>
+    std::ostream &operator<<(std::ostream &stream, const RationalMatrix<IntType, ErrorPolicy> &matrix) {
+        for (std::size_t i = 0; i < matrix.rowCount(); ++i) {
+            stream << '[';
+            for (std::size_t j = 0; j < matrix.columnCount(); ++j) stream << (j == 0 ? "" : ", ") << matrix(i, j);
+            stream << "]\n";
+        }
+        return stream;
+    }
+}
@@ -0,0 +1,400 @@
+/**
+ * @file      RationalPolynomial.hpp
+ * @author    Elise MASSA
+ * @author    Mattéo LECLERCQ
+ * @date      2022
+ * @brief     Polynomial with rational coefficients, kept over the lcm of their denominators: the evaluation at a
+ *            rational is a Horner scheme on integers with a single gcd, the product a Karatsuba product of integers
+ * @copyright WTFPL
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <ostream>
+#include <utility>
+#include <vector>
+
+#include "Algorithms.hpp"
+#include "BigInt.hpp"
+#include "Rational.hpp"
+#include "Tools/FractionAccumulator.hpp"
+
+namespace Arkulib {
+    /**
+     * @brief c[0] + c[1] * x + ... + c[n] * x^n. Besides the rational coefficients, the polynomial keeps
+     * integer[i] / denominator with denominator = lcm(denominators of c), and the coefficients as doubles.
+     * @tparam IntType
+     * @tparam ErrorPolicy
+     */
+    template<typename IntType = long long, typename ErrorPolicy = Policies::DefaultErrorPolicy>
+    class RationalPolynomial {
+
+    public:
+        using RationalType = Rational<IntType, Policies::Canonical, ErrorPolicy>;
+
+        /************************************************************************************************************
+         ****************************************** CONSTRUCTOR / DESTRUCTOR ****************************************
+         ************************************************************************************************************/
+
+        /**
+         * @brief The zero polynomial
+         */
+        inline RationalPolynomial() = default;
+
+        /**
+         * @brief Create a polynomial from its coefficients, from the constant one
+         * @param coefficients
+         */
+        explicit RationalPolynomial(std::vector<RationalType> coefficients);
+
+        /**
+         * @brief Create a polynomial from its coefficients, from the constant one. Example: {R(1), R(0), R(1, 2)}
+         * is 1 + x^2 / 2
+         * @param coefficients
+         */
+        inline RationalPolynomial(const std::initializer_list<RationalType> coefficients)
+                : RationalPolynomial(std::vector<RationalType>(coefficients)) {}
+
+        /************************************************************************************************************
+         ************************************************* ACCESSORS ************************************************
+         ************************************************************************************************************/
+
+        /**
+         * @return The degree (0 for the zero polynomial)
+         */
+        [[nodiscard]] inline std::size_t degree() const noexcept { return m_coefficients.empty() ? 0 : m_coefficients.size() - 1; }
+
+        [[nodiscard]] inline bool isZero() const noexcept { return m_coefficients.empty(); }
+
+        /**
+         * @return The coefficient of x^power (0 above the degree)
+         */
+        [[nodiscard]] inline RationalType coefficient(const std::size_t power) const {
+            return power < m_coefficients.size() ? m_coefficients[power] : RationalType();
+        }
+
+        [[nodiscard]] inline const std::vector<RationalType> &coefficients() const noexcept { return m_coefficients; }
+
+        /**
+         * @brief Change the coefficient of x^power
+         * @param power
+         * @param value
+         */
+        void setCoefficient(std::size_t power, const RationalType &value);
+
+        /************************************************************************************************************
+         ************************************************ EVALUATION ************************************************
+         ************************************************************************************************************/
+
+        /**
+         * @brief The value at x = p / q, by a Horner scheme on integers: S = S * p + integer[i] * q^(n-i), then
+         * P(x) = S / (denominator * q^n). There is one gcd at the end instead of two per coefficient, and only the
+         * result must fit in IntType (the scheme goes on with BigInt if the wide type overflows).
+         * @param x
+         * @return P(x)
+         */
+        [[nodiscard]] RationalType evaluate(const RationalType &x) const;
+
+        /**
+         * @brief The value at a floating point number, by a Horner scheme on the coefficients as doubles
+         */
+        [[nodiscard]] double evaluate(double x) const noexcept;
+
+        /**
+         * @brief The values at many rationals
+         */
+        [[nodiscard]] std::vector<RationalType> evaluate(const std::vector<RationalType> &points) const;
+
+        /**
+         * @brief The values at many floating point numbers. The points go through the Horner scheme together, by
+         * blocks that stay in the cache: the inner loop is vectorized.
+         */
+        [[nodiscard]] std::vector<double> evaluate(const std::vector<double> &points) const;
+
+        /************************************************************************************************************
+         ************************************************* OPERATORS ************************************************
+         ************************************************************************************************************/
+
+        RationalPolynomial operator+(const RationalPolynomial &anotherPolynomial) const;
+
+        RationalPolynomial operator-(const RationalPolynomial &anotherPolynomial) const;
+
+        /**
+         * @brief Product with the denominators cleared: (A / a) * (B / b) = (A * B) / (a * b), where A * B is a
+         * Karatsuba product of integer polynomials. Each coefficient of the result is reduced once.
+         */
+        RationalPolynomial operator*(const RationalPolynomial &anotherPolynomial) const;
+
+        inline bool operator==(const RationalPolynomial &anotherPolynomial) const noexcept {
+            return m_coefficients == anotherPolynomial.m_coefficients;
+        }
+
+        inline bool operator!=(const RationalPolynomial &anotherPolynomial) const noexcept { return !(*this == anotherPolynomial); }
+
+        /************************************************************************************************************
+         ************************************************** OTHERS **************************************************
+         ************************************************************************************************************/
+
+        template<typename AnotherIntType, typename AnotherErrorPolicy>
+        friend std::ostream &operator<<(std::ostream &stream, const RationalPolynomial<AnotherIntType, AnotherErrorPolicy> &polynomial);
+
+    private:
+        using WideType = Tools::WiderIntegerType<IntType>;
+
+        static constexpr std::size_t KARATSUBA_THRESHOLD = 16;
+        static constexpr std::size_t POINTS_BLOCK = 256;
+
+        std::vector<RationalType> m_coefficients;
+
+        // m_coefficients[i] = m_integers[i] / m_denominator, also in the wide type when they fit (m_isWide)
+        std::vector<BigInt> m_integers;
+        BigInt m_denominator = BigInt(1);
+        std::vector<WideType> m_wideIntegers;
+        WideType m_wideDenominator = WideType(1);
+        bool m_isWide = true;
+
+        std::vector<double> m_floatingCoefficients;
+
+        /**
+         * @brief Remove the zero leading coefficients and compute the integer and floating coefficients again
+         */
+        void update();
+
+        /**
+         * @brief The integer Horner scheme of evaluate
+         * @return True if it overflowed (only with a bounded type)
+         */
+        template<typename Int>
+        static bool hornerOverflow(
+                const std::vector<Int> &integers, const Int &denominator, const Int &p, const Int &q,
+                Tools::FractionAccumulator<Int> &result
+        );
+
+        /**
+         * @brief result[0, 2 * size - 1) += a * b for two integer polynomials of size coefficients
+         */
+        static void karatsuba(const BigInt *a, const BigInt *b, std::size_t size, BigInt *result);
+    };
+
+
+
+
+    /************************************************************************************************************
+     ************************************************************************************************************/
+
+
+
+
+    /************************************************************************************************************
+     ****************************************** CONSTRUCTOR / DESTRUCTOR ****************************************
+     ************************************************************************************************************/
+
+    template<typename IntType, typename ErrorPolicy>
+    RationalPolynomial<IntType, ErrorPolicy>::RationalPolynomial(std::vector<RationalType> coefficients)
+            : m_coefficients(std::move(coefficients)) {
+        update();
+    }
+
+    /************************************************************************************************************
+     ************************************************* ACCESSORS ************************************************
+     ************************************************************************************************************/
+
+    template<typename IntType, typename ErrorPolicy>
+    void RationalPolynomial<IntType, ErrorPolicy>::setCoefficient(const std::size_t power, const RationalType &value) {
+        if (power >= m_coefficients.size()) {
+            if (value.isZero()) return;
+            m_coefficients.resize(power + 1);
+        }
+        m_coefficients[power] = value;
+        update();
+    }
+
+    template<typename IntType, typename ErrorPolicy>
+    void RationalPolynomial<IntType, ErrorPolicy>::update() {
+        while (!m_coefficients.empty() && m_coefficients.back().isZero()) m_coefficients.pop_back();
+        const std::size_t size = m_coefficients.size();
+
+        m_denominator = BigInt(1);
+        for (const RationalType &coefficient: m_coefficients) {
+            const BigInt denominator(coefficient.getDenominator());
+            if (!(m_denominator % denominator).isZero()) m_denominator = m_denominator / BigInt::gcd(m_denominator, denominator) * denominator;
+        }
+
+        m_integers.resize(size);
+        m_floatingCoefficients.resize(size);
+        for (std::size_t i = 0; i < size; ++i) {
+            const RationalType &coefficient = m_coefficients[i];
+            m_integers[i] = BigInt(coefficient.getNumerator()) * (m_denominator / BigInt(coefficient.getDenominator()));
+            m_floatingCoefficients[i] = coefficient.template toRealNumber<double>();
+        }
+
+        m_isWide = Tools::fitsIn<WideType>(m_denominator)
+                   && std::all_of(m_integers.begin(), m_integers.end(), [](const BigInt &value) { return Tools::fitsIn<WideType>(value); });
+        m_wideIntegers.clear();
+        if (m_isWide) {
+            m_wideDenominator = static_cast<WideType>(m_denominator);
+            m_wideIntegers.reserve(size);
+            for (const BigInt &value: m_integers) m_wideIntegers.push_back(static_cast<WideType>(value));
+        }
+    }
+
+    /************************************************************************************************************
+     ************************************************ EVALUATION ************************************************
+     ************************************************************************************************************/
+
+    template<typename IntType, typename ErrorPolicy>
+    template<typename Int>
+    bool RationalPolynomial<IntType, ErrorPolicy>::hornerOverflow(
+            const std::vector<Int> &integers, const Int &denominator, const Int &p, const Int &q,
+            Tools::FractionAccumulator<Int> &result
+    ) {
+        Int value = integers.back(), qPower = Int(1), scaledValue{}, scaledCoefficient{};
+        for (std::size_t i = integers.size() - 1; i-- > 0;) {
+            if (Tools::multiplyOverflow(qPower, q, qPower)
+                || Tools::multiplyOverflow(value, p, scaledValue)
+                || Tools::multiplyOverflow(integers[i], qPower, scaledCoefficient)
+                || Tools::addOverflow(scaledValue, scaledCoefficient, value)) return true;
+        }
+        result.numerator = value;
+        return Tools::multiplyOverflow(denominator, qPower, result.denominator);
+    }
+
+    template<typename IntType, typename ErrorPolicy>
+    typename RationalPolynomial<IntType, ErrorPolicy>::RationalType
+    RationalPolynomial<IntType, ErrorPolicy>::evaluate(const RationalType &x) const {
+        if (m_coefficients.empty()) return RationalType();
+
+        if (m_isWide) {
+            Tools::FractionAccumulator<WideType> result;
+            if (!hornerOverflow(m_wideIntegers, m_wideDenominator, WideType(x.getNumerator()), WideType(x.getDenominator()), result)) {
+                return Tools::finalFraction<RationalType>(result);
+            }
+        }
+        Tools::FractionAccumulator<BigInt> result;
+        hornerOverflow(m_integers, m_denominator, BigInt(x.getNumerator()), BigInt(x.getDenominator()), result);
+        return Tools::finalFraction<RationalType>(result);
+    }
+
+    template<typename IntType, typename ErrorPolicy>
+    double RationalPolynomial<IntType, ErrorPolicy>::evaluate(const double x) const noexcept {
+        double value = 0;
+        for (std::size_t i = m_floatingCoefficients.size(); i-- > 0;) value = value * x + m_floatingCoefficients[i];
+        return value;
+    }
+
+    template<typename IntType, typename ErrorPolicy>
+    std::vector<typename RationalPolynomial<IntType, ErrorPolicy>::RationalType>
+    RationalPolynomial<IntType, ErrorPolicy>::evaluate(const std::vector<RationalType> &points) const {
+        std::vector<RationalType> values;
+        values.reserve(points.size());
+        for (const RationalType &point: points) values.push_back(evaluate(point));
+        return values;
+    }
+
+    template<typename IntType, typename ErrorPolicy>
+    std::vector<double> RationalPolynomial<IntType, ErrorPolicy>::evaluate(const std::vector<double> &points) const {
+        std::vector<double> values(points.size(), 0.);
+        const std::size_t size = m_floatingCoefficients.size();
+        for (std::size_t first = 0; first < points.size(); first += POINTS_BLOCK) {
+            const std::size_t last = std::min(first + POINTS_BLOCK, points.size());
+            for (std::size_t i = size; i-- > 0;) {
+                const double coefficient = m_floatingCoefficients[i];
+                for (std::size_t j = first; j < last; ++j) values[j] = values[j] * points[j] + coefficient;
+            }
+        }
+        return values;
+    }
+
+    /************************************************************************************************************
+     ************************************************* OPERATORS ************************************************
+     ************************************************************************************************************/
+
+    template<typename IntType, typename ErrorPolicy>
+    RationalPolynomial<IntType, ErrorPolicy> RationalPolynomial<IntType, ErrorPolicy>::operator+(const RationalPolynomial &anotherPolynomial) const {
+        std::vector<RationalType> coefficients(std::max(m_coefficients.size(), anotherPolynomial.m_coefficients.size()));
+        for (std::size_t i = 0; i < coefficients.size(); ++i) coefficients[i] = coefficient(i) + anotherPolynomial.coefficient(i);
+        return RationalPolynomial(std::move(coefficients));
+    }
+
+    template<typename IntType, typename ErrorPolicy>
+    RationalPolynomial<IntType, ErrorPolicy> RationalPolynomial<IntType, ErrorPolicy>::operator-(const RationalPolynomial &anotherPolynomial) const {
+        std::vector<RationalType> coefficients(std::max(m_coefficients.size(), anotherPolynomial.m_coefficients.size()));
+        for (std::size_t i = 0; i < coefficients.size(); ++i) coefficients[i] = coefficient(i) - anotherPolynomial.coefficient(i);
+        return RationalPolynomial(std::move(coefficients));
+    }
+
+    template<typename IntType, typename ErrorPolicy>
+    void RationalPolynomial<IntType, ErrorPolicy>::karatsuba(const BigInt *a, const BigInt *b, const std::size_t size, BigInt *result) {
+        if (size <= KARATSUBA_THRESHOLD) {
+            for (std::size_t i = 0; i < size; ++i) {
+                if (a[i].isZero()) continue;
+                for (std::size_t j = 0; j < size; ++j) result[i + j] += a[i] * b[j];
+            }
+            return;
+        }
+
+        // (a0 + a1 x^h)(b0 + b1 x^h) = a0 b0 + ((a0 + a1)(b0 + b1) - a0 b0 - a1 b1) x^h + a1 b1 x^2h
+        const std::size_t low = size / 2, high = size - low;
+        std::vector<BigInt> lowProduct(2 * low - 1), highProduct(2 * high - 1), middleProduct(2 * high - 1);
+        std::vector<BigInt> aSum(a + low, a + size), bSum(b + low, b + size);
+        for (std::size_t i = 0; i < low; ++i) {
+            aSum[i] += a[i];
+            bSum[i] += b[i];
+        }
+        karatsuba(a, b, low, lowProduct.data());
+        karatsuba(a + low, b + low, high, highProduct.data());
+        karatsuba(aSum.data(), bSum.data(), high, middleProduct.data());
+
+        for (std::size_t i = 0; i < lowProduct.size(); ++i) {
+            result[i] += lowProduct[i];
+            middleProduct[i] -= lowProduct[i];
+        }
+        for (std::size_t i = 0; i < highProduct.size(); ++i) {
+            result[i + 2 * low] += highProduct[i];
+            middleProduct[i] -= highProduct[i];
+        }
+        for (std::size_t i = 0; i < middleProduct.size(); ++i) result[i + low] += middleProduct[i];
+    }
+
+    template<typename IntType, typename ErrorPolicy>
+    RationalPolynomial<IntType, ErrorPolicy> RationalPolynomial<IntType, ErrorPolicy>::operator*(const RationalPolynomial &anotherPolynomial) const {
+        if (isZero() || anotherPolynomial.isZero()) return {};
+
+        // Both integer polynomials padded to the same size, the zeros cost nothing in the products
+        const std::size_t size = std::max(m_integers.size(), anotherPolynomial.m_integers.size());
+        std::vector<BigInt> a(m_integers), b(anotherPolynomial.m_integers);
+        a.resize(size);
+        b.resize(size);
+        std::vector<BigInt> product(2 * size - 1);
+        karatsuba(a.data(), b.data(), size, product.data());
+
+        const BigInt denominator = m_denominator * anotherPolynomial.m_denominator;
+        std::vector<RationalType> coefficients(m_integers.size() + anotherPolynomial.m_integers.size() - 1);
+        for (std::size_t i = 0; i < coefficients.size(); ++i) {
+            Tools::FractionAccumulator<BigInt> fraction{std::move(product[i]), denominator};
+            coefficients[i] = Tools::finalFraction<RationalType>(fraction);
+        }
+        return RationalPolynomial(std::move(coefficients));
+    }
+
+    /************************************************************************************************************
+     ************************************************** OTHERS **************************************************
+     ************************************************************************************************************/
+
+    template<typename IntType, typename ErrorPolicy>
+    std::ostream &operator<<(std::ostream &stream, const RationalPolynomial<IntType, ErrorPolicy> &polynomial) {
+        if (polynomial.isZero()) return stream << "0";
+        bool isFirst = true;
+        for (std::size_t i = polynomial.degree() + 1; i-- > 0;) {
+            if (polynomial.coefficient(i).isZero()) continue;
+            stream << (isFirst ? "" : " + ") << polynomial.coefficient(i);
+            if (i > 0) stream << " x";
+            if (i > 1) stream << '^' << i;
+            isFirst = false;
+        }
+        return stream;
+    }
+}
@@ -0,0 +1,504 @@
+/**
+ * @file      RationalVector.hpp
+ * @author    Elise MASSA
+ * @author    Mattéo LECLERCQ
+ * @date      2022
+ * @brief     Structure of arrays of rationals (numerators and denominators in two aligned arrays) with lane-wise
+ *            SIMD arithmetic. The kernels report the overflowed lanes in a mask instead of throwing.
+ * @copyright WTFPL
+ */
+
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "Rational.hpp"
+#include "Tools/AlignedAllocator.hpp"
+#include "Tools/SimdKernels.hpp"
+
+namespace Arkulib {
+    /**
+     * @brief One bit per lane of a RationalVector, packed in 64-bit words
+     */
+    class LaneMask {
+
+    public:
+        inline LaneMask() noexcept = default;
+
+        inline explicit LaneMask(const std::size_t size) : m_words((size + 63) / 64, 0), m_size(size) {}
+
+        [[nodiscard]] inline std::size_t size() const noexcept { return m_size; }
+
+        [[nodiscard]] inline bool test(const std::size_t lane) const noexcept { return (m_words[lane / 64] >> (lane % 64)) & 1U; }
+
+        inline void set(const std::size_t lane) noexcept { m_words[lane / 64] |= std::uint64_t(1) << (lane % 64); }
+
+        inline void reset(const std::size_t lane) noexcept { m_words[lane / 64] &= ~(std::uint64_t(1) << (lane % 64)); }
+
+        /**
+         * @return True if at least one lane is set
+         */
+        [[nodiscard]] inline bool any() const noexcept {
+            for (const std::uint64_t word: m_words) if (word != 0) return true;
+            return false;
+        }
+
+        /**
+         * @return The number of lanes set
+         */
+        [[nodiscard]] inline std::size_t count() const noexcept {
+            std::size_t result = 0;
+            for (std::uint64_t word: m_words) {
+                for (; word != 0; word &= word - 1) ++result;
+            }
+            return result;
+        }
+
+        /**
+         * @brief The raw words, written by the SIMD kernels
+         */
+        [[nodiscard]] inline std::uint64_t *words() noexcept { return m_words.data(); }
+
+        [[nodiscard]] inline const std::uint64_t *words() const noexcept { return m_words.data(); }
+
+    private:
+        std::vector<std::uint64_t> m_words;
+        std::size_t m_size = 0;
+    };
+
+    /**
+     * @brief Vector of rationals stored as a structure of arrays, for the lane-wise operations on a lot of values.
+     * The lanes are lazily reduced (like Policies::Lazy): the denominators are positive but the fractions are only
+     * reduced by simplify(), by get() or when an intermediate overflows.
+     * The 32-bit lanes use SSE4.1, AVX2 or AVX-512 (chosen at runtime, see Tools::Simd::setLevel), the other integer
+     * types use a scalar loop.
+     * @tparam IntType A builtin signed integer
+     * @tparam ErrorPolicy Used by the operators (the static kernels never raise, they return a mask)
+     */
+    template<typename IntType = int, typename ErrorPolicy = Policies::DefaultErrorPolicy>
+    class RationalVector {
+        static_assert(Tools::isBuiltinInteger<IntType> && std::is_signed_v<IntType>, "RationalVector needs a builtin signed integer");
+
+    public:
+        using RationalType = Rational<IntType, Policies::Canonical, ErrorPolicy>;
+        using Storage = std::vector<IntType, Tools::AlignedAllocator<IntType>>;
+
+        /************************************************************************************************************
+         ****************************************** CONSTRUCTOR / DESTRUCTOR ****************************************
+         ************************************************************************************************************/
+
+        /**
+         * @brief Instantiate an empty vector
+         */
+        inline RationalVector() noexcept = default;
+
+        /**
+         * @brief Instantiate size lanes equal to 0 / 1
+         * @param size
+         */
+        inline explicit RationalVector(const std::size_t size) : m_numerators(size, IntType(0)), m_denominators(size, IntType(1)) {}
+
+        /**
+         * @brief Copy rationals into the lanes
+         * @param rationals
+         */
+        template<typename NormalizationPolicy, typename AnotherErrorPolicy>
+        explicit RationalVector(const std::vector<Rational<IntType, NormalizationPolicy, AnotherErrorPolicy>> &rationals);
+
+        /************************************************************************************************************
+         ************************************************* ACCESSORS ************************************************
+         ************************************************************************************************************/
+
+        [[nodiscard]] inline std::size_t size() const noexcept { return m_numerators.size(); }
+
+        [[nodiscard]] inline bool empty() const noexcept { return m_numerators.empty(); }
+
+        inline void reserve(const std::size_t capacity) {
+            m_numerators.reserve(capacity);
+            m_denominators.reserve(capacity);
+        }
+
+        /**
+         * @brief Resize the vector, the new lanes are 0 / 1
+         */
+        inline void resize(const std::size_t size) {
+            m_numerators.resize(size, IntType(0));
+            m_denominators.resize(size, IntType(1));
+        }
+
+        /**
+         * @brief Append numerator / denominator
+         */
+        void push_back(IntType numerator, IntType denominator = 1) noexcept(ErrorPolicy::isNoexcept);
+
+        /**
+         * @brief Append a rational
+         */
+        template<typename NormalizationPolicy, typename AnotherErrorPolicy>
+        inline void push_back(const Rational<IntType, NormalizationPolicy, AnotherErrorPolicy> &rational) noexcept(ErrorPolicy::isNoexcept) {
+            push_back(rational.getNumerator(), rational.getDenominator());
+        }
+
+        /**
+         * @brief The rational of a lane (reduced)
+         * @param lane
+         */
+        [[nodiscard]] inline RationalType get(const std::size_t lane) const noexcept(ErrorPolicy::isNoexcept) {
+            return RationalType(m_numerators[lane], m_denominators[lane]);
+        }
+
+        /**
+         * @brief Replace the rational of a lane by numerator / denominator
+         */
+        void set(std::size_t lane, IntType numerator, IntType denominator = 1) noexcept(ErrorPolicy::isNoexcept);
+
+        /**
+         * @brief Replace the rational of a lane
+         */
+        template<typename NormalizationPolicy, typename AnotherErrorPolicy>
+        inline void set(const std::size_t lane, const Rational<IntType, NormalizationPolicy, AnotherErrorPolicy> &rational) noexcept(ErrorPolicy::isNoexcept) {
+            set(lane, rational.getNumerator(), rational.getDenominator());
+        }
+
+        [[nodiscard]] inline const Storage &numerators() const noexcept { return m_numerators; }
+
+        [[nodiscard]] inline const Storage &denominators() const noexcept { return m_denominators; }
+
+        /************************************************************************************************************
+         ************************************************* KERNELS **************************************************
+         ************************************************************************************************************/
+
+        /**
+         * @brief result = a + b for every lane. The lanes which don't fit in IntType, even reduced, are set to 0 / 1.
+         * @param a
+         * @param b Same size as a
+         * @param result Resized to the size of a, can be a or b
+         * @return The mask of the lanes which overflowed
+         */
+        static LaneMask add(const RationalVector &a, const RationalVector &b, RationalVector &result);
+
+        /**
+         * @brief result = a - b for every lane (see add)
+         */
+        static LaneMask subtract(const RationalVector &a, const RationalVector &b, RationalVector &result);
+
+        /**
+         * @brief result = a * b for every lane (see add)
+         */
+        static LaneMask multiply(const RationalVector &a, const RationalVector &b, RationalVector &result);
+
+        /**
+         * @brief result = a / b for every lane (see add). The lanes divided by zero are also set in the mask.
+         */
+        static LaneMask divide(const RationalVector &a, const RationalVector &b, RationalVector &result);
+
+        /**
+         * @return The mask of the lanes where a < b
+         */
+        static LaneMask less(const RationalVector &a, const RationalVector &b);
+
+        /**
+         * @return The mask of the lanes where a == b (the fractions don't need to be reduced)
+         */
+        static LaneMask equal(const RationalVector &a, const RationalVector &b);
+
+        /**
+         * @brief Reduce every lane. The gcd has a data-dependent number of steps, so this loop stays scalar.
+         */
+        void simplify() noexcept;
+
+        /**
+         * @brief Convert every lane into a floating point number
+         * @tparam FloatingType
+         */
+        template<typename FloatingType = double>
+        [[nodiscard]] std::vector<FloatingType> toRealNumber() const;
+
+        /************************************************************************************************************
+         ************************************************* OPERATORS ************************************************
+         ************************************************************************************************************/
+
+        // The operators raise an error with ErrorPolicy if any lane overflows
+
+        inline RationalVector operator+(const RationalVector &anotherVector) const {
+            RationalVector result;
+            raiseIfAny(add(*this, anotherVector, result), ArkulibError::NumberTooLarge);
+            return result;
+        }
+
+        inline RationalVector operator-(const RationalVector &anotherVector) const {
+            RationalVector result;
+            raiseIfAny(subtract(*this, anotherVector, result), ArkulibError::NumberTooLarge);
+            return result;
+        }
+
+        inline RationalVector operator*(const RationalVector &anotherVector) const {
+            RationalVector result;
+            raiseIfAny(multiply(*this, anotherVector, result), ArkulibError::NumberTooLarge);
+            return result;
+        }
+
+        inline RationalVector operator/(const RationalVector &anotherVector) const {
+            if (anotherVector.hasZero()) ErrorPolicy::raise(ArkulibError::DivideByZero);
+            RationalVector result;
+            raiseIfAny(divide(*this, anotherVector, result), ArkulibError::NumberTooLarge);
+            return result;
+        }
+
+        inline RationalVector &operator+=(const RationalVector &anotherVector) { return *this = *this + anotherVector; }
+
+        inline RationalVector &operator-=(const RationalVector &anotherVector) { return *this = *this - anotherVector; }
+
+        inline RationalVector &operator*=(const RationalVector &anotherVector) { return *this = *this * anotherVector; }
+
+        inline RationalVector &operator/=(const RationalVector &anotherVector) { return *this = *this / anotherVector; }
+
+    private:
+        Storage m_numerators;
+        Storage m_denominators;
+
+        using WideType = Tools::WiderIntegerType<IntType>;
+
+        /**
+         * @brief The two lanes operations of a kernel: numerator and denominator given by a SIMD pass,
+         * then the overflowed lanes done again exactly in the wide type by wideOperation
+         */
+        template<int NumeratorSign, typename WideOperation>
+        static LaneMask crossKernel(
+                std::size_t count, RationalVector &result,
+                const IntType *n1, const IntType *d1, const IntType *n2, const IntType *d2,
+                const IntType *denominator1, const IntType *denominator2,
+                WideOperation wideOperation
+        );
+
+        /**
+         * @brief Reduce a wide fraction (positive denominator) and store it in a lane if it fits
+         * @return True if it doesn't fit in IntType
+         */
+        static bool storeWide(RationalVector &vector, std::size_t lane, WideType numerator, WideType denominator) noexcept;
+
+        [[nodiscard]] inline bool hasZero() const noexcept {
+            for (const IntType numerator: m_numerators) if (numerator == 0) return true;
+            return false;
+        }
+
+        static inline void raiseIfAny(const LaneMask &mask, const ArkulibError error) noexcept(ErrorPolicy::isNoexcept) {
+            if (mask.any()) ErrorPolicy::raise(error);
+        }
+    };
+
+
+
+
+    /************************************************************************************************************
+     ************************************************************************************************************/
+
+
+
+
+    /************************************************************************************************************
+     ****************************************** CONSTRUCTOR / DESTRUCTOR ****************************************
+     ************************************************************************************************************/
+
+    template<typename IntType, typename ErrorPolicy>
+    template<typename NormalizationPolicy, typename AnotherErrorPolicy>
+    RationalVector<IntType, ErrorPolicy>::RationalVector(const std::vector<Rational<IntType, NormalizationPolicy, AnotherErrorPolicy>> &rationals) {
+        reserve(rationals.size());
+        for (const auto &rational: rationals) push_back(rational);
+    }
+
+    /************************************************************************************************************
+     ************************************************* ACCESSORS ************************************************
+     ************************************************************************************************************/
+
+    template<typename IntType, typename ErrorPolicy>
+    void RationalVector<IntType, ErrorPolicy>::push_back(const IntType numerator, const IntType denominator) noexcept(ErrorPolicy::isNoexcept) {
+        m_numerators.push_back(0);
+        m_denominators.push_back(1);
+        set(size() - 1, numerator, denominator);
+    }
+
+    template<typename IntType, typename ErrorPolicy>
+    void RationalVector<IntType, ErrorPolicy>::set(const std::size_t lane, const IntType numerator, const IntType denominator) noexcept(ErrorPolicy::isNoexcept) {
+        if (denominator == 0) {
+            ErrorPolicy::raise(ArkulibError::DivideByZero);
+            m_numerators[lane] = 0;
+            m_denominators[lane] = 1;
+            return;
+        }
+        if (denominator > 0) {
+            m_numerators[lane] = numerator;
+            m_denominators[lane] = denominator;
+        }
+        else if (numerator != std::numeric_limits<IntType>::min() && denominator != std::numeric_limits<IntType>::min()) {
+            m_numerators[lane] = -numerator;
+            m_denominators[lane] = -denominator;
+        }
+        // The sign can't be moved without reducing the fraction first
+        else if (storeWide(*this, lane, -WideType(numerator), -WideType(denominator))) {
+            ErrorPolicy::raise(ArkulibError::NumberTooLarge);
+        }
+    }
+
+    /************************************************************************************************************
+     ************************************************* KERNELS **************************************************
+     ************************************************************************************************************/
+
+    template<typename IntType, typename ErrorPolicy>
+    bool RationalVector<IntType, ErrorPolicy>::storeWide(
+            RationalVector &vector, const std::size_t lane, WideType numerator, WideType denominator
+    ) noexcept {
+        const WideType divisor = Tools::gcd(numerator, denominator);
+        if (divisor > 1) {
+            numerator /= divisor;
+            denominator /= divisor;
+        }
+        if (Tools::fitsIn<IntType>(numerator) && Tools::fitsIn<IntType>(denominator)) {
+            vector.m_numerators[lane] = static_cast<IntType>(numerator);
+            vector.m_denominators[lane] = static_cast<IntType>(denominator);
+            return false;
+        }
+        vector.m_numerators[lane] = 0;
+        vector.m_denominators[lane] = 1;
+        return true;
+    }
+
+    template<typename IntType, typename ErrorPolicy>
+    template<int NumeratorSign, typename WideOperation>
+    LaneMask RationalVector<IntType, ErrorPolicy>::crossKernel(
+            const std::size_t count, RationalVector &result,
+            const IntType *n1, const IntType *d1, const IntType *n2, const IntType *d2,
+            const IntType *denominator1, const IntType *denominator2,
+            WideOperation wideOperation
+    ) {
+        // The lanes are computed in a new vector: the overflowed lanes need the operands, and result can alias them
+        RationalVector output(count);
+        LaneMask overflow(count);
+        Tools::Simd::crossNarrow<NumeratorSign>(n1, d1, n2, d2, output.m_numerators.data(), overflow.words(), count);
+        Tools::Simd::crossNarrow<0>(denominator1, denominator2, denominator1, denominator2, output.m_denominators.data(), overflow.words(), count);
+
+        for (std::size_t word = 0; word < (count + 63) / 64; ++word) {
+            for (std::uint64_t bits = overflow.words()[word]; bits != 0; bits &= bits - 1) {
+                const std::size_t lane = word * 64 + static_cast<std::size_t>(Tools::countTrailingZeros(bits));
+                if (!wideOperation(output, lane)) overflow.reset(lane);
+            }
+        }
+
+        result = std::move(output);
+        return overflow;
+    }
+
+    template<typename IntType, typename ErrorPolicy>
+    LaneMask RationalVector<IntType, ErrorPolicy>::add(const RationalVector &a, const RationalVector &b, RationalVector &result) {
+        assert(a.size() == b.size() && "The vectors must have the same size");
+        const IntType *an = a.m_numerators.data(), *ad = a.m_denominators.data();
+        const IntType *bn = b.m_numerators.data(), *bd = b.m_denominators.data();
+        return crossKernel<1>(a.size(), result, an, bd, bn, ad, ad, bd, [&](RationalVector &output, const std::size_t lane) {
+            // |n1 * d2| + |n2 * d1| and d1 * d2 always fit in the wide type
+            return storeWide(output, lane,
+                             WideType(an[lane]) * bd[lane] + WideType(bn[lane]) * ad[lane],
+                             WideType(ad[lane]) * bd[lane]);
+        });
+    }
+
+    template<typename IntType, typename ErrorPolicy>
+    LaneMask RationalVector<IntType, ErrorPolicy>::subtract(const RationalVector &a, const RationalVector &b, RationalVector &result) {
+        assert(a.size() == b.size() && "The vectors must have the same size");
+        const IntType *an = a.m_numerators.data(), *ad = a.m_denominators.data();
+        const IntType *bn = b.m_numerators.data(), *bd = b.m_denominators.data();
+        return crossKernel<-1>(a.size(), result, an, bd, bn, ad, ad, bd, [&](RationalVector &output, const std::size_t lane) {
+            return storeWide(output, lane,
+                             WideType(an[lane]) * bd[lane] - WideType(bn[lane]) * ad[lane],
+                             WideType(ad[lane]) * bd[lane]);
+        });
+    }
+
+    template<typename IntType, typename ErrorPolicy>
+    LaneMask RationalVector<IntType, ErrorPolicy>::multiply(const RationalVector &a, const RationalVector &b, RationalVector &result) {
+        assert(a.size() == b.size() && "The vectors must have the same size");
+        const IntType *an = a.m_numerators.data(), *ad = a.m_denominators.data();
+        const IntType *bn = b.m_numerators.data(), *bd = b.m_denominators.data();
+        return crossKernel<0>(a.size(), result, an, bn, an, bn, ad, bd, [&](RationalVector &output, const std::size_t lane) {
+            return storeWide(output, lane, WideType(an[lane]) * bn[lane], WideType(ad[lane]) * bd[lane]);
+        });
+    }
+
+    template<typename IntType, typename ErrorPolicy>
+    LaneMask RationalVector<IntType, ErrorPolicy>::divide(const RationalVector &a, const RationalVector &b, RationalVector &result) {
+        assert(a.size() == b.size() && "The vectors must have the same size");
+        const std::size_t count = a.size();
+        const IntType *an = a.m_numerators.data(), *ad = a.m_denominators.data();
+        const IntType *bn = b.m_numerators.data(), *bd = b.m_denominators.data();
+
+        // n1 / d1 / (n2 / d2) = (n1 * d2) / (d1 * n2): the lanes with a negative divisor get their sign moved
+        // to the numerator, and the lanes divided by zero stay in the mask
+        RationalVector output(count);
+        LaneMask overflow(count);
+        Tools::Simd::crossNarrow<0>(an, bd, an, bd, output.m_numerators.data(), overflow.words(), count);
+        Tools::Simd::crossNarrow<0>(ad, bn, ad, bn, output.m_denominators.data(), overflow.words(), count);
+
+        for (std::size_t lane = 0; lane < count; ++lane) {
+            IntType &numerator = output.m_numerators[lane];
+            IntType &denominator = output.m_denominators[lane];
+            if (bn[lane] == 0) {
+                numerator = 0;
+                denominator = 1;
+                overflow.set(lane);
+            }
+            else if (overflow.test(lane) || denominator < 0) {
+                // The sign of the wide fraction is moved then it's reduced: this can't overflow the wide type
+                const WideType wideNumerator = WideType(an[lane]) * bd[lane];
+                const WideType wideDenominator = WideType(ad[lane]) * bn[lane];
+                if (storeWide(output, lane, bn[lane] < 0 ? -wideNumerator : wideNumerator, bn[lane] < 0 ? -wideDenominator : wideDenominator)) {
+                    overflow.set(lane);
+                } else {
+                    overflow.reset(lane);
+                }
+            }
+        }
+
+        result = std::move(output);
+        return overflow;
+    }
+
+    template<typename IntType, typename ErrorPolicy>
+    LaneMask RationalVector<IntType, ErrorPolicy>::less(const RationalVector &a, const RationalVector &b) {
+        assert(a.size() == b.size() && "The vectors must have the same size");
+        LaneMask lessMask(a.size()), equalMask(a.size());
+        Tools::Simd::compare(a.m_numerators.data(), a.m_denominators.data(), b.m_numerators.data(), b.m_denominators.data(),
+                             lessMask.words(), equalMask.words(), a.size());
+        return lessMask;
+    }
+
+    template<typename IntType, typename ErrorPolicy>
+    LaneMask RationalVector<IntType, ErrorPolicy>::equal(const RationalVector &a, const RationalVector &b) {
+        assert(a.size() == b.size() && "The vectors must have the same size");
+        LaneMask lessMask(a.size()), equalMask(a.size());
+        Tools::Simd::compare(a.m_numerators.data(), a.m_denominators.data(), b.m_numerators.data(), b.m_denominators.data(),
+                             lessMask.words(), equalMask.words(), a.size());
+        return equalMask;
+    }
+
+    template<typename IntType, typename ErrorPolicy>
+    void RationalVector<IntType, ErrorPolicy>::simplify() noexcept {
+        for (std::size_t lane = 0; lane < size(); ++lane) {
+            const IntType divisor = Tools::gcd(m_numerators[lane], m_denominators[lane]);
+            if (divisor > 1) {
+                m_numerators[lane] /= divisor;
+                m_denominators[lane] /= divisor;
+            }
+        }
+    }
+
+    template<typename IntType, typename ErrorPolicy>
+    template<typename FloatingType>
+    std::vector<FloatingType> RationalVector<IntType, ErrorPolicy>::toRealNumber() const {
+        std::vector<FloatingType> result(size());
+        Tools::Simd::divideToFloating(m_numerators.data(), m_denominators.data(), result.data(), size());
+        return result;
+    }
+}
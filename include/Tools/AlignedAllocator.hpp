@@ -0,0 +1,49 @@
+/**
+ * @file      AlignedAllocator.hpp
+ * @author    Elise MASSA
+ * @author    Mattéo LECLERCQ
+ * @date      2022
+ * @brief     std::allocator replacement giving over-aligned storage (the SIMD kernels load whole cache lines)
+ * @copyright WTFPL
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <new>
+
+namespace Arkulib::Tools {
+    /**
+     * @brief Allocator whose blocks are aligned on Alignment bytes
+     * @tparam Type
+     * @tparam Alignment A power of 2, at least alignof(Type)
+     */
+    template<typename Type, std::size_t Alignment = 64>
+    struct AlignedAllocator {
+        static_assert((Alignment & (Alignment - 1)) == 0 && Alignment >= alignof(Type), "Invalid alignment");
+
+        using value_type = Type;
+
+        template<typename OtherType>
+        struct rebind { using other = AlignedAllocator<OtherType, Alignment>; };
+
+        constexpr AlignedAllocator() noexcept = default;
+
+        template<typename OtherType>
+        constexpr AlignedAllocator(const AlignedAllocator<OtherType, Alignment> &) noexcept {} // NOLINT(google-explicit-constructor)
+
+        [[nodiscard]] inline Type *allocate(const std::size_t count) {
+            return static_cast<Type *>(::operator new(count * sizeof(Type), std::align_val_t(Alignment)));
+        }
+
+        inline void deallocate(Type *pointer, std::size_t) noexcept {
+            ::operator delete(pointer, std::align_val_t(Alignment));
+        }
+
+        template<typename OtherType>
+        constexpr bool operator==(const AlignedAllocator<OtherType, Alignment> &) const noexcept { return true; }
+
+        template<typename OtherType>
+        constexpr bool operator!=(const AlignedAllocator<OtherType, Alignment> &) const noexcept { return false; }
+    };
+}
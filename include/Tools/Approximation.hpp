@@ -0,0 +1,82 @@
+/**
+ * @file      Approximation.hpp
+ * @author    Elise MASSA
+ * @author    Mattéo LECLERCQ
+ * @date      2022
+ * @brief     Best rational approximation with bounded numerator and denominator (continued fractions)
+ * @copyright WTFPL
+ */
+
+#pragma once
+
+#include "Comparison.hpp"
+
+namespace Arkulib::Tools {
+    /**
+     * @brief Find the fraction closest to numerator / denominator whose numerator and denominator stay in the bounds.
+     * The candidates are the convergents and the semiconvergents of the continued fraction expansion: the last
+     * convergent in the bounds is compared exactly with the largest semiconvergent that follows it.
+     * Saturation comes for free: a value above numeratorBound gives numeratorBound / 1.
+     * @tparam UnsignedType
+     * @param numerator
+     * @param denominator Must not be 0
+     * @param numeratorBound Must not be 0. 2 * numeratorBound * denominatorBound must fit in UnsignedType.
+     * @param denominatorBound Must not be 0
+     * @param bestNumerator
+     * @param bestDenominator Never 0. The result is reduced.
+     */
+    template<typename UnsignedType>
+    constexpr void boundedBestApproximation(
+            const UnsignedType numerator, const UnsignedType denominator,
+            const UnsignedType numeratorBound, const UnsignedType denominatorBound,
+            UnsignedType &bestNumerator, UnsignedType &bestDenominator
+    ) noexcept {
+        // h1 / k1 is the last convergent, h2 / k2 the one before (1 / 0 and 0 / 1 to start the recurrence)
+        UnsignedType h2 = 0, h1 = 1, k2 = 1, k1 = 0;
+        UnsignedType p = numerator, q = denominator;
+
+        while (q != UnsignedType(0)) {
+            const UnsignedType quotient = p / q;
+
+            // Largest t such that (t * h1 + h2) / (t * k1 + k2) stays in the bounds
+            UnsignedType maxQuotient = quotient;
+            if (h1 != UnsignedType(0) && (numeratorBound - h2) / h1 < maxQuotient) maxQuotient = (numeratorBound - h2) / h1;
+            if (k1 != UnsignedType(0) && (denominatorBound - k2) / k1 < maxQuotient) maxQuotient = (denominatorBound - k2) / k1;
+
+            if (maxQuotient < quotient) {
+                const UnsignedType semiNumerator = maxQuotient * h1 + h2;
+                const UnsignedType semiDenominator = maxQuotient * k1 + k2;
+
+                bool isConvergentCloser = semiDenominator == UnsignedType(0);
+                if (k1 != UnsignedType(0) && !isConvergentCloser) {
+                    // Both candidates surround the value: the closer one is on the same side of their midpoint
+                    const UnsignedType convergentCross = h1 * semiDenominator;
+                    const UnsignedType semiCross = semiNumerator * k1;
+                    const int side = compareContinuedFractions(
+                            numerator, denominator,
+                            UnsignedType(convergentCross + semiCross), UnsignedType(UnsignedType(2) * k1 * semiDenominator)
+                    );
+                    // On a tie, the convergent has the smaller denominator
+                    isConvergentCloser = side == 0 || (side > 0) == (convergentCross > semiCross);
+                }
+
+                bestNumerator = isConvergentCloser ? h1 : semiNumerator;
+                bestDenominator = isConvergentCloser ? k1 : semiDenominator;
+                return;
+            }
+
+            const UnsignedType h = quotient * h1 + h2;
+            const UnsignedType k = quotient * k1 + k2;
+            h2 = h1; h1 = h;
+            k2 = k1; k1 = k;
+
+            const UnsignedType remainder = p % q;
+            p = q;
+            q = remainder;
+        }
+
+        // The value itself is in the bounds
+        bestNumerator = h1;
+        bestDenominator = k1;
+    }
+}
@@ -0,0 +1,139 @@
+/**
+ * @file      ArithmeticKernels.hpp
+ * @author    Elise MASSA
+ * @author    Mattéo LECLERCQ
+ * @date      2022
+ * @brief     Gcd-before-multiply kernels (Knuth / Henrici) used by the Rational operators
+ * @copyright WTFPL
+ */
+
+#pragma once
+
+#include "Gcd.hpp"
+#include "IntegerTraits.hpp"
+
+namespace Arkulib::Tools {
+    /**
+     * Every kernel takes two rationals (n1 / d1) and (n2 / d2) with positive denominators.
+     * If both are reduced, the result is reduced too and no final gcd is needed.
+     * The cancellations happen before the products, so the intermediates stay as small as possible.
+     * Every kernel returns true if an operation overflowed IntType (the outputs are then unspecified).
+     */
+
+    /**
+     * @brief Shared body of the Henrici addition and subtraction
+     */
+    template<typename IntType, bool isSubtraction>
+    constexpr bool henriciOverflow(
+            const IntType n1, const IntType d1,
+            const IntType n2, const IntType d2,
+            IntType &numerator, IntType &denominator
+    ) noexcept {
+        const IntType gcd = Tools::gcd(d1, d2);
+
+        if (gcd == IntType(1)) {
+            if constexpr (isSubtraction) {
+                if (crossSubtractOverflow(n1, d2, n2, d1, numerator)) return true;
+            } else {
+                if (crossAddOverflow(n1, d2, n2, d1, numerator)) return true;
+            }
+            return multiplyOverflow(d1, d2, denominator);
+        }
+
+        // (n1 / d1) +- (n2 / d2) = t / ((d1 / g) * d2) with t = n1 * (d2 / g) +- n2 * (d1 / g)
+        // Only gcd(t, g) can still be cancelled
+        const IntType reducedD1 = d1 / gcd;
+        const IntType reducedD2 = d2 / gcd;
+        IntType sum{};
+        if constexpr (isSubtraction) {
+            if (crossSubtractOverflow(n1, reducedD2, n2, reducedD1, sum)) return true;
+        } else {
+            if (crossAddOverflow(n1, reducedD2, n2, reducedD1, sum)) return true;
+        }
+
+        if (sum == IntType(0)) {
+            numerator = IntType(0);
+            denominator = IntType(1);
+            return false;
+        }
+
+        const IntType secondGcd = Tools::gcd(sum, gcd);
+        numerator = sum / secondGcd;
+        return multiplyOverflow(reducedD1, IntType(d2 / secondGcd), denominator);
+    }
+
+    /**
+     * @brief Henrici addition: only gcd(d1, d2) and gcd(t, gcd(d1, d2)) are computed
+     */
+    template<typename IntType>
+    constexpr inline bool reducedAddOverflow(
+            const IntType n1, const IntType d1,
+            const IntType n2, const IntType d2,
+            IntType &numerator, IntType &denominator
+    ) noexcept {
+        return henriciOverflow<IntType, false>(n1, d1, n2, d2, numerator, denominator);
+    }
+
+    /**
+     * @brief Henrici subtraction: only gcd(d1, d2) and gcd(t, gcd(d1, d2)) are computed
+     */
+    template<typename IntType>
+    constexpr inline bool reducedSubtractOverflow(
+            const IntType n1, const IntType d1,
+            const IntType n2, const IntType d2,
+            IntType &numerator, IntType &denominator
+    ) noexcept {
+        return henriciOverflow<IntType, true>(n1, d1, n2, d2, numerator, denominator);
+    }
+
+    /**
+     * @brief Knuth multiplication: gcd(n1, d2) and gcd(n2, d1) are cancelled before multiplying
+     */
+    template<typename IntType>
+    constexpr bool reducedMultiplyOverflow(
+            const IntType n1, const IntType d1,
+            const IntType n2, const IntType d2,
+            IntType &numerator, IntType &denominator
+    ) noexcept {
+        if (n1 == IntType(0) || n2 == IntType(0)) {
+            numerator = IntType(0);
+            denominator = IntType(1);
+            return false;
+        }
+
+        const IntType firstGcd = Tools::gcd(n1, d2);
+        const IntType secondGcd = Tools::gcd(n2, d1);
+
+        return multiplyOverflow(IntType(n1 / firstGcd), IntType(n2 / secondGcd), numerator)
+               || multiplyOverflow(IntType(d1 / secondGcd), IntType(d2 / firstGcd), denominator);
+    }
+
+    /**
+     * @brief Knuth division: gcd(n1, n2) and gcd(d1, d2) are cancelled before multiplying. n2 must not be 0.
+     */
+    template<typename IntType>
+    constexpr bool reducedDivideOverflow(
+            const IntType n1, const IntType d1,
+            const IntType n2, const IntType d2,
+            IntType &numerator, IntType &denominator
+    ) noexcept {
+        if (n1 == IntType(0)) {
+            numerator = IntType(0);
+            denominator = IntType(1);
+            return false;
+        }
+
+        const IntType firstGcd = Tools::gcd(n1, n2);
+        const IntType secondGcd = Tools::gcd(d1, d2);
+
+        if (multiplyOverflow(IntType(n1 / firstGcd), IntType(d2 / secondGcd), numerator)
+            || multiplyOverflow(IntType(d1 / secondGcd), IntType(n2 / firstGcd), denominator)) return true;
+
+        // The denominator takes the sign of n2
+        if (denominator < IntType(0)) {
+            return subtractOverflow(IntType(0), numerator, numerator)
+                   || subtractOverflow(IntType(0), denominator, denominator);
+        }
+        return false;
+    }
+}
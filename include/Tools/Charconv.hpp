@@ -0,0 +1,189 @@
+/**
+ * @file      Charconv.hpp
+ * @author    Elise MASSA
+ * @author    Mattéo LECLERCQ
+ * @date      2022
+ * @brief     Allocation-free conversions between the integers of a rational and characters, on top of
+ *            std::to_chars (the formats of Rational::toChars and Rational::fromChars)
+ * @copyright WTFPL
+ */
+
+#pragma once
+
+#include <charconv>
+#include <cstddef>
+#include <cstring>
+#include <string>
+#include <system_error>
+
+#include "Gcd.hpp"
+#include "IntegerTraits.hpp"
+
+namespace Arkulib::Tools {
+    /**
+     * @brief The maximum number of characters of a builtin integer in base 10, sign included
+     * @tparam IntType
+     */
+    template<typename IntType>
+    constexpr std::size_t maxDecimalChars = sizeof(IntType) * 8 * 30103 / 100000 + 2;
+
+    /**
+     * @brief Write value in base 10 in [first, last), like std::to_chars. It doesn't allocate for the builtin integers
+     * (__int128 included), the other types (BigInt) go through their to_string.
+     * @tparam IntType
+     * @param first
+     * @param last
+     * @param value
+     * @return {end of the written characters, errc()} or {last, errc::value_too_large}
+     */
+    template<typename IntType>
+    std::to_chars_result integerToChars(char *first, char *last, const IntType &value) noexcept(isBuiltinInteger<IntType>) {
+        if constexpr (isBuiltinInteger<IntType> && sizeof(IntType) <= sizeof(long long)) {
+            return std::to_chars(first, last, value);
+        }
+
+        else if constexpr (isBuiltinInteger<IntType>) {
+            // std::to_chars has no overload for __int128: the digits are written backward from the magnitude
+            using UnsignedType = UnsignedIntegerType<IntType>;
+            const bool isNegative = value < 0;
+            UnsignedType magnitude = isNegative ? UnsignedType(0) - UnsignedType(value) : UnsignedType(value);
+
+            char digits[maxDecimalChars<IntType>];
+            char *digit = digits + sizeof(digits);
+            do {
+                *--digit = static_cast<char>('0' + static_cast<int>(magnitude % 10));
+                magnitude /= 10;
+            } while (magnitude != 0);
+            if (isNegative) *--digit = '-';
+
+            const auto length = static_cast<std::size_t>(digits + sizeof(digits) - digit);
+            if (static_cast<std::size_t>(last - first) < length) return {last, std::errc::value_too_large};
+            std::memcpy(first, digit, length);
+            return {first + length, std::errc()};
+        }
+
+        else {
+            using std::to_string;
+            const std::string digits = to_string(value);
+            if (static_cast<std::size_t>(last - first) < digits.size()) return {last, std::errc::value_too_large};
+            std::memcpy(first, digits.data(), digits.size());
+            return {first + digits.size(), std::errc()};
+        }
+    }
+
+    /**
+     * @return The first character of [first, last) that isn't a space or a tab
+     */
+    constexpr inline const char *skipSpaces(const char *first, const char *last) noexcept {
+        while (first != last && (*first == ' ' || *first == '\t')) ++first;
+        return first;
+    }
+
+    /**
+     * @brief Read an optionally negative decimal number ("-42", "3.125", ".5", "7."): numerator / denominator where
+     * the denominator is a power of 10 (the fraction isn't reduced)
+     * @tparam IntType
+     * @param first
+     * @param last
+     * @param numerator Receives the numerator
+     * @param denominator Receives the denominator
+     * @param allowDecimal If false, the reading stops before a '.'
+     * @return Same as std::from_chars: errc::invalid_argument if there is no digit, errc::result_out_of_range (and
+     * the end of the number) if it doesn't fit in IntType
+     */
+    template<typename IntType>
+    std::from_chars_result parseDecimal(
+            const char *first, const char *last, IntType &numerator, IntType &denominator, const bool allowDecimal = true
+    ) {
+        const char *current = first;
+        const bool isNegative = current != last && *current == '-';
+        if (isNegative) ++current;
+
+        // The digits are accumulated as a negative number, so that the minimum of IntType can be read
+        IntType value(0), power(1);
+        bool isOutOfRange = false, hasDigit = false, isFractional = false;
+        for (; current != last; ++current) {
+            if (*current == '.' && allowDecimal && !isFractional) {
+                isFractional = true;
+                continue;
+            }
+            if (*current < '0' || *current > '9') break;
+            hasDigit = true;
+            if (isOutOfRange) continue;
+            isOutOfRange = multiplyOverflow(value, IntType(10), value) || subtractOverflow(value, IntType(*current - '0'), value)
+                           || (isFractional && multiplyOverflow(power, IntType(10), power));
+        }
+
+        if (!hasDigit) return {first, std::errc::invalid_argument};
+        if (!isNegative) isOutOfRange = isOutOfRange || subtractOverflow(IntType(0), value, value);
+        if (isOutOfRange) return {current, std::errc::result_out_of_range};
+
+        numerator = value;
+        denominator = power;
+        return {current, std::errc()};
+    }
+
+    /**
+     * @brief Read a fraction written "n/d", "(n / d)", "n" or as a decimal number "3.125" (only the numerator can
+     * be decimal). The spaces around the slash are optional.
+     * @tparam IntType
+     * @param first
+     * @param last
+     * @param numerator Receives the numerator
+     * @param denominator Receives the denominator, positive
+     * @return Same as std::from_chars (a zero denominator is an errc::invalid_argument, a value that doesn't fit in
+     * IntType an errc::result_out_of_range)
+     */
+    template<typename IntType>
+    std::from_chars_result parseFraction(const char *first, const char *last, IntType &numerator, IntType &denominator) {
+        const bool isParenthesized = first != last && *first == '(';
+        const char *current = isParenthesized ? skipSpaces(first + 1, last) : first;
+
+        IntType readNumerator(0), readDenominator(1), divisor(1), unused(1);
+        std::from_chars_result result = parseDecimal(current, last, readNumerator, readDenominator);
+        if (result.ec == std::errc::invalid_argument) return {first, result.ec};
+        bool isOutOfRange = result.ec == std::errc::result_out_of_range;
+        current = result.ptr;
+
+        // A slash is looked for after the spaces, the spaces are left unread when there is none
+        const char *slash = skipSpaces(current, last);
+        if (slash != last && *slash == '/') {
+            result = parseDecimal(skipSpaces(slash + 1, last), last, divisor, unused, false);
+            if (result.ec == std::errc::invalid_argument) return {first, result.ec};
+            isOutOfRange = isOutOfRange || result.ec == std::errc::result_out_of_range;
+            current = result.ptr;
+        }
+
+        if (isParenthesized) {
+            current = skipSpaces(current, last);
+            if (current == last || *current != ')') return {first, std::errc::invalid_argument};
+            ++current;
+        }
+
+        if (isOutOfRange || multiplyOverflow(readDenominator, divisor, readDenominator)) {
+            return {current, std::errc::result_out_of_range};
+        }
+        if (readDenominator == IntType(0)) return {first, std::errc::invalid_argument};
+
+        // The sign goes to the numerator. The fraction is reduced first, so that only the values that don't fit
+        // (like "-2147483648/-1" for int) are out of range.
+        if (readDenominator < IntType(0)) {
+            if (readNumerator == readDenominator) {
+                readNumerator = IntType(1);
+                readDenominator = IntType(1);
+            }
+            else {
+                const IntType gcd = Tools::gcd(readNumerator, readDenominator);
+                readNumerator /= gcd;
+                readDenominator /= gcd;
+                if (subtractOverflow(IntType(0), readNumerator, readNumerator) || subtractOverflow(IntType(0), readDenominator, readDenominator)) {
+                    return {current, std::errc::result_out_of_range};
+                }
+            }
+        }
+
+        numerator = readNumerator;
+        denominator = readDenominator;
+        return {current, std::errc()};
+    }
+}
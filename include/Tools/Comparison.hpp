@@ -0,0 +1,75 @@
+/**
+ * @file      Comparison.hpp
+ * @author    Elise MASSA
+ * @author    Mattéo LECLERCQ
+ * @date      2022
+ * @brief     Exact (float-free) comparison of two fractions
+ * @copyright WTFPL
+ */
+
+#pragma once
+
+#include "IntegerTraits.hpp"
+
+namespace Arkulib::Tools {
+    /**
+     * @brief Compare n1 / d1 and n2 / d2 by their continued fraction expansions. Never overflows.
+     * @tparam IntType
+     * @param n1
+     * @param d1 Must be positive
+     * @param n2
+     * @param d2 Must be positive
+     * @return -1, 0 or 1 if n1 / d1 is lower, equal or greater than n2 / d2
+     */
+    template<typename IntType>
+    constexpr int compareContinuedFractions(IntType n1, IntType d1, IntType n2, IntType d2) noexcept {
+        // First partial quotients with a floor division (the numerators can be negative)
+        IntType q1 = n1 / d1, r1 = n1 % d1;
+        IntType q2 = n2 / d2, r2 = n2 % d2;
+        if (r1 < IntType(0)) { r1 += d1; --q1; }
+        if (r2 < IntType(0)) { r2 += d2; --q2; }
+
+        // Every level of the expansion inverts the order
+        int sign = 1;
+        while (true) {
+            if (q1 != q2) return q1 < q2 ? -sign : sign;
+            if (r1 == IntType(0) || r2 == IntType(0)) {
+                if (r1 == r2) return 0;
+                return r1 == IntType(0) ? -sign : sign;
+            }
+
+            // n / d = q + r / d: compare d1 / r1 and d2 / r2 with the opposite order
+            n1 = d1; d1 = r1;
+            n2 = d2; d2 = r2;
+            q1 = n1 / d1; r1 = n1 % d1;
+            q2 = n2 / d2; r2 = n2 % d2;
+            sign = -sign;
+        }
+    }
+
+    /**
+     * @brief Compare n1 / d1 and n2 / d2 exactly. The cross products are computed in the wider integer type,
+     * or in IntType when they don't overflow. The continued fraction comparison is the last resort.
+     * @tparam IntType
+     * @param n1
+     * @param d1 Must be positive
+     * @param n2
+     * @param d2 Must be positive
+     * @return -1, 0 or 1 if n1 / d1 is lower, equal or greater than n2 / d2
+     */
+    template<typename IntType>
+    constexpr inline int compareFractions(const IntType n1, const IntType d1, const IntType n2, const IntType d2) noexcept {
+        if constexpr (WiderInteger<IntType>::isWider) {
+            using WideType = WiderIntegerType<IntType>;
+            const WideType left = static_cast<WideType>(n1) * d2;
+            const WideType right = static_cast<WideType>(n2) * d1;
+            return (left > right) - (left < right);
+        }
+        else {
+            IntType left{}, right{};
+            if (!multiplyOverflow(n1, d2, left) && !multiplyOverflow(n2, d1, right))
+                return (left > right) - (left < right);
+            return compareContinuedFractions(n1, d1, n2, d2);
+        }
+    }
+}
@@ -0,0 +1,75 @@
+/**
+ * @file      Expected.hpp
+ * @author    Elise MASSA
+ * @author    Mattéo LECLERCQ
+ * @date      2022
+ * @brief     A minimal expected<Value, ArkulibError> (std::expected is C++23) and tryCompute
+ * @copyright WTFPL
+ */
+
+#pragma once
+
+#include <cassert>
+#include <utility>
+
+#include "../Exceptions/ArkulibError.hpp"
+#include "../Policies/ErrorPolicies.hpp"
+
+namespace Arkulib {
+    /**
+     * @brief Either a value or the error that prevented its computation
+     * @tparam ValueType Must be default constructible
+     */
+    template<typename ValueType>
+    class Expected {
+
+    public:
+        constexpr Expected(ValueType value) noexcept : m_value(std::move(value)), m_error(ArkulibError::None) {}
+
+        constexpr Expected(const ArkulibError error) noexcept : m_value(), m_error(error) {}
+
+        [[nodiscard]] constexpr inline bool hasValue() const noexcept { return m_error == ArkulibError::None; }
+
+        constexpr inline explicit operator bool() const noexcept { return hasValue(); }
+
+        /**
+         * @return The value. Must not be called when there is an error.
+         */
+        [[nodiscard]] constexpr inline const ValueType &value() const noexcept {
+            assert(hasValue() && "Expected::value() called on an error");
+            return m_value;
+        }
+
+        [[nodiscard]] constexpr inline ArkulibError error() const noexcept { return m_error; }
+
+        [[nodiscard]] constexpr inline ValueType valueOr(ValueType fallback) const noexcept {
+            return hasValue() ? m_value : std::move(fallback);
+        }
+
+    private:
+        ValueType m_value;
+
+        ArkulibError m_error;
+    };
+
+    /**
+     * @brief Run a computation on rationals using the Policies::StatusFlag error policy and return its result
+     * or its first error. The status flag of the thread is left as it was before the call.
+     * @tparam Computation
+     * @param computation Example: [&] { return a * b + c; }
+     * @return An Expected holding the result or the error
+     */
+    template<typename Computation>
+    auto tryCompute(Computation &&computation) noexcept -> Expected<decltype(computation())> {
+        const ArkulibError previousError = Policies::StatusFlag::status();
+        Policies::StatusFlag::clear();
+
+        auto value = computation();
+
+        const ArkulibError error = Policies::StatusFlag::status();
+        Policies::StatusFlag::status() = previousError;
+
+        if (error != ArkulibError::None) return Expected<decltype(computation())>(error);
+        return Expected<decltype(computation())>(std::move(value));
+    }
+}
@@ -0,0 +1,160 @@
+/**
+ * @file      FloatDecomposition.hpp
+ * @author    Elise MASSA
+ * @author    Mattéo LECLERCQ
+ * @date      2022
+ * @brief     Exact split of an IEEE-754 floating point number into mantissa * 2^exponent (a dyadic rational)
+ * @copyright WTFPL
+ */
+
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+#if __has_include(<bit>)
+#include <bit>
+#endif
+
+#include "Gcd.hpp"
+#include "IntegerTraits.hpp"
+
+namespace Arkulib {
+    /**
+     * @brief Tag selecting the exact conversion of a floating point number. Example: Rational<long long>(0.1, Arkulib::Exact)
+     */
+    struct ExactTag {
+        explicit constexpr ExactTag() = default;
+    };
+
+    inline constexpr ExactTag Exact{};
+}
+
+namespace Arkulib::Tools {
+    /**
+     * @brief A finite floating point number is exactly (-1)^isNegative * mantissa * 2^exponent.
+     * The mantissa is odd (or 0): the fraction mantissa / 2^-exponent is already reduced.
+     */
+    struct DyadicDecomposition {
+        std::uint64_t mantissa = 0;
+        int exponent = 0;
+        bool isNegative = false;
+        bool isFinite = true;
+    };
+
+    /**
+     * @brief True if FloatingType is an IEEE-754 binary32 or binary64, read directly from its bits
+     * @tparam FloatingType
+     */
+    template<typename FloatingType>
+    constexpr bool isBinaryInterchangeFormat = std::numeric_limits<FloatingType>::is_iec559
+                                               && (sizeof(FloatingType) == 4 || sizeof(FloatingType) == 8)
+                                               && std::numeric_limits<FloatingType>::digits == (sizeof(FloatingType) == 4 ? 24 : 53);
+
+    /**
+     * @brief Reinterpret the bits of a floating point number (constexpr when std::bit_cast or the builtin exist)
+     */
+    template<typename UnsignedType, typename FloatingType>
+    constexpr inline UnsignedType floatingPointBits(const FloatingType value) noexcept {
+        static_assert(sizeof(UnsignedType) == sizeof(FloatingType), "The integer must have the size of the floating point");
+#if defined(__cpp_lib_bit_cast)
+        return std::bit_cast<UnsignedType>(value);
+#elif defined(__has_builtin)
+#if __has_builtin(__builtin_bit_cast)
+        return __builtin_bit_cast(UnsignedType, value);
+#else
+        UnsignedType bits{};
+        std::memcpy(&bits, &value, sizeof(bits));
+        return bits;
+#endif
+#else
+        UnsignedType bits{};
+        std::memcpy(&bits, &value, sizeof(bits));
+        return bits;
+#endif
+    }
+
+    /**
+     * @brief Split a floating point number into an odd mantissa and a binary exponent. No loop: the sign, exponent and
+     * significand fields are masked out, then the trailing zeros of the significand are moved to the exponent.
+     * binary32 and binary64 are read from their bits (constexpr). The other formats (x87 long double...) use frexp.
+     * @tparam FloatingType
+     * @param value
+     * @return The decomposition (isFinite is false for infinities and NaN)
+     */
+    template<typename FloatingType>
+    constexpr DyadicDecomposition decomposeFloatingPoint(const FloatingType value) noexcept {
+        static_assert(std::is_floating_point_v<FloatingType>, "decomposeFloatingPoint needs a floating point type");
+        DyadicDecomposition result;
+
+        if constexpr (isBinaryInterchangeFormat<FloatingType>) {
+            using BitsType = typename IntegerOfSize<sizeof(FloatingType)>::Unsigned;
+            constexpr int FRACTION_BITS = std::numeric_limits<FloatingType>::digits - 1;
+            constexpr int EXPONENT_BITS = sizeof(FloatingType) * 8 - 1 - FRACTION_BITS;
+            constexpr int EXPONENT_MAX = (1 << EXPONENT_BITS) - 1;
+            constexpr int BIAS = EXPONENT_MAX / 2;
+
+            const auto bits = floatingPointBits<BitsType>(value);
+            const auto biasedExponent = static_cast<int>((bits >> FRACTION_BITS) & BitsType(EXPONENT_MAX));
+            const auto fraction = static_cast<std::uint64_t>(bits & ((BitsType(1) << FRACTION_BITS) - 1));
+
+            result.isNegative = (bits >> (sizeof(FloatingType) * 8 - 1)) != 0;
+            if (biasedExponent == EXPONENT_MAX) {
+                result.isFinite = false;
+                return result;
+            }
+
+            // Subnormals have no implicit leading bit and the exponent of the smallest normal number
+            result.mantissa = biasedExponent == 0 ? fraction : fraction | (std::uint64_t(1) << FRACTION_BITS);
+            result.exponent = (biasedExponent == 0 ? 1 : biasedExponent) - BIAS - FRACTION_BITS;
+        }
+        else {
+            if (!std::isfinite(value)) {
+                result.isFinite = false;
+                return result;
+            }
+
+            // The significand of these formats fits in 64 bits: scaling it by 2^digits gives an exact integer
+            static_assert(std::numeric_limits<FloatingType>::digits <= 64, "The significand must fit in 64 bits");
+            constexpr int DIGITS = std::numeric_limits<FloatingType>::digits;
+            int exponent = 0;
+            const FloatingType fraction = std::frexp(value, &exponent);
+            result.isNegative = std::signbit(value);
+            result.mantissa = static_cast<std::uint64_t>(std::ldexp(std::fabs(fraction), DIGITS));
+            result.exponent = exponent - DIGITS;
+        }
+
+        if (result.mantissa != 0) {
+            const int zeros = countTrailingZeros(result.mantissa);
+            result.mantissa >>= zeros;
+            result.exponent += zeros;
+        } else {
+            result.exponent = 0;
+        }
+        return result;
+    }
+
+    /**
+     * @brief 2^exponent in IntType: a shift for the builtin integers, a square-and-multiply for the others (BigInt)
+     * @tparam IntType
+     * @param exponent Must be positive and, for a builtin type, lower than its number of digits
+     * @return 2^exponent
+     */
+    template<typename IntType>
+    constexpr IntType powerOfTwo(unsigned int exponent) {
+        if constexpr (isBuiltinInteger<IntType>) {
+            return static_cast<IntType>(IntType(1) << exponent);
+        }
+        else {
+            IntType result(1), base(2);
+            while (exponent != 0) {
+                if (exponent & 1U) result *= base;
+                exponent >>= 1U;
+                if (exponent != 0) base *= base;
+            }
+            return result;
+        }
+    }
+}
@@ -0,0 +1,83 @@
+/**
+ * @file      FractionAccumulator.hpp
+ * @author    Elise MASSA
+ * @author    Mattéo LECLERCQ
+ * @date      2022
+ * @brief     Running sum of fractions over the least common multiple of their denominators, reduced only when
+ *            the accumulator is about to overflow
+ * @copyright WTFPL
+ */
+
+#pragma once
+
+#include "Gcd.hpp"
+#include "IntegerTraits.hpp"
+
+namespace Arkulib::Tools {
+    /**
+     * @brief numerator / denominator, the sum of the fractions added so far. The denominator is a multiple of every
+     * denominator added: a term whose denominator divides it costs a modulo, a multiplication and an addition (no gcd),
+     * a term with the same denominator only an addition.
+     * @tparam AccumulatorType A builtin integer (add can overflow) or an unbounded one like BigInt (it can't)
+     */
+    template<typename AccumulatorType>
+    struct FractionAccumulator {
+        AccumulatorType numerator = AccumulatorType(0);
+        AccumulatorType denominator = AccumulatorType(1);
+
+        /**
+         * @brief Add termNumerator / termDenominator. If an intermediate overflows, the accumulator is reduced and
+         * the term is tried again.
+         * @param termNumerator
+         * @param termDenominator Must be positive
+         * @return True if it still overflowed (the accumulator keeps the reduced sum without the term)
+         */
+        constexpr bool add(const AccumulatorType &termNumerator, const AccumulatorType &termDenominator) {
+            if (!addOverflow(termNumerator, termDenominator)) return false;
+            if constexpr (IntegerTraits<AccumulatorType>::isBounded) {
+                reduce();
+                return addOverflow(termNumerator, termDenominator);
+            }
+            else return false;
+        }
+
+        /**
+         * @brief Divide the numerator and the denominator by their gcd
+         */
+        constexpr void reduce() {
+            const AccumulatorType divisor = gcd(numerator, denominator);
+            if (divisor > AccumulatorType(1)) {
+                numerator /= divisor;
+                denominator /= divisor;
+            }
+        }
+
+    private:
+        constexpr bool addOverflow(const AccumulatorType &termNumerator, const AccumulatorType &termDenominator) {
+            AccumulatorType scaledTerm{}, newNumerator{};
+            if (termDenominator == denominator) {
+                if (Tools::addOverflow(numerator, termNumerator, newNumerator)) return true;
+                numerator = newNumerator;
+                return false;
+            }
+            if (denominator % termDenominator == AccumulatorType(0)) {
+                if (multiplyOverflow(termNumerator, AccumulatorType(denominator / termDenominator), scaledTerm)
+                    || Tools::addOverflow(numerator, scaledTerm, newNumerator)) return true;
+                numerator = newNumerator;
+                return false;
+            }
+
+            // New denominator: lcm(D, d) = D / g * d and n / D + t / d = (n * (d / g) + t * (D / g)) / lcm
+            const AccumulatorType divisor = gcd(denominator, termDenominator);
+            const AccumulatorType termFactor = termDenominator / divisor;
+            AccumulatorType scaledNumerator{}, newDenominator{};
+            if (multiplyOverflow(numerator, termFactor, scaledNumerator)
+                || multiplyOverflow(termNumerator, AccumulatorType(denominator / divisor), scaledTerm)
+                || Tools::addOverflow(scaledNumerator, scaledTerm, newNumerator)
+                || multiplyOverflow(denominator, termFactor, newDenominator)) return true;
+            numerator = newNumerator;
+            denominator = newDenominator;
+            return false;
+        }
+    };
+}
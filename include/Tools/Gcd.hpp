@@ -0,0 +1,229 @@
+/**
+ * @file      Gcd.hpp
+ * @author    Elise MASSA
+ * @author    Mattéo LECLERCQ
+ * @date      2022
+ * @brief     GCD engine used by the rationals: binary (Stein) GCD, Lehmer GCD for 128-bit integers and a
+ *            constexpr Euclidean fallback. Tools::gcd dispatches by the width of the integer type.
+ * @copyright WTFPL
+ */
+
+#pragma once
+
+#include <type_traits>
+#include <utility>
+#include "IntegerTraits.hpp"
+
+namespace Arkulib::Tools {
+    /************************************************************************************************************
+     ************************************************ BIT TOOLS *************************************************
+     ************************************************************************************************************/
+
+    /**
+     * @brief Count the trailing zero bits of a non-null unsigned integer
+     * @tparam UnsignedType
+     * @param value Must not be 0
+     * @return The number of trailing zeros
+     */
+    template<typename UnsignedType>
+    constexpr inline int countTrailingZeros(const UnsignedType value) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+        if constexpr (sizeof(UnsignedType) <= sizeof(unsigned int)) {
+            return __builtin_ctz(static_cast<unsigned int>(value));
+        }
+        else if constexpr (sizeof(UnsignedType) <= sizeof(unsigned long long)) {
+            return __builtin_ctzll(static_cast<unsigned long long>(value));
+        }
+        else {
+            const auto low = static_cast<unsigned long long>(value);
+            return low != 0 ? __builtin_ctzll(low) : 64 + countTrailingZeros(static_cast<unsigned long long>(value >> 64));
+        }
+#else
+        int count = 0;
+        for (UnsignedType remaining = value; (remaining & UnsignedType(1)) == UnsignedType(0); remaining >>= 1) ++count;
+        return count;
+#endif
+    }
+
+    /**
+     * @brief Count the leading zero bits of a non-null unsigned integer
+     * @tparam UnsignedType
+     * @param value Must not be 0
+     * @return The number of leading zeros
+     */
+    template<typename UnsignedType>
+    constexpr inline int countLeadingZeros(const UnsignedType value) noexcept {
+        constexpr int BITS = sizeof(UnsignedType) * 8;
+#if defined(__GNUC__) || defined(__clang__)
+        if constexpr (sizeof(UnsignedType) <= sizeof(unsigned long long)) {
+            return __builtin_clzll(static_cast<unsigned long long>(value)) - (64 - BITS);
+        }
+        else {
+            const auto high = static_cast<unsigned long long>(value >> 64);
+            return high != 0 ? __builtin_clzll(high) : 64 + countLeadingZeros(static_cast<unsigned long long>(value));
+        }
+#else
+        int count = 0;
+        for (UnsignedType mask = UnsignedType(1) << (BITS - 1); (value & mask) == UnsignedType(0); mask >>= 1) ++count;
+        return count;
+#endif
+    }
+
+    /**
+     * @brief Absolute value of a builtin integer as its unsigned counterpart (no overflow on the minimum value)
+     */
+    template<typename IntType>
+    constexpr inline UnsignedIntegerType<IntType> unsignedAbs(const IntType value) noexcept {
+        using UnsignedType = UnsignedIntegerType<IntType>;
+        return value < IntType(0) ? UnsignedType(UnsignedType(0) - UnsignedType(value)) : UnsignedType(value);
+    }
+
+    /************************************************************************************************************
+     ************************************************* KERNELS **************************************************
+     ************************************************************************************************************/
+
+    /**
+     * @brief Euclidean GCD. Works with every type that has %, even outside of the builtin integers.
+     * @tparam IntType
+     * @param a
+     * @param b
+     * @return The positive GCD of a and b (0 if both are 0)
+     */
+    template<typename IntType>
+    constexpr IntType euclideanGcd(IntType a, IntType b) noexcept {
+        while (b != IntType(0)) {
+            IntType remainder = a % b;
+            a = std::move(b);
+            b = std::move(remainder);
+        }
+        return a < IntType(0) ? IntType(-a) : a;
+    }
+
+    /**
+     * @brief Binary (Stein) GCD: only shifts and subtractions, the factors of 2 are removed with ctz
+     * @tparam UnsignedType
+     * @param u
+     * @param v
+     * @return The GCD of u and v (0 if both are 0)
+     */
+    template<typename UnsignedType>
+    constexpr UnsignedType binaryGcd(UnsignedType u, UnsignedType v) noexcept {
+        if (u == UnsignedType(0)) return v;
+        if (v == UnsignedType(0)) return u;
+
+        const int uZeros = countTrailingZeros(u);
+        const int vZeros = countTrailingZeros(v);
+        const int shift = uZeros < vZeros ? uZeros : vZeros;
+        u >>= uZeros;
+        v >>= vZeros;
+
+        // Both are odd here. ctz(u - v) == ctz(v - u): the shift doesn't wait for the comparison (shorter
+        // dependency chain). The highest bit keeps ctz defined when u == v (u then becomes 0 anyway).
+        constexpr UnsignedType HIGHEST_BIT = UnsignedType(UnsignedType(1) << (sizeof(UnsignedType) * 8 - 1));
+        while (u != UnsignedType(0)) {
+            const UnsignedType difference = UnsignedType(u - v);
+            const int differenceZeros = countTrailingZeros(UnsignedType(difference | HIGHEST_BIT));
+            const UnsignedType minimum = u < v ? u : v;
+            u = u > v ? difference : UnsignedType(v - u);
+            v = minimum;
+            u >>= differenceZeros;
+        }
+
+        return v << shift;
+    }
+
+#ifdef __SIZEOF_INT128__
+    /**
+     * @brief Lehmer GCD for 128-bit integers. The Euclidean quotients are guessed on the 62 leading bits with
+     * 64-bit arithmetic, then applied once to the full operands. When b fits in 64 bits, binaryGcd finishes.
+     * @param a
+     * @param b
+     * @return The GCD of a and b (0 if both are 0)
+     */
+    constexpr inline UInt128 lehmerGcd(UInt128 a, UInt128 b) noexcept {
+        constexpr UInt128 WORD = UInt128(1) << 64;
+        if (a < b) {
+            const UInt128 tmp = a;
+            a = b;
+            b = tmp;
+        }
+
+        while (b >= WORD) {
+            // Same shift on both operands: ah has exactly 62 significant bits
+            const int shift = 128 - countLeadingZeros(a) - 62;
+            auto ah = static_cast<std::int64_t>(a >> shift);
+            auto bh = static_cast<std::int64_t>(b >> shift);
+
+            // Cofactors of the simulated Euclid (Knuth, Algorithm L)
+            std::int64_t A = 1, B = 0, C = 0, D = 1;
+            while (bh + C != 0 && bh + D != 0) {
+                const std::int64_t quotient = (ah + A) / (bh + C);
+                if (quotient != (ah + B) / (bh + D)) break;
+
+                std::int64_t tmp = A - quotient * C; A = C; C = tmp;
+                tmp = B - quotient * D; B = D; D = tmp;
+                tmp = ah - quotient * bh; ah = bh; bh = tmp;
+            }
+
+            if (B == 0) {
+                // No quotient could be guessed: one full precision step
+                const UInt128 remainder = a % b;
+                a = b;
+                b = remainder;
+            } else {
+                // The true results are in [0, a): the wrapping unsigned arithmetic gives them exactly
+                const UInt128 newA = UInt128(A) * a + UInt128(B) * b;
+                const UInt128 newB = UInt128(C) * a + UInt128(D) * b;
+                a = newA;
+                b = newB;
+            }
+        }
+
+        if (b == 0) return a;
+        return binaryGcd<std::uint64_t>(static_cast<std::uint64_t>(a % b), static_cast<std::uint64_t>(b));
+    }
+#endif
+
+    /************************************************************************************************************
+     ************************************************* DISPATCH *************************************************
+     ************************************************************************************************************/
+
+    /**
+     * @brief True if IntegerTraits<IntType> provides its own gcd(a, b)
+     * @tparam IntType
+     */
+    template<typename IntType, typename = void>
+    constexpr bool hasTraitsGcd = false;
+
+    template<typename IntType>
+    constexpr bool hasTraitsGcd<IntType, std::void_t<decltype(IntegerTraits<IntType>::gcd(std::declval<IntType>(), std::declval<IntType>()))>> = true;
+
+    /**
+     * @brief GCD used by the whole library. Unlike std::gcd, it accepts the 128-bit integers in strict ISO mode.
+     *  - up to 64 bits: binaryGcd
+     *  - 128 bits: lehmerGcd
+     *  - a type whose IntegerTraits provide a gcd (BigInt): IntegerTraits<IntType>::gcd
+     *  - any other type (no fixed width): euclideanGcd
+     * @tparam IntType
+     * @param a
+     * @param b
+     * @return The positive GCD of a and b (0 if both are 0)
+     */
+    template<typename IntType>
+    constexpr inline IntType gcd(const IntType a, const IntType b) noexcept {
+        if constexpr (hasTraitsGcd<IntType>) {
+            return IntegerTraits<IntType>::gcd(a, b);
+        }
+        else if constexpr (!isBuiltinInteger<IntType>) {
+            return euclideanGcd(a, b);
+        }
+#ifdef __SIZEOF_INT128__
+        else if constexpr (sizeof(IntType) == sizeof(UInt128)) {
+            return static_cast<IntType>(lehmerGcd(unsignedAbs(a), unsignedAbs(b)));
+        }
+#endif
+        else {
+            return static_cast<IntType>(binaryGcd(unsignedAbs(a), unsignedAbs(b)));
+        }
+    }
+}
@@ -0,0 +1,61 @@
+/**
+ * @file      Hash.hpp
+ * @author    Elise MASSA
+ * @author    Mattéo LECLERCQ
+ * @date      2022
+ * @brief     Hash of the integers and of the reduced fractions, shared by std::hash<Rational> and RationalMap
+ * @copyright WTFPL
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+
+#include "IntegerTraits.hpp"
+
+namespace Arkulib::Tools {
+    /**
+     * @brief Finalizer of splitmix64: every bit of the input changes about half of the bits of the output, so the
+     * low bits (the slot of an open-addressing table) and the high bits (its tag) are both usable
+     */
+    constexpr inline std::uint64_t mixHash(std::uint64_t value) noexcept {
+        value ^= value >> 30;
+        value *= 0xBF58476D1CE4E5B9ULL;
+        value ^= value >> 27;
+        value *= 0x94D049BB133111EBULL;
+        return value ^ (value >> 31);
+    }
+
+    /**
+     * @brief The bits of an integer, not mixed: the value itself for the builtin integers, std::hash for the others
+     * (BigInt)
+     * @tparam IntType
+     * @param value
+     */
+    template<typename IntType>
+    inline std::uint64_t integerBits(const IntType &value) noexcept {
+        if constexpr (isBuiltinInteger<IntType> && sizeof(IntType) <= sizeof(std::uint64_t)) {
+            return static_cast<std::uint64_t>(value);
+        }
+        else if constexpr (isBuiltinInteger<IntType>) {
+            const auto bits = static_cast<UnsignedIntegerType<IntType>>(value);
+            return static_cast<std::uint64_t>(bits) ^ mixHash(static_cast<std::uint64_t>(bits >> 64));
+        }
+        else {
+            return static_cast<std::uint64_t>(std::hash<IntType>()(value));
+        }
+    }
+
+    /**
+     * @brief Hash of numerator / denominator. The fraction must be reduced with a positive denominator, for the
+     * equal rationals to have the same hash.
+     * @tparam IntType
+     * @param numerator
+     * @param denominator
+     */
+    template<typename IntType>
+    inline std::uint64_t hashFraction(const IntType &numerator, const IntType &denominator) noexcept {
+        return mixHash(integerBits(numerator) + mixHash(integerBits(denominator)));
+    }
+}
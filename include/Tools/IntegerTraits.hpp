@@ -0,0 +1,217 @@
+/**
+ * @file      IntegerTraits.hpp
+ * @author    Elise MASSA
+ * @author    Mattéo LECLERCQ
+ * @date      2022
+ * @brief     Width traits and overflow-checked primitives used by the Rational arithmetic
+ * @copyright WTFPL
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+namespace Arkulib::Tools {
+    /************************************************************************************************************
+     ********************************************** INTEGER OF SIZE *********************************************
+     ************************************************************************************************************/
+
+    /**
+     * @brief Give the signed and unsigned integer types of a given size (in bytes)
+     * @tparam Bytes
+     */
+    template<std::size_t Bytes>
+    struct IntegerOfSize {};
+
+    template<> struct IntegerOfSize<1> { using Signed = std::int8_t; using Unsigned = std::uint8_t; };
+    template<> struct IntegerOfSize<2> { using Signed = std::int16_t; using Unsigned = std::uint16_t; };
+    template<> struct IntegerOfSize<4> { using Signed = std::int32_t; using Unsigned = std::uint32_t; };
+    template<> struct IntegerOfSize<8> { using Signed = std::int64_t; using Unsigned = std::uint64_t; };
+#ifdef __SIZEOF_INT128__
+    __extension__ typedef __int128 Int128;
+    __extension__ typedef unsigned __int128 UInt128;
+    template<> struct IntegerOfSize<16> { using Signed = Int128; using Unsigned = UInt128; };
+#endif
+
+    /**
+     * @brief True for the fixed width integers handled by the compiler (__int128 included, even in strict ISO mode)
+     * @tparam IntType
+     */
+    template<typename IntType>
+    constexpr bool isBuiltinInteger = std::is_integral_v<IntType>
+#ifdef __SIZEOF_INT128__
+                                      || std::is_same_v<IntType, Int128> || std::is_same_v<IntType, UInt128>
+#endif
+    ;
+
+    /**
+     * @brief Describe an integer type usable as Rational<IntType>. Specialize it for a custom integer (see BigInt.hpp):
+     *  - isInteger: the type models the integers (+, -, *, truncated / and %, comparisons, built from an int)
+     *  - isBounded: the type has fixed limits and its operations can overflow
+     *  - gcd(a, b) (optional): a faster GCD than the generic Euclidean one
+     * @tparam IntType
+     */
+    template<typename IntType, typename = void>
+    struct IntegerTraits {
+        static constexpr bool isInteger = isBuiltinInteger<IntType>;
+        static constexpr bool isBounded = isBuiltinInteger<IntType>;
+    };
+
+#if defined(__cpp_concepts)
+    /**
+     * @brief An integer type accepted by Rational
+     * @tparam IntType
+     */
+    template<typename IntType>
+    concept RationalInteger = IntegerTraits<IntType>::isInteger && requires(IntType a, IntType b) {
+        a + b; a - b; a * b; a / b; a % b; -a;
+        a == b; a != b; a < b; a <= b; a > b; a >= b;
+        IntType(0);
+    };
+#endif
+
+    /************************************************************************************************************
+     *********************************************** WIDER INTEGER **********************************************
+     ************************************************************************************************************/
+
+    /**
+     * @brief Give the next wider signed integer type. If there is none (or IntType isn't a builtin integer),
+     * Type is IntType itself and isWider is false.
+     * @tparam IntType
+     */
+    template<typename IntType, typename = void>
+    struct WiderInteger {
+        using Type = IntType;
+        static constexpr bool isWider = false;
+    };
+
+    template<typename IntType>
+    struct WiderInteger<IntType, std::enable_if_t<isBuiltinInteger<IntType>, std::void_t<typename IntegerOfSize<sizeof(IntType) * 2>::Signed>>> {
+        using Type = typename IntegerOfSize<sizeof(IntType) * 2>::Signed;
+        static constexpr bool isWider = true;
+    };
+
+    template<typename IntType>
+    using WiderIntegerType = typename WiderInteger<IntType>::Type;
+
+    /**
+     * @brief Unsigned integer type with the same width as IntType (works for __int128 even in strict ISO mode)
+     * @tparam IntType
+     */
+    template<typename IntType>
+    using UnsignedIntegerType = typename IntegerOfSize<sizeof(IntType)>::Unsigned;
+
+    /************************************************************************************************************
+     ********************************************* OVERFLOW CHECKS **********************************************
+     ************************************************************************************************************/
+
+    /**
+     * @brief Check if a value can be stored in IntType without losing information
+     * @tparam IntType The destination type
+     * @tparam WideType
+     * @param value
+     * @return True if static_cast<IntType>(value) keeps the value
+     */
+    template<typename IntType, typename WideType>
+    constexpr inline bool fitsIn(const WideType value) noexcept {
+        return static_cast<WideType>(static_cast<IntType>(value)) == value;
+    }
+
+    /**
+     * @brief result = a + b
+     * @return True if the operation overflowed (result is then unspecified)
+     */
+    template<typename IntType>
+    constexpr inline bool addOverflow(const IntType a, const IntType b, IntType &result) noexcept {
+        if constexpr (!IntegerTraits<IntType>::isBounded) {
+            result = a + b;
+            return false;
+        } else {
+#if defined(__GNUC__) || defined(__clang__)
+            return __builtin_add_overflow(a, b, &result);
+#else
+            if ((b > 0 && a > std::numeric_limits<IntType>::max() - b) ||
+                (b < 0 && a < std::numeric_limits<IntType>::lowest() - b)) return true;
+            result = a + b;
+            return false;
+#endif
+        }
+    }
+
+    /**
+     * @brief result = a - b
+     * @return True if the operation overflowed (result is then unspecified)
+     */
+    template<typename IntType>
+    constexpr inline bool subtractOverflow(const IntType a, const IntType b, IntType &result) noexcept {
+        if constexpr (!IntegerTraits<IntType>::isBounded) {
+            result = a - b;
+            return false;
+        } else {
+#if defined(__GNUC__) || defined(__clang__)
+            return __builtin_sub_overflow(a, b, &result);
+#else
+            if ((b < 0 && a > std::numeric_limits<IntType>::max() + b) ||
+                (b > 0 && a < std::numeric_limits<IntType>::lowest() + b)) return true;
+            result = a - b;
+            return false;
+#endif
+        }
+    }
+
+    /**
+     * @brief result = a * b
+     * @return True if the operation overflowed (result is then unspecified)
+     */
+    template<typename IntType>
+    constexpr inline bool multiplyOverflow(const IntType a, const IntType b, IntType &result) noexcept {
+        if constexpr (!IntegerTraits<IntType>::isBounded) {
+            result = a * b;
+            return false;
+        } else {
+#if defined(__GNUC__) || defined(__clang__)
+            return __builtin_mul_overflow(a, b, &result);
+#else
+            if (a != 0 && b != 0) {
+                const IntType max = std::numeric_limits<IntType>::max();
+                const IntType min = std::numeric_limits<IntType>::lowest();
+                if ((a > 0 && b > 0 && a > max / b) || (a < 0 && b < 0 && a < max / b) ||
+                    (a > 0 && b < 0 && b < min / a) || (a < 0 && b > 0 && a < min / b)) return true;
+            }
+            result = a * b;
+            return false;
+#endif
+        }
+    }
+
+    /**
+     * @brief result = a * b + c * d (the cross product of an addition between two rationals)
+     * @return True if one of the operations overflowed
+     */
+    template<typename IntType>
+    constexpr inline bool crossAddOverflow(
+            const IntType a, const IntType b,
+            const IntType c, const IntType d,
+            IntType &result
+    ) noexcept {
+        IntType left{}, right{};
+        return multiplyOverflow(a, b, left) || multiplyOverflow(c, d, right) || addOverflow(left, right, result);
+    }
+
+    /**
+     * @brief result = a * b - c * d (the cross product of a subtraction between two rationals)
+     * @return True if one of the operations overflowed
+     */
+    template<typename IntType>
+    constexpr inline bool crossSubtractOverflow(
+            const IntType a, const IntType b,
+            const IntType c, const IntType d,
+            IntType &result
+    ) noexcept {
+        IntType left{}, right{};
+        return multiplyOverflow(a, b, left) || multiplyOverflow(c, d, right) || subtractOverflow(left, right, result);
+    }
+}
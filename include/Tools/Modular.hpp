@@ -0,0 +1,173 @@
+/**
+ * @file      Modular.hpp
+ * @author    Elise MASSA
+ * @author    Mattéo LECLERCQ
+ * @date      2022
+ * @brief     Word-size modular arithmetic for the multi-modular algorithms: Montgomery multiplication modulo 63-bit
+ *            primes, a deterministic primality test and the rational reconstruction of a residue
+ * @copyright WTFPL
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <utility>
+#include "Gcd.hpp"
+#include "IntegerTraits.hpp"
+
+namespace Arkulib::Tools {
+#ifdef __SIZEOF_INT128__
+    /**
+     * @brief Arithmetic modulo an odd modulus below 2^63 in the Montgomery form (a is stored as a * 2^64 mod modulus):
+     * a product costs two 64x64 multiplications and no division
+     */
+    class Montgomery {
+
+    public:
+        /**
+         * @param modulus Odd and below 2^63
+         */
+        constexpr explicit Montgomery(const std::uint64_t modulus) noexcept : m_modulus(modulus) {
+            // Newton iteration: every step doubles the number of correct low bits of modulus^-1 mod 2^64
+            std::uint64_t inverse = modulus;
+            for (int i = 0; i < 5; ++i) inverse *= std::uint64_t(2) - modulus * inverse;
+            m_negativeInverse = std::uint64_t(0) - inverse;
+
+            const std::uint64_t rModulo = (std::uint64_t(0) - modulus) % modulus;
+            m_rSquare = static_cast<std::uint64_t>(UInt128(rModulo) * rModulo % modulus);
+        }
+
+        [[nodiscard]] constexpr inline std::uint64_t modulus() const noexcept { return m_modulus; }
+
+        /**
+         * @return value * 2^64 mod modulus
+         */
+        [[nodiscard]] constexpr inline std::uint64_t toMontgomery(const std::uint64_t value) const noexcept {
+            return reduce(UInt128(value % m_modulus) * m_rSquare);
+        }
+
+        /**
+         * @return The value of a number in the Montgomery form
+         */
+        [[nodiscard]] constexpr inline std::uint64_t fromMontgomery(const std::uint64_t value) const noexcept {
+            return reduce(value);
+        }
+
+        [[nodiscard]] constexpr inline std::uint64_t multiply(const std::uint64_t a, const std::uint64_t b) const noexcept {
+            return reduce(UInt128(a) * b);
+        }
+
+        [[nodiscard]] constexpr inline std::uint64_t add(const std::uint64_t a, const std::uint64_t b) const noexcept {
+            const std::uint64_t sum = a + b;
+            return sum >= m_modulus ? sum - m_modulus : sum;
+        }
+
+        [[nodiscard]] constexpr inline std::uint64_t subtract(const std::uint64_t a, const std::uint64_t b) const noexcept {
+            return a >= b ? a - b : a + (m_modulus - b);
+        }
+
+        [[nodiscard]] constexpr std::uint64_t power(std::uint64_t base, std::uint64_t exponent) const noexcept {
+            std::uint64_t result = toMontgomery(1);
+            for (; exponent != 0; exponent >>= 1) {
+                if (exponent & 1U) result = multiply(result, base);
+                base = multiply(base, base);
+            }
+            return result;
+        }
+
+        /**
+         * @brief The inverse by Fermat's little theorem
+         * @param value Not zero, the modulus must be prime
+         */
+        [[nodiscard]] constexpr inline std::uint64_t inverse(const std::uint64_t value) const noexcept {
+            return power(value, m_modulus - 2);
+        }
+
+    private:
+        std::uint64_t m_modulus;
+        std::uint64_t m_negativeInverse = 0;
+        std::uint64_t m_rSquare = 0;
+
+        // value / 2^64 mod modulus, for value < modulus^2
+        [[nodiscard]] constexpr inline std::uint64_t reduce(const UInt128 value) const noexcept {
+            const std::uint64_t factor = static_cast<std::uint64_t>(value) * m_negativeInverse;
+            const auto result = static_cast<std::uint64_t>((value + UInt128(factor) * m_modulus) >> 64);
+            return result >= m_modulus ? result - m_modulus : result;
+        }
+    };
+
+    /**
+     * @brief Deterministic Miller-Rabin test (these 7 bases are enough for every 64-bit integer)
+     * @param value Below 2^63
+     * @return True if value is prime
+     */
+    constexpr bool isPrime(const std::uint64_t value) noexcept {
+        if (value < 2) return false;
+        for (const std::uint64_t small: {2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37}) {
+            if (value % small == 0) return value == small;
+        }
+
+        const int twos = countTrailingZeros(value - 1);
+        const std::uint64_t odd = (value - 1) >> twos;
+        const Montgomery arithmetic(value);
+        const std::uint64_t one = arithmetic.toMontgomery(1), minusOne = arithmetic.toMontgomery(value - 1);
+
+        for (const std::uint64_t base: {2ULL, 325ULL, 9375ULL, 28178ULL, 450775ULL, 9780504ULL, 1795265022ULL}) {
+            if (base % value == 0) continue;
+            std::uint64_t x = arithmetic.power(arithmetic.toMontgomery(base), odd);
+            if (x == one || x == minusOne) continue;
+            bool isWitness = true;
+            for (int i = 1; i < twos && isWitness; ++i) {
+                x = arithmetic.multiply(x, x);
+                if (x == minusOne) isWitness = false;
+            }
+            if (isWitness) return false;
+        }
+        return true;
+    }
+
+    /**
+     * @return The largest prime below value (0 if there is none)
+     */
+    constexpr std::uint64_t previousPrime(std::uint64_t value) noexcept {
+        if (value <= 3) return value == 3 ? 2 : 0;
+        for (value = (value & 1U) ? value - 2 : value - 1; value > 2; value -= 2) {
+            if (isPrime(value)) return value;
+        }
+        return 2;
+    }
+#endif
+
+    /**
+     * @brief Find numerator / denominator congruent to residue modulo modulus with |numerator| < bound and
+     * 0 < denominator <= bound, by the extended Euclidean algorithm stopped halfway.
+     * It is unique when 2 * bound^2 < modulus.
+     * @tparam IntType A signed integer type (BigInt for the multi-modular algorithms)
+     * @param residue In [0, modulus)
+     * @param modulus
+     * @param bound
+     * @param numerator Receives the numerator
+     * @param denominator Receives the denominator
+     * @return False if there is no such fraction
+     */
+    template<typename IntType>
+    bool rationalReconstruction(
+            const IntType &residue, const IntType &modulus, const IntType &bound, IntType &numerator, IntType &denominator
+    ) {
+        IntType r0 = modulus, r1 = residue, t0 = IntType(0), t1 = IntType(1);
+        while (!(r1 < bound)) {
+            const IntType quotient = r0 / r1;
+            r0 = r0 - quotient * r1;
+            t0 = t0 - quotient * t1;
+            std::swap(r0, r1);
+            std::swap(t0, t1);
+        }
+
+        const bool isNegative = t1 < IntType(0);
+        const IntType absoluteT = isNegative ? IntType(-t1) : t1;
+        if (absoluteT == IntType(0) || bound < absoluteT || gcd(r1, absoluteT) != IntType(1)) return false;
+        numerator = isNegative ? IntType(-r1) : r1;
+        denominator = absoluteT;
+        return true;
+    }
+}
@@ -0,0 +1,572 @@
+/**
+ * @file      SimdKernels.hpp
+ * @author    Elise MASSA
+ * @author    Mattéo LECLERCQ
+ * @date      2022
+ * @brief     Lane-wise kernels of RationalVector: SSE4.1, AVX2 and AVX-512 versions for 32-bit integers chosen at
+ *            runtime from the CPU features, and a scalar version for every other integer type
+ * @copyright WTFPL
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include "Comparison.hpp"
+#include "IntegerTraits.hpp"
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define ARKULIB_SIMD_X86 1
+#include <immintrin.h>
+#define ARKULIB_TARGET(isa) __attribute__((target(isa)))
+#else
+#define ARKULIB_SIMD_X86 0
+#endif
+
+namespace Arkulib::Tools::Simd {
+    /************************************************************************************************************
+     ************************************************* DISPATCH *************************************************
+     ************************************************************************************************************/
+
+    /**
+     * @brief Instruction sets with a kernel, from the slowest to the fastest
+     */
+    enum class Level {
+        Scalar,
+        Sse41,
+        Avx2,
+        Avx512
+    };
+
+    /**
+     * @brief Best instruction set supported by the CPU (and enabled by the OS)
+     */
+    inline Level detectLevel() noexcept {
+#if ARKULIB_SIMD_X86
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx512f")) return Level::Avx512;
+        if (__builtin_cpu_supports("avx2")) return Level::Avx2;
+        if (__builtin_cpu_supports("sse4.1")) return Level::Sse41;
+#endif
+        return Level::Scalar;
+    }
+
+    /**
+     * @brief Instruction set used by the kernels. Detected once, can be lowered with setLevel.
+     */
+    inline Level &activeLevel() noexcept {
+        static Level level = detectLevel();
+        return level;
+    }
+
+    /**
+     * @brief Choose the instruction set of the kernels (to compare them or to avoid the AVX-512 frequency drop).
+     * A level above the CPU capabilities is clamped to detectLevel().
+     * @param level
+     */
+    inline void setLevel(const Level level) noexcept {
+        const Level supported = detectLevel();
+        activeLevel() = level < supported ? level : supported;
+    }
+
+    /**
+     * @brief Set the bit of a lane in a bit mask (64 lanes per word)
+     */
+    inline void setLaneBit(std::uint64_t *mask, const std::size_t lane) noexcept {
+        mask[lane / 64] |= std::uint64_t(1) << (lane % 64);
+    }
+
+    /**
+     * @brief The SIMD kernels are written for signed 32-bit lanes: 32 x 32 -> 64-bit products exist on every level
+     */
+    template<typename IntType>
+    constexpr bool hasSimdKernels = ARKULIB_SIMD_X86 && std::is_integral_v<IntType> && std::is_signed_v<IntType>
+                                    && sizeof(IntType) == sizeof(std::int32_t);
+
+    /************************************************************************************************************
+     ************************************************** SCALAR **************************************************
+     ************************************************************************************************************/
+
+    /**
+     * @brief out = a * b + Sign * c * d for every lane (Sign is 1, -1 or 0). The overflowed lanes get their bit set.
+     */
+    template<int Sign, typename IntType>
+    inline void crossNarrowScalar(
+            const IntType *a, const IntType *b, const IntType *c, const IntType *d,
+            IntType *out, std::uint64_t *overflow, const std::size_t first, const std::size_t count
+    ) noexcept {
+        for (std::size_t lane = first; lane < count; ++lane) {
+            IntType result{};
+            bool hasOverflowed = multiplyOverflow(a[lane], b[lane], result);
+            if constexpr (Sign != 0) {
+                IntType product{};
+                hasOverflowed |= multiplyOverflow(c[lane], d[lane], product);
+                hasOverflowed |= Sign > 0 ? addOverflow(result, product, result) : subtractOverflow(result, product, result);
+            }
+            out[lane] = result;
+            if (hasOverflowed) setLaneBit(overflow, lane);
+        }
+    }
+
+    /**
+     * @brief out = a + Sign * b for every lane (Sign is 1 or -1). The overflowed lanes get their bit set.
+     */
+    template<int Sign, typename IntType>
+    inline void addNarrowScalar(
+            const IntType *a, const IntType *b, IntType *out, std::uint64_t *overflow, const std::size_t first, const std::size_t count
+    ) noexcept {
+        for (std::size_t lane = first; lane < count; ++lane) {
+            IntType result{};
+            const bool hasOverflowed = Sign > 0 ? addOverflow(a[lane], b[lane], result) : subtractOverflow(a[lane], b[lane], result);
+            out[lane] = result;
+            if (hasOverflowed) setLaneBit(overflow, lane);
+        }
+    }
+
+    /**
+     * @brief Compare n1 / d1 and n2 / d2 for every lane (positive denominators)
+     */
+    template<typename IntType>
+    inline void compareScalar(
+            const IntType *n1, const IntType *d1, const IntType *n2, const IntType *d2,
+            std::uint64_t *less, std::uint64_t *equal, const std::size_t first, const std::size_t count
+    ) noexcept {
+        for (std::size_t lane = first; lane < count; ++lane) {
+            const int order = compareFractions(n1[lane], d1[lane], n2[lane], d2[lane]);
+            if (order < 0) setLaneBit(less, lane);
+            if (order == 0) setLaneBit(equal, lane);
+        }
+    }
+
+    /**
+     * @brief out = numerator / denominator for every lane
+     */
+    template<typename IntType, typename FloatingType>
+    inline void divideToFloatingScalar(
+            const IntType *numerators, const IntType *denominators,
+            FloatingType *out, const std::size_t first, const std::size_t count
+    ) noexcept {
+        for (std::size_t lane = first; lane < count; ++lane) {
+            out[lane] = FloatingType(numerators[lane]) / FloatingType(denominators[lane]);
+        }
+    }
+
+#if ARKULIB_SIMD_X86
+    /************************************************************************************************************
+     ************************************************** SSE4.1 **************************************************
+     ************************************************************************************************************/
+
+    /**
+     * The 32 x 32 -> 64-bit multiplications (pmuldq) only read the even 32-bit lanes: the odd lanes are shifted down
+     * and multiplied apart. A 64-bit result fits in 32 bits if result + 2^31 < 2^32. The low halves of the even and
+     * odd results are blended back into 32-bit lanes.
+     */
+
+    template<int Sign>
+    ARKULIB_TARGET("sse4.1") inline void crossNarrowSse41(
+            const std::int32_t *a, const std::int32_t *b, const std::int32_t *c, const std::int32_t *d,
+            std::int32_t *out, std::uint64_t *overflow, const std::size_t count
+    ) noexcept {
+        const __m128i bias = _mm_set1_epi64x(0x80000000LL);
+        const __m128i zero = _mm_setzero_si128();
+        std::size_t lane = 0;
+        for (; lane + 4 <= count; lane += 4) {
+            const __m128i va = _mm_loadu_si128(reinterpret_cast<const __m128i *>(a + lane));
+            const __m128i vb = _mm_loadu_si128(reinterpret_cast<const __m128i *>(b + lane));
+            __m128i even = _mm_mul_epi32(va, vb);
+            __m128i odd = _mm_mul_epi32(_mm_srli_epi64(va, 32), _mm_srli_epi64(vb, 32));
+            if constexpr (Sign != 0) {
+                const __m128i vc = _mm_loadu_si128(reinterpret_cast<const __m128i *>(c + lane));
+                const __m128i vd = _mm_loadu_si128(reinterpret_cast<const __m128i *>(d + lane));
+                const __m128i evenProduct = _mm_mul_epi32(vc, vd);
+                const __m128i oddProduct = _mm_mul_epi32(_mm_srli_epi64(vc, 32), _mm_srli_epi64(vd, 32));
+                even = Sign > 0 ? _mm_add_epi64(even, evenProduct) : _mm_sub_epi64(even, evenProduct);
+                odd = Sign > 0 ? _mm_add_epi64(odd, oddProduct) : _mm_sub_epi64(odd, oddProduct);
+            }
+
+            const __m128i evenFits = _mm_cmpeq_epi64(_mm_srli_epi64(_mm_add_epi64(even, bias), 32), zero);
+            const __m128i oddFits = _mm_cmpeq_epi64(_mm_srli_epi64(_mm_add_epi64(odd, bias), 32), zero);
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(out + lane), _mm_blend_epi16(even, _mm_slli_epi64(odd, 32), 0xCC));
+
+            const int fits = _mm_movemask_ps(_mm_castsi128_ps(_mm_blend_epi16(evenFits, oddFits, 0xCC)));
+            overflow[lane / 64] |= static_cast<std::uint64_t>(~fits & 0xF) << (lane % 64);
+        }
+        crossNarrowScalar<Sign>(a, b, c, d, out, overflow, lane, count);
+    }
+
+    /**
+     * A signed addition overflowed if the result has not the sign of both operands: (a ^ r) & (b ^ r) < 0.
+     * For a subtraction, the operands have different signs and the result hasn't the sign of a: (a ^ b) & (a ^ r) < 0.
+     */
+
+    template<int Sign>
+    ARKULIB_TARGET("sse4.1") inline void addNarrowSse41(
+            const std::int32_t *a, const std::int32_t *b, std::int32_t *out, std::uint64_t *overflow, const std::size_t count
+    ) noexcept {
+        std::size_t lane = 0;
+        for (; lane + 4 <= count; lane += 4) {
+            const __m128i va = _mm_loadu_si128(reinterpret_cast<const __m128i *>(a + lane));
+            const __m128i vb = _mm_loadu_si128(reinterpret_cast<const __m128i *>(b + lane));
+            const __m128i result = Sign > 0 ? _mm_add_epi32(va, vb) : _mm_sub_epi32(va, vb);
+            const __m128i signs = Sign > 0
+                    ? _mm_and_si128(_mm_xor_si128(va, result), _mm_xor_si128(vb, result))
+                    : _mm_and_si128(_mm_xor_si128(va, vb), _mm_xor_si128(va, result));
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(out + lane), result);
+            overflow[lane / 64] |= static_cast<std::uint64_t>(_mm_movemask_ps(_mm_castsi128_ps(signs))) << (lane % 64);
+        }
+        addNarrowScalar<Sign>(a, b, out, overflow, lane, count);
+    }
+
+    ARKULIB_TARGET("sse4.1") inline void compareSse41(
+            const std::int32_t *n1, const std::int32_t *d1, const std::int32_t *n2, const std::int32_t *d2,
+            std::uint64_t *less, std::uint64_t *equal, const std::size_t count
+    ) noexcept {
+        // n1 * d2 - n2 * d1 never overflows 64 bits: its sign and its nullity give the order
+        const __m128i zero = _mm_setzero_si128();
+        const __m128i one = _mm_set1_epi64x(1);
+        std::size_t lane = 0;
+        for (; lane + 4 <= count; lane += 4) {
+            const __m128i vn1 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(n1 + lane));
+            const __m128i vd1 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(d1 + lane));
+            const __m128i vn2 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(n2 + lane));
+            const __m128i vd2 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(d2 + lane));
+            const __m128i even = _mm_sub_epi64(_mm_mul_epi32(vn1, vd2), _mm_mul_epi32(vn2, vd1));
+            const __m128i odd = _mm_sub_epi64(
+                    _mm_mul_epi32(_mm_srli_epi64(vn1, 32), _mm_srli_epi64(vd2, 32)),
+                    _mm_mul_epi32(_mm_srli_epi64(vn2, 32), _mm_srli_epi64(vd1, 32))
+            );
+
+            const __m128i isLess = _mm_blend_epi16(
+                    _mm_cmpeq_epi64(_mm_srli_epi64(even, 63), one), _mm_cmpeq_epi64(_mm_srli_epi64(odd, 63), one), 0xCC);
+            const __m128i isEqual = _mm_blend_epi16(_mm_cmpeq_epi64(even, zero), _mm_cmpeq_epi64(odd, zero), 0xCC);
+            less[lane / 64] |= static_cast<std::uint64_t>(_mm_movemask_ps(_mm_castsi128_ps(isLess))) << (lane % 64);
+            equal[lane / 64] |= static_cast<std::uint64_t>(_mm_movemask_ps(_mm_castsi128_ps(isEqual))) << (lane % 64);
+        }
+        compareScalar(n1, d1, n2, d2, less, equal, lane, count);
+    }
+
+    ARKULIB_TARGET("sse4.1") inline void divideToDoubleSse41(
+            const std::int32_t *numerators, const std::int32_t *denominators, double *out, const std::size_t count
+    ) noexcept {
+        std::size_t lane = 0;
+        for (; lane + 2 <= count; lane += 2) {
+            const __m128d numerator = _mm_cvtepi32_pd(_mm_loadl_epi64(reinterpret_cast<const __m128i *>(numerators + lane)));
+            const __m128d denominator = _mm_cvtepi32_pd(_mm_loadl_epi64(reinterpret_cast<const __m128i *>(denominators + lane)));
+            _mm_storeu_pd(out + lane, _mm_div_pd(numerator, denominator));
+        }
+        divideToFloatingScalar(numerators, denominators, out, lane, count);
+    }
+
+    /************************************************************************************************************
+     *************************************************** AVX2 ***************************************************
+     ************************************************************************************************************/
+
+    template<int Sign>
+    ARKULIB_TARGET("avx2") inline void crossNarrowAvx2(
+            const std::int32_t *a, const std::int32_t *b, const std::int32_t *c, const std::int32_t *d,
+            std::int32_t *out, std::uint64_t *overflow, const std::size_t count
+    ) noexcept {
+        const __m256i bias = _mm256_set1_epi64x(0x80000000LL);
+        const __m256i zero = _mm256_setzero_si256();
+        std::size_t lane = 0;
+        for (; lane + 8 <= count; lane += 8) {
+            const __m256i va = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(a + lane));
+            const __m256i vb = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(b + lane));
+            __m256i even = _mm256_mul_epi32(va, vb);
+            __m256i odd = _mm256_mul_epi32(_mm256_srli_epi64(va, 32), _mm256_srli_epi64(vb, 32));
+            if constexpr (Sign != 0) {
+                const __m256i vc = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(c + lane));
+                const __m256i vd = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(d + lane));
+                const __m256i evenProduct = _mm256_mul_epi32(vc, vd);
+                const __m256i oddProduct = _mm256_mul_epi32(_mm256_srli_epi64(vc, 32), _mm256_srli_epi64(vd, 32));
+                even = Sign > 0 ? _mm256_add_epi64(even, evenProduct) : _mm256_sub_epi64(even, evenProduct);
+                odd = Sign > 0 ? _mm256_add_epi64(odd, oddProduct) : _mm256_sub_epi64(odd, oddProduct);
+            }
+
+            const __m256i evenFits = _mm256_cmpeq_epi64(_mm256_srli_epi64(_mm256_add_epi64(even, bias), 32), zero);
+            const __m256i oddFits = _mm256_cmpeq_epi64(_mm256_srli_epi64(_mm256_add_epi64(odd, bias), 32), zero);
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(out + lane), _mm256_blend_epi32(even, _mm256_slli_epi64(odd, 32), 0xAA));
+
+            const int fits = _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_blend_epi32(evenFits, oddFits, 0xAA)));
+            overflow[lane / 64] |= static_cast<std::uint64_t>(~fits & 0xFF) << (lane % 64);
+        }
+        crossNarrowScalar<Sign>(a, b, c, d, out, overflow, lane, count);
+    }
+
+    template<int Sign>
+    ARKULIB_TARGET("avx2") inline void addNarrowAvx2(
+            const std::int32_t *a, const std::int32_t *b, std::int32_t *out, std::uint64_t *overflow, const std::size_t count
+    ) noexcept {
+        std::size_t lane = 0;
+        for (; lane + 8 <= count; lane += 8) {
+            const __m256i va = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(a + lane));
+            const __m256i vb = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(b + lane));
+            const __m256i result = Sign > 0 ? _mm256_add_epi32(va, vb) : _mm256_sub_epi32(va, vb);
+            const __m256i signs = Sign > 0
+                    ? _mm256_and_si256(_mm256_xor_si256(va, result), _mm256_xor_si256(vb, result))
+                    : _mm256_and_si256(_mm256_xor_si256(va, vb), _mm256_xor_si256(va, result));
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(out + lane), result);
+            overflow[lane / 64] |= static_cast<std::uint64_t>(_mm256_movemask_ps(_mm256_castsi256_ps(signs))) << (lane % 64);
+        }
+        addNarrowScalar<Sign>(a, b, out, overflow, lane, count);
+    }
+
+    ARKULIB_TARGET("avx2") inline void compareAvx2(
+            const std::int32_t *n1, const std::int32_t *d1, const std::int32_t *n2, const std::int32_t *d2,
+            std::uint64_t *less, std::uint64_t *equal, const std::size_t count
+    ) noexcept {
+        const __m256i zero = _mm256_setzero_si256();
+        std::size_t lane = 0;
+        for (; lane + 8 <= count; lane += 8) {
+            const __m256i vn1 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(n1 + lane));
+            const __m256i vd1 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(d1 + lane));
+            const __m256i vn2 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(n2 + lane));
+            const __m256i vd2 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(d2 + lane));
+            const __m256i even = _mm256_sub_epi64(_mm256_mul_epi32(vn1, vd2), _mm256_mul_epi32(vn2, vd1));
+            const __m256i odd = _mm256_sub_epi64(
+                    _mm256_mul_epi32(_mm256_srli_epi64(vn1, 32), _mm256_srli_epi64(vd2, 32)),
+                    _mm256_mul_epi32(_mm256_srli_epi64(vn2, 32), _mm256_srli_epi64(vd1, 32))
+            );
+
+            const __m256i isLess = _mm256_blend_epi32(_mm256_cmpgt_epi64(zero, even), _mm256_cmpgt_epi64(zero, odd), 0xAA);
+            const __m256i isEqual = _mm256_blend_epi32(_mm256_cmpeq_epi64(even, zero), _mm256_cmpeq_epi64(odd, zero), 0xAA);
+            less[lane / 64] |= static_cast<std::uint64_t>(_mm256_movemask_ps(_mm256_castsi256_ps(isLess))) << (lane % 64);
+            equal[lane / 64] |= static_cast<std::uint64_t>(_mm256_movemask_ps(_mm256_castsi256_ps(isEqual))) << (lane % 64);
+        }
+        compareScalar(n1, d1, n2, d2, less, equal, lane, count);
+    }
+
+    ARKULIB_TARGET("avx2") inline void divideToDoubleAvx2(
+            const std::int32_t *numerators, const std::int32_t *denominators, double *out, const std::size_t count
+    ) noexcept {
+        std::size_t lane = 0;
+        for (; lane + 4 <= count; lane += 4) {
+            const __m256d numerator = _mm256_cvtepi32_pd(_mm_loadu_si128(reinterpret_cast<const __m128i *>(numerators + lane)));
+            const __m256d denominator = _mm256_cvtepi32_pd(_mm_loadu_si128(reinterpret_cast<const __m128i *>(denominators + lane)));
+            _mm256_storeu_pd(out + lane, _mm256_div_pd(numerator, denominator));
+        }
+        divideToFloatingScalar(numerators, denominators, out, lane, count);
+    }
+
+    // GCC 12 warns about the undefined source operand of its own AVX-512 shift intrinsics
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+
+    /************************************************************************************************************
+     ************************************************* AVX-512 **************************************************
+     ************************************************************************************************************/
+
+    /**
+     * @brief Interleave the bits of the even and odd 64-bit lanes into a 16 lanes mask
+     */
+    constexpr inline std::uint64_t interleaveLaneBits(std::uint64_t even, std::uint64_t odd) noexcept {
+        even = (even | (even << 4)) & 0x0F0F;
+        even = (even | (even << 2)) & 0x3333;
+        even = (even | (even << 1)) & 0x5555;
+        odd = (odd | (odd << 4)) & 0x0F0F;
+        odd = (odd | (odd << 2)) & 0x3333;
+        odd = (odd | (odd << 1)) & 0x5555;
+        return even | (odd << 1);
+    }
+
+    template<int Sign>
+    ARKULIB_TARGET("avx512f") inline void crossNarrowAvx512(
+            const std::int32_t *a, const std::int32_t *b, const std::int32_t *c, const std::int32_t *d,
+            std::int32_t *out, std::uint64_t *overflow, const std::size_t count
+    ) noexcept {
+        const __m512i bias = _mm512_set1_epi64(0x80000000LL);
+        const __m512i zero = _mm512_setzero_si512();
+        std::size_t lane = 0;
+        for (; lane + 16 <= count; lane += 16) {
+            const __m512i va = _mm512_loadu_si512(a + lane);
+            const __m512i vb = _mm512_loadu_si512(b + lane);
+            __m512i even = _mm512_mul_epi32(va, vb);
+            __m512i odd = _mm512_mul_epi32(_mm512_srli_epi64(va, 32), _mm512_srli_epi64(vb, 32));
+            if constexpr (Sign != 0) {
+                const __m512i vc = _mm512_loadu_si512(c + lane);
+                const __m512i vd = _mm512_loadu_si512(d + lane);
+                const __m512i evenProduct = _mm512_mul_epi32(vc, vd);
+                const __m512i oddProduct = _mm512_mul_epi32(_mm512_srli_epi64(vc, 32), _mm512_srli_epi64(vd, 32));
+                even = Sign > 0 ? _mm512_add_epi64(even, evenProduct) : _mm512_sub_epi64(even, evenProduct);
+                odd = Sign > 0 ? _mm512_add_epi64(odd, oddProduct) : _mm512_sub_epi64(odd, oddProduct);
+            }
+
+            const __mmask8 evenFits = _mm512_cmpeq_epi64_mask(_mm512_srli_epi64(_mm512_add_epi64(even, bias), 32), zero);
+            const __mmask8 oddFits = _mm512_cmpeq_epi64_mask(_mm512_srli_epi64(_mm512_add_epi64(odd, bias), 32), zero);
+            _mm512_storeu_si512(out + lane, _mm512_mask_blend_epi32(0xAAAA, even, _mm512_slli_epi64(odd, 32)));
+
+            const std::uint64_t fits = interleaveLaneBits(evenFits, oddFits);
+            overflow[lane / 64] |= (~fits & 0xFFFF) << (lane % 64);
+        }
+        crossNarrowScalar<Sign>(a, b, c, d, out, overflow, lane, count);
+    }
+
+    template<int Sign>
+    ARKULIB_TARGET("avx512f") inline void addNarrowAvx512(
+            const std::int32_t *a, const std::int32_t *b, std::int32_t *out, std::uint64_t *overflow, const std::size_t count
+    ) noexcept {
+        const __m512i zero = _mm512_setzero_si512();
+        std::size_t lane = 0;
+        for (; lane + 16 <= count; lane += 16) {
+            const __m512i va = _mm512_loadu_si512(a + lane);
+            const __m512i vb = _mm512_loadu_si512(b + lane);
+            const __m512i result = Sign > 0 ? _mm512_add_epi32(va, vb) : _mm512_sub_epi32(va, vb);
+            const __m512i signs = Sign > 0
+                    ? _mm512_and_si512(_mm512_xor_si512(va, result), _mm512_xor_si512(vb, result))
+                    : _mm512_and_si512(_mm512_xor_si512(va, vb), _mm512_xor_si512(va, result));
+            _mm512_storeu_si512(out + lane, result);
+            overflow[lane / 64] |= static_cast<std::uint64_t>(_mm512_cmplt_epi32_mask(signs, zero)) << (lane % 64);
+        }
+        addNarrowScalar<Sign>(a, b, out, overflow, lane, count);
+    }
+
+    ARKULIB_TARGET("avx512f") inline void compareAvx512(
+            const std::int32_t *n1, const std::int32_t *d1, const std::int32_t *n2, const std::int32_t *d2,
+            std::uint64_t *less, std::uint64_t *equal, const std::size_t count
+    ) noexcept {
+        const __m512i zero = _mm512_setzero_si512();
+        std::size_t lane = 0;
+        for (; lane + 16 <= count; lane += 16) {
+            const __m512i vn1 = _mm512_loadu_si512(n1 + lane);
+            const __m512i vd1 = _mm512_loadu_si512(d1 + lane);
+            const __m512i vn2 = _mm512_loadu_si512(n2 + lane);
+            const __m512i vd2 = _mm512_loadu_si512(d2 + lane);
+            const __m512i even = _mm512_sub_epi64(_mm512_mul_epi32(vn1, vd2), _mm512_mul_epi32(vn2, vd1));
+            const __m512i odd = _mm512_sub_epi64(
+                    _mm512_mul_epi32(_mm512_srli_epi64(vn1, 32), _mm512_srli_epi64(vd2, 32)),
+                    _mm512_mul_epi32(_mm512_srli_epi64(vn2, 32), _mm512_srli_epi64(vd1, 32))
+            );
+
+            const std::uint64_t isLess = interleaveLaneBits(_mm512_cmplt_epi64_mask(even, zero), _mm512_cmplt_epi64_mask(odd, zero));
+            const std::uint64_t isEqual = interleaveLaneBits(_mm512_cmpeq_epi64_mask(even, zero), _mm512_cmpeq_epi64_mask(odd, zero));
+            less[lane / 64] |= isLess << (lane % 64);
+            equal[lane / 64] |= isEqual << (lane % 64);
+        }
+        compareScalar(n1, d1, n2, d2, less, equal, lane, count);
+    }
+
+    ARKULIB_TARGET("avx512f") inline void divideToDoubleAvx512(
+            const std::int32_t *numerators, const std::int32_t *denominators, double *out, const std::size_t count
+    ) noexcept {
+        std::size_t lane = 0;
+        for (; lane + 8 <= count; lane += 8) {
+            const __m512d numerator = _mm512_cvtepi32_pd(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(numerators + lane)));
+            const __m512d denominator = _mm512_cvtepi32_pd(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(denominators + lane)));
+            _mm512_storeu_pd(out + lane, _mm512_div_pd(numerator, denominator));
+        }
+        divideToFloatingScalar(numerators, denominators, out, lane, count);
+    }
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#endif
+
+    /************************************************************************************************************
+     ************************************************* KERNELS **************************************************
+     ************************************************************************************************************/
+
+    /**
+     * @brief out = a * b + Sign * c * d for every lane, Sign being 1, -1 or 0 (then c and d aren't read).
+     * The bit of every lane whose result doesn't fit in IntType is set in overflow (its output is unspecified).
+     * For 32-bit integers, the products are exact in 64 bits as long as b and d are positive (denominators).
+     * @tparam Sign
+     * @tparam IntType
+     * @param overflow (count + 63) / 64 words, the bits are only set
+     */
+    template<int Sign, typename IntType>
+    inline void crossNarrow(
+            const IntType *a, const IntType *b, const IntType *c, const IntType *d,
+            IntType *out, std::uint64_t *overflow, const std::size_t count
+    ) noexcept {
+#if ARKULIB_SIMD_X86
+        if constexpr (hasSimdKernels<IntType>) {
+            using Lane = const std::int32_t *;
+            const auto lanes = [](const IntType *pointer) { return reinterpret_cast<Lane>(pointer); };
+            auto *result = reinterpret_cast<std::int32_t *>(out);
+            switch (activeLevel()) {
+                case Level::Avx512: return crossNarrowAvx512<Sign>(lanes(a), lanes(b), lanes(c), lanes(d), result, overflow, count);
+                case Level::Avx2: return crossNarrowAvx2<Sign>(lanes(a), lanes(b), lanes(c), lanes(d), result, overflow, count);
+                case Level::Sse41: return crossNarrowSse41<Sign>(lanes(a), lanes(b), lanes(c), lanes(d), result, overflow, count);
+                case Level::Scalar: break;
+            }
+        }
+#endif
+        crossNarrowScalar<Sign>(a, b, c, d, out, overflow, 0, count);
+    }
+
+    /**
+     * @brief out = a + Sign * b for every lane, Sign being 1 or -1.
+     * The bit of every lane whose result doesn't fit in IntType is set in overflow (its output is unspecified).
+     */
+    template<int Sign, typename IntType>
+    inline void addNarrow(
+            const IntType *a, const IntType *b, IntType *out, std::uint64_t *overflow, const std::size_t count
+    ) noexcept {
+#if ARKULIB_SIMD_X86
+        if constexpr (hasSimdKernels<IntType>) {
+            const auto *aLanes = reinterpret_cast<const std::int32_t *>(a);
+            const auto *bLanes = reinterpret_cast<const std::int32_t *>(b);
+            auto *result = reinterpret_cast<std::int32_t *>(out);
+            switch (activeLevel()) {
+                case Level::Avx512: return addNarrowAvx512<Sign>(aLanes, bLanes, result, overflow, count);
+                case Level::Avx2: return addNarrowAvx2<Sign>(aLanes, bLanes, result, overflow, count);
+                case Level::Sse41: return addNarrowSse41<Sign>(aLanes, bLanes, result, overflow, count);
+                case Level::Scalar: break;
+            }
+        }
+#endif
+        addNarrowScalar<Sign>(a, b, out, overflow, 0, count);
+    }
+
+    /**
+     * @brief Compare n1 / d1 and n2 / d2 for every lane (the denominators must be positive)
+     * @param less Bit set if n1 / d1 < n2 / d2
+     * @param equal Bit set if n1 / d1 == n2 / d2
+     */
+    template<typename IntType>
+    inline void compare(
+            const IntType *n1, const IntType *d1, const IntType *n2, const IntType *d2,
+            std::uint64_t *less, std::uint64_t *equal, const std::size_t count
+    ) noexcept {
+#if ARKULIB_SIMD_X86
+        if constexpr (hasSimdKernels<IntType>) {
+            using Lane = const std::int32_t *;
+            const auto lanes = [](const IntType *pointer) { return reinterpret_cast<Lane>(pointer); };
+            switch (activeLevel()) {
+                case Level::Avx512: return compareAvx512(lanes(n1), lanes(d1), lanes(n2), lanes(d2), less, equal, count);
+                case Level::Avx2: return compareAvx2(lanes(n1), lanes(d1), lanes(n2), lanes(d2), less, equal, count);
+                case Level::Sse41: return compareSse41(lanes(n1), lanes(d1), lanes(n2), lanes(d2), less, equal, count);
+                case Level::Scalar: break;
+            }
+        }
+#endif
+        compareScalar(n1, d1, n2, d2, less, equal, 0, count);
+    }
+
+    /**
+     * @brief out = numerator / denominator for every lane
+     */
+    template<typename IntType, typename FloatingType>
+    inline void divideToFloating(
+            const IntType *numerators, const IntType *denominators, FloatingType *out, const std::size_t count
+    ) noexcept {
+#if ARKULIB_SIMD_X86
+        if constexpr (hasSimdKernels<IntType> && std::is_same_v<FloatingType, double>) {
+            const auto *numeratorLanes = reinterpret_cast<const std::int32_t *>(numerators);
+            const auto *denominatorLanes = reinterpret_cast<const std::int32_t *>(denominators);
+            switch (activeLevel()) {
+                case Level::Avx512: return divideToDoubleAvx512(numeratorLanes, denominatorLanes, out, count);
+                case Level::Avx2: return divideToDoubleAvx2(numeratorLanes, denominatorLanes, out, count);
+                case Level::Sse41: return divideToDoubleSse41(numeratorLanes, denominatorLanes, out, count);
+                case Level::Scalar: break;
+            }
+        }
+#endif
+        divideToFloatingScalar(numerators, denominators, out, 0, count);
+    }
+}
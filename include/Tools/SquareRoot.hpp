@@ -0,0 +1,74 @@
+/**
+ * @file      SquareRoot.hpp
+ * @author    Elise MASSA
+ * @author    Mattéo LECLERCQ
+ * @date      2022
+ * @brief     Integer square root and perfect square test, for the exact Rational::sqrt
+ * @copyright WTFPL
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <utility>
+
+#include "Gcd.hpp"
+#include "IntegerTraits.hpp"
+
+namespace Arkulib::Tools {
+    /**
+     * @brief floor(sqrt(value)) by Newton's iteration on the integers, from the power of 2 just above the root: the
+     * iterates decrease to the root and the number of correct bits doubles at every step (6 or 7 steps for 64 bits)
+     * @tparam IntType A builtin integer or BigInt
+     * @param value Must not be negative
+     * @return The integer square root
+     */
+    template<typename IntType>
+    constexpr IntType isqrt(const IntType &value) {
+        if (value < IntType(2)) return value;
+
+        if constexpr (isBuiltinInteger<IntType>) {
+            using UnsignedType = UnsignedIntegerType<IntType>;
+            const auto radicand = static_cast<UnsignedType>(value);
+            const int bits = static_cast<int>(sizeof(UnsignedType) * 8) - countLeadingZeros(radicand);
+
+            UnsignedType root = UnsignedType(1) << ((bits + 1) / 2);
+            for (;;) {
+                const UnsignedType next = (root + radicand / root) / 2;
+                if (next >= root) return static_cast<IntType>(root);
+                root = next;
+            }
+        }
+
+        else {
+            // 2^ceil(bits / 2) by squaring
+            IntType root(1), power(2);
+            for (std::size_t exponent = (value.bitLength() + 1) / 2; exponent != 0; exponent /= 2) {
+                if (exponent % 2 == 1) root = root * power;
+                power = power * power;
+            }
+            for (;;) {
+                IntType next = (root + value / root) / IntType(2);
+                if (!(next < root)) return root;
+                root = std::move(next);
+            }
+        }
+    }
+
+    /**
+     * @brief Check if a value is the square of an integer. 3 values out of 4 are rejected by their residue modulo
+     * 16 (a square is 0, 1, 4 or 9 modulo 16) before any root is computed.
+     * @tparam IntType
+     * @param value Must not be negative
+     * @param root Receives floor(sqrt(value)) when the residue doesn't reject value
+     * @return True if value = root^2
+     */
+    template<typename IntType>
+    constexpr bool isPerfectSquare(const IntType &value, IntType &root) {
+        const auto residue = static_cast<unsigned>(static_cast<int>(value % IntType(16)));
+        if (((0x0213U >> residue) & 1U) == 0) return false;
+
+        root = isqrt(value);
+        return root * root == value;
+    }
+}
@@ -25,6 +25,19 @@ namespace Arkulib::Tools {
         return std::round(value * precision) / precision;
     }
 
+    /**
+     * @brief Same as roundToWantedPrecision(value, precision) == 0, usable in constant expressions (std::round isn't)
+     * @tparam FloatingType
+     * @param value
+     * @param precision
+     * @return True if the value is rounded to 0 (false for NaN)
+     */
+    template <typename FloatingType = double>
+    constexpr bool isRoundedToZero(const FloatingType value, const int precision = 10e4) {
+        const FloatingType scaled = value * precision;
+        return scaled < FloatingType(0.5) && scaled > FloatingType(-0.5);
+    }
+
     /**
      * @brief Let the user set the precision while transforming a floating point to a string
      * @tparam Type
@@ -51,6 +64,8 @@ namespace Arkulib::Tools {
      */
     template <typename Type>
     int getNumberLength(const Type value) {
-        return trunc(log10(value));
+        // log10 is -inf for 0 and NaN for the negative numbers, neither converts to int
+        if (value == Type(0)) return 0;
+        return trunc(log10(value < Type(0) ? -static_cast<long double>(value) : static_cast<long double>(value)));
     }
 }
\ No newline at end of file
@@ -0,0 +1,70 @@
+/**
+ * @file      Varint.hpp
+ * @author    Elise MASSA
+ * @author    Mattéo LECLERCQ
+ * @date      2022
+ * @brief     Zigzag and variable-length (LEB128) encoding of 64-bit integers, for the binary format of RationalIO.hpp
+ * @copyright WTFPL
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace Arkulib::Tools {
+    constexpr std::size_t MAX_VARINT_BYTES = 10; /*!< Bytes of the largest 64-bit varint */
+
+    /**
+     * @brief Map the signed integers to the unsigned ones by magnitude: 0, -1, 1, -2, ... become 0, 1, 2, 3, ...
+     * so that small negative numbers have short varints
+     */
+    constexpr inline std::uint64_t zigzagEncode(const std::int64_t value) noexcept {
+        return (static_cast<std::uint64_t>(value) << 1) ^ (value < 0 ? ~std::uint64_t(0) : std::uint64_t(0));
+    }
+
+    constexpr inline std::int64_t zigzagDecode(const std::uint64_t value) noexcept {
+        return static_cast<std::int64_t>((value >> 1) ^ (std::uint64_t(0) - (value & 1U)));
+    }
+
+    /**
+     * @brief Write value 7 bits per byte, low bits first, the high bit of a byte tells if another one follows
+     * @param value
+     * @param output At least MAX_VARINT_BYTES bytes
+     * @return The end of the written bytes
+     */
+    constexpr inline unsigned char *writeVarint(std::uint64_t value, unsigned char *output) noexcept {
+        while (value >= 0x80U) {
+            *output++ = static_cast<unsigned char>(value | 0x80U);
+            value >>= 7;
+        }
+        *output++ = static_cast<unsigned char>(value);
+        return output;
+    }
+
+    /**
+     * @brief Read a varint from [input, last), input is moved after it
+     * @param input
+     * @param last
+     * @param value Receives the value
+     * @return False if the varint is truncated or longer than MAX_VARINT_BYTES
+     */
+    constexpr inline bool readVarint(const unsigned char *&input, const unsigned char *const last, std::uint64_t &value) noexcept {
+        // Fast path: one byte
+        if (input != last && *input < 0x80U) {
+            value = *input++;
+            return true;
+        }
+
+        std::uint64_t result = 0;
+        for (unsigned shift = 0; input != last && shift < 7 * MAX_VARINT_BYTES; shift += 7) {
+            const unsigned char byte = *input++;
+            result |= static_cast<std::uint64_t>(byte & 0x7FU) << shift;
+            if (byte < 0x80U) {
+                value = result;
+                return true;
+            }
+        }
+        return false;
+    }
+}
@@ -0,0 +1,99 @@
+#include <climits>
+#include <gtest/gtest.h>
+#include "../../include/BigInt.hpp"
+
+using Arkulib::BigInt;
+
+namespace {
+    BigInt power(const BigInt &base, const int exponent) {
+        BigInt result = 1;
+        for (int i = 0; i < exponent; ++i) result *= base;
+        return result;
+    }
+}
+
+TEST (ArkulibBigInt, Construction) {
+    ASSERT_EQ (BigInt().toString(), "0");
+    ASSERT_EQ (BigInt(LLONG_MIN).toString(), "-9223372036854775808");
+    ASSERT_EQ (BigInt(ULLONG_MAX).toString(), "18446744073709551615");
+    ASSERT_EQ (BigInt("-000123").toString(), "-123");
+    ASSERT_EQ (BigInt(1e30).toString(), "1000000000000000019884624838656");
+    ASSERT_EQ (BigInt(-2.75), BigInt(-2));
+    ASSERT_EQ (static_cast<long long int>(BigInt(LLONG_MIN)), LLONG_MIN);
+    ASSERT_DOUBLE_EQ (static_cast<double>(power(2, 200)), std::ldexp(1., 200));
+}
+
+TEST (ArkulibBigInt, SmallBufferOptimization) {
+    const BigInt value = power(2, 127);
+    ASSERT_TRUE(value.isInline());
+    ASSERT_FALSE((value * 2).isInline());
+
+    BigInt moved = value * 2;
+    BigInt target = std::move(moved);
+    ASSERT_EQ (target.toString(), "340282366920938463463374607431768211456");
+    ASSERT_TRUE(moved.isZero());
+}
+
+TEST (ArkulibBigInt, Arithmetic) {
+    const BigInt a("123456789012345678901234567890");
+    const BigInt b("-987654321098765432109876543210");
+
+    ASSERT_EQ (a + b, BigInt("-864197532086419753208641975320"));
+    ASSERT_EQ (a - b, BigInt("1111111110111111111011111111100"));
+    ASSERT_EQ (a * b, BigInt("-121932631137021795226185032733622923332237463801111263526900"));
+    ASSERT_EQ (b / a, BigInt(-8));
+    ASSERT_EQ (b % a, BigInt("-9000000000900000000090"));
+    ASSERT_EQ (-a + a, BigInt(0));
+}
+
+TEST (ArkulibBigInt, KnownValues) {
+    ASSERT_EQ (power(2, 200).toString(), "1606938044258990275541962092341162602522202993782792835301376");
+    ASSERT_EQ (power(3, 150).toString(), "369988485035126972924700782451696644186473100389722973815184405301748249");
+
+    BigInt factorial = 1;
+    for (int i = 2; i <= 60; ++i) factorial *= i;
+    ASSERT_EQ (factorial.toString(), "8320987112741390144276341183223364380754172606361245952449277696409600000000000000");
+}
+
+TEST (ArkulibBigInt, KaratsubaAndDivision) {
+    // Far above the Karatsuba threshold: the division (independent of the multiplication) checks the product
+    const BigInt a = power(BigInt("98765432109876543210987654321"), 60) + 12345;
+    const BigInt b = power(BigInt("12345678901234567890123456789"), 45) - 6789;
+    const BigInt product = a * b;
+
+    ASSERT_GT (b.limbCount(), BigInt::KARATSUBA_THRESHOLD);
+    ASSERT_EQ (product / b, a);
+    ASSERT_EQ (product % a, BigInt(0));
+    ASSERT_EQ ((product + 17) % b, BigInt(17));
+    ASSERT_EQ ((a + b) * (a + b), a * a + 2 * a * b + b * b);
+}
+
+TEST (ArkulibBigInt, Comparison) {
+    ASSERT_LT (BigInt(-5), BigInt(3));
+    ASSERT_LT (BigInt("-100000000000000000000000"), BigInt(-5));
+    ASSERT_GT (power(2, 100), power(2, 99));
+    ASSERT_EQ (BigInt(0), -BigInt(0));
+    ASSERT_NE (BigInt(7), BigInt(-7));
+}
+
+TEST (ArkulibBigInt, Gcd) {
+    ASSERT_EQ (BigInt::gcd(0, 0), BigInt(0));
+    ASSERT_EQ (BigInt::gcd(-12, 18), BigInt(6));
+
+    // Common factor large enough for every kernel: binary, Lehmer and half-GCD
+    for (const int exponent: {10, 60, 400, 2500}) {
+        const BigInt common = power(BigInt("1000000007"), exponent / 10) * 3;
+        const BigInt a = common * (power(2, exponent) + 1);
+        const BigInt b = common * (power(3, exponent / 2) + 2);
+        ASSERT_EQ (BigInt::gcd(a, b), common * BigInt::gcd(power(2, exponent) + 1, power(3, exponent / 2) + 2));
+        ASSERT_EQ (Arkulib::Tools::gcd(a, b), Arkulib::Tools::euclideanGcd(a, b));
+    }
+}
+
+TEST (ArkulibBigInt, IncrementDecrement) {
+    BigInt value(-1);
+    ASSERT_EQ (++value, BigInt(0));
+    ASSERT_EQ (value++, BigInt(0));
+    ASSERT_EQ (--value, BigInt(0));
+    ASSERT_EQ (--value, BigInt(-1));
+}
@@ -0,0 +1,131 @@
+#include <climits>
+#include <random>
+#include <vector>
+#include <gtest/gtest.h>
+#include "../../include/CommonDenominatorVector.hpp"
+
+using Vector = Arkulib::CommonDenominatorVector<int>;
+using Level = Arkulib::Tools::Simd::Level;
+
+namespace {
+    const std::vector<Level> levels = {Level::Scalar, Level::Sse41, Level::Avx2, Level::Avx512};
+
+    std::vector<Arkulib::Rational<int>> randomPrices(const std::size_t size, const unsigned seed, const int denominator, const int bound) {
+        std::mt19937 generator(seed);
+        std::uniform_int_distribution<int> numerators(-bound, bound);
+        std::vector<Arkulib::Rational<int>> prices;
+        for (std::size_t i = 0; i < size; ++i) prices.emplace_back(numerators(generator), denominator);
+        return prices;
+    }
+}
+
+TEST (ArkulibCommonDenominatorVector, Construction) {
+    const Vector vector(std::vector<Arkulib::Rational<int>>{{1, 4}, {1, 6}, {3, 1}, {-5, 12}});
+    ASSERT_EQ (vector.size(), 4);
+    ASSERT_EQ (vector.getDenominator(), 12);
+    ASSERT_EQ (vector.numerators()[0], 3);
+    ASSERT_EQ (vector.numerators()[2], 36);
+    ASSERT_EQ (vector.get(1), Arkulib::Rational<int>(1, 6));
+    ASSERT_EQ (vector.toRationals()[3], Arkulib::Rational<int>(-5, 12));
+
+    // The lazy rationals are reduced first
+    const Arkulib::CommonDenominatorVector<int> lazy(std::vector<Arkulib::Rational<int, Arkulib::Policies::Lazy>>{{2, 8}, {3, -6}});
+    ASSERT_EQ (lazy.getDenominator(), 4);
+    ASSERT_EQ (lazy.numerators()[1], -2);
+
+    ASSERT_THROW(Vector(3, 0), Arkulib::Exceptions::DivideByZeroException);
+    ASSERT_THROW(Vector(std::vector<Arkulib::Rational<int>>{{1, 65536}, {1, 65537}}), Arkulib::Exceptions::NumberTooLargeException);
+}
+
+TEST (ArkulibCommonDenominatorVector, PushBackRescales) {
+    Vector vector;
+    vector.push_back(Arkulib::Rational<int>(1, 256));
+    vector.push_back(Arkulib::Rational<int>(3, 4));
+    ASSERT_EQ (vector.getDenominator(), 256);
+    ASSERT_EQ (vector.numerators()[1], 192);
+
+    vector.push_back(Arkulib::Rational<int>(1, 3));
+    ASSERT_EQ (vector.getDenominator(), 768);
+    ASSERT_EQ (vector.get(0), Arkulib::Rational<int>(1, 256));
+    ASSERT_EQ (vector.get(2), Arkulib::Rational<int>(1, 3));
+
+    vector.set(0, Arkulib::Rational<int>(1, 2));
+    vector.simplify();
+    ASSERT_EQ (vector.getDenominator(), 12);
+    ASSERT_EQ (vector.get(1), Arkulib::Rational<int>(3, 4));
+
+    ASSERT_THROW(vector.push_back(Arkulib::Rational<int>(1, INT_MAX)), Arkulib::Exceptions::NumberTooLargeException);
+    ASSERT_EQ (vector.size(), 3);
+    ASSERT_EQ (vector.getDenominator(), 12);
+
+    // The rescaling to 60 succeeds, then the numerator overflows: simplify goes back to 12
+    ASSERT_THROW(vector.push_back(Arkulib::Rational<int>(INT_MAX, 5)), Arkulib::Exceptions::NumberTooLargeException);
+    ASSERT_EQ (vector.size(), 3);
+    ASSERT_EQ (vector.getDenominator(), 60);
+    vector.simplify();
+    ASSERT_EQ (vector.getDenominator(), 12);
+    ASSERT_EQ (vector.get(2), Arkulib::Rational<int>(1, 3));
+}
+
+TEST (ArkulibCommonDenominatorVector, SameDenominator) {
+    for (const int bound: {1000, INT_MAX}) {
+        const Vector a(randomPrices(203, 1, 256, bound)), b(randomPrices(203, 2, 256, bound));
+        for (const Level level: levels) {
+            Arkulib::Tools::Simd::setLevel(level);
+            Vector sum, difference;
+            const Arkulib::LaneMask sumOverflow = Vector::add(a, b, sum);
+            const Arkulib::LaneMask differenceOverflow = Vector::subtract(a, b, difference);
+            ASSERT_EQ (sum.getDenominator(), a.getDenominator());
+            for (std::size_t index = 0; index < a.size(); ++index) {
+                const long long exactSum = (long long) a.numerators()[index] + b.numerators()[index];
+                const long long exactDifference = (long long) a.numerators()[index] - b.numerators()[index];
+                ASSERT_EQ (sumOverflow.test(index), exactSum != (int) exactSum) << index;
+                ASSERT_EQ (differenceOverflow.test(index), exactDifference != (int) exactDifference) << index;
+                if (!sumOverflow.test(index)) {
+                    ASSERT_EQ (sum.get(index), a.get(index) + b.get(index));
+                } else {
+                    ASSERT_EQ (sum.numerators()[index], 0);
+                }
+                if (!differenceOverflow.test(index)) {
+                    ASSERT_EQ (difference.get(index), a.get(index) - b.get(index));
+                }
+            }
+            ASSERT_EQ (sumOverflow.any(), bound == INT_MAX);
+        }
+    }
+    Arkulib::Tools::Simd::setLevel(Arkulib::Tools::Simd::detectLevel());
+}
+
+TEST (ArkulibCommonDenominatorVector, DifferentDenominators) {
+    const Vector a(randomPrices(70, 3, 12, 1000)), b(randomPrices(70, 4, 18, 1000));
+    ASSERT_EQ (a.getDenominator(), 12);
+    Vector result = a;
+    ASSERT_FALSE(Vector::add(result, b, result).any());
+    ASSERT_EQ (result.getDenominator(), 36);
+    for (std::size_t index = 0; index < a.size(); ++index) ASSERT_EQ (result.get(index), a.get(index) + b.get(index));
+
+    // 1/4 + 1/4 = 2/4 everywhere: simplify finds 1/2
+    const Vector quarters(std::vector<Arkulib::Rational<int>>(5, {1, 4}));
+    Vector halves = quarters + quarters;
+    ASSERT_EQ (halves.getDenominator(), 4);
+    halves.simplify();
+    ASSERT_EQ (halves.getDenominator(), 2);
+    ASSERT_EQ (halves.numerators()[4], 1);
+    ASSERT_EQ ((halves - quarters).get(0), Arkulib::Rational<int>(1, 4));
+
+    // The common denominator doesn't fit: every element overflows
+    const Vector large(std::vector<Arkulib::Rational<int>>(3, {1, 65537}));
+    Vector overflowed;
+    ASSERT_EQ (Vector::add(large, Vector(std::vector<Arkulib::Rational<int>>(3, {1, 65536})), overflowed).count(), 3);
+    ASSERT_THROW(large + Vector(std::vector<Arkulib::Rational<int>>(3, {1, 65536})), Arkulib::Exceptions::NumberTooLargeException);
+}
+
+TEST (ArkulibCommonDenominatorVector, Conversions) {
+    const Vector vector(std::vector<Arkulib::Rational<int>>{{1, 4}, {-1, 2}, {0, 1}});
+    const Arkulib::RationalVector<int> lanes = vector.toRationalVector();
+    ASSERT_EQ (lanes.denominators()[2], 4);
+    ASSERT_EQ (lanes.get(1), Arkulib::Rational<int>(-1, 2));
+    const std::vector<double> reals = vector.toRealNumber();
+    ASSERT_DOUBLE_EQ (reals[0], 0.25);
+    ASSERT_DOUBLE_EQ (reals[1], -0.5);
+}
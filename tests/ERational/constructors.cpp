@@ -45,4 +45,22 @@ TEST (ArkulibERationalConstructor, FullConstructor) {
     ASSERT_NEAR(r1.toRealNumber(), (2.2 * std::pow(10, 11)) / (3.3 * std::pow(10, 12)), 10e-7);
 }
 
+TEST (ArkulibERationalConstructor, FromFloatingPoint) {
+    Arkulib::ERational r1{0.375};
+    ASSERT_EQ(r1.toRealNumber(), 0.375);
+
+    // The continued fractions turned these values into 0
+    // The denominator (2^1049) isn't finite as a double: compare the multipliers and the exponents
+    Arkulib::ERational r2{-1e-300};
+    const int decimalExponent = r2.getNumExponent() - r2.getDenExponent() + 300;
+    ASSERT_NEAR(r2.getNumMultiplier() / r2.getDenMultiplier() * std::pow(10, decimalExponent), -1., 1e-12);
+
+    Arkulib::ERational r3{4.9e-324};
+    ASSERT_EQ(r3.getDenExponent(), 323);
+    ASSERT_NEAR(r3.getDenMultiplier() * r3.getNumMultiplier(), 2.0240225330731624, 1e-12);
+
+    Arkulib::ERational r4{1e300};
+    ASSERT_NEAR(r4.toRealNumber() / 1e300, 1., 1e-12);
+}
+
 //ToDO Fix les 10e4
\ No newline at end of file
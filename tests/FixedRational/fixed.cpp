@@ -0,0 +1,81 @@
+#include <climits>
+#include <random>
+#include <sstream>
+#include <gtest/gtest.h>
+#include "../../include/FixedRational.hpp"
+
+using Cents = Arkulib::FixedRational<int, 100>;
+using Frames = Arkulib::FixedRational<long long, 48000>;
+
+TEST (ArkulibFixedRational, Construction) {
+    static_assert(sizeof(Cents) == sizeof(int));
+    static_assert(Cents::getDenominator() == 100);
+
+    constexpr Cents price = Cents::fromNumerator(1999);
+    static_assert(price.getNumerator() == 1999 && price.toInteger() == 19);
+    static_assert(Cents(3).getNumerator() == 300);
+    static_assert(Cents().isZero());
+
+    EXPECT_EQ (Cents(Arkulib::Rational<int>(1, 4)).getNumerator(), 25);
+    // 1/3 = 33.33 cents, 2/3 = 66.67 cents, -1/8 = -12.5 cents
+    EXPECT_EQ (Cents(Arkulib::Rational<int>(1, 3)).getNumerator(), 33);
+    EXPECT_EQ (Cents(Arkulib::Rational<int>(2, 3)).getNumerator(), 67);
+    EXPECT_EQ (Cents(Arkulib::Rational<int>(-1, 8)).getNumerator(), -13);
+}
+
+TEST (ArkulibFixedRational, ConversionToRational) {
+    EXPECT_EQ (Cents::fromNumerator(25).toRational(), Arkulib::Rational<int>(1, 4));
+    EXPECT_EQ (Arkulib::Rational<int>(Cents::fromNumerator(-150)), Arkulib::Rational<int>(-3, 2));
+    EXPECT_DOUBLE_EQ (Frames::fromNumerator(24000).toRealNumber(), 0.5);
+
+    std::ostringstream stream;
+    stream << Cents::fromNumerator(150);
+    EXPECT_EQ (stream.str(), Arkulib::Rational<int>(3, 2).toString());
+}
+
+TEST (ArkulibFixedRational, SameValueAsRational) {
+    std::mt19937 generator(7);
+    std::uniform_int_distribution<long long> numerators(-48000 * 100, 48000 * 100);
+    for (int i = 0; i < 500; ++i) {
+        const Frames a = Frames::fromNumerator(numerators(generator)), b = Frames::fromNumerator(numerators(generator));
+        const Arkulib::Rational<long long> ra = a.toRational<Arkulib::Rational<long long>>();
+        const Arkulib::Rational<long long> rb = b.toRational<Arkulib::Rational<long long>>();
+
+        ASSERT_EQ ((a + b).toRational<Arkulib::Rational<long long>>(), ra + rb);
+        ASSERT_EQ ((a - b).toRational<Arkulib::Rational<long long>>(), ra - rb);
+        ASSERT_EQ (a * b, Frames(ra * rb));
+        if (!b.isZero()) {
+            ASSERT_EQ (a / b, Frames(ra / rb));
+        }
+        ASSERT_EQ (a < b, ra < rb);
+        ASSERT_EQ (-a + a, Frames());
+    }
+}
+
+TEST (ArkulibFixedRational, IntegerOperands) {
+    constexpr Cents price = Cents::fromNumerator(1999);
+    static_assert((price * 3).getNumerator() == 5997);
+    static_assert((3 * price) == price * 3);
+    static_assert((price / 2).getNumerator() == 1000);
+    static_assert((price / -2).getNumerator() == -1000);
+
+    Cents total;
+    for (int i = 0; i < 4; ++i) total += price;
+    total /= 4;
+    EXPECT_EQ (total, price);
+}
+
+TEST (ArkulibFixedRational, Errors) {
+    const Cents large = Cents::fromNumerator(INT_MAX);
+    ASSERT_THROW (static_cast<void>(large + Cents::fromNumerator(1)), Arkulib::Exceptions::NumberTooLargeException);
+    ASSERT_THROW (static_cast<void>(large * Cents(2)), Arkulib::Exceptions::NumberTooLargeException);
+    ASSERT_THROW (static_cast<void>(Cents(1) / Cents()), Arkulib::Exceptions::DivideByZeroException);
+    ASSERT_THROW (static_cast<void>(Cents(1) / 0), Arkulib::Exceptions::DivideByZeroException);
+    ASSERT_THROW (static_cast<void>(Cents(INT_MAX / 10)), Arkulib::Exceptions::NumberTooLargeException);
+
+    using Saturating = Arkulib::FixedRational<int, 100, Arkulib::Policies::Approximate<>>;
+    Arkulib::Policies::Approximate<>::resetStats();
+    EXPECT_EQ ((Saturating::fromNumerator(INT_MAX) + Saturating(1)).getNumerator(), INT_MAX);
+    EXPECT_EQ ((Saturating::fromNumerator(INT_MIN) * Saturating(2)).getNumerator(), INT_MIN);
+    EXPECT_EQ (Arkulib::Policies::Approximate<>::stats().count, 2U);
+}
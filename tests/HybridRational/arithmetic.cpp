@@ -0,0 +1,116 @@
+#include <climits>
+#include <gtest/gtest.h>
+#include "../../include/HybridRational.hpp"
+
+using Hybrid = Arkulib::HybridRational<>;
+
+TEST (ArkulibHybridRational, Construction) {
+    Hybrid r1(6, -4);
+    ASSERT_TRUE(r1.isSmall());
+    ASSERT_EQ (r1.toString(), "(-3 / 2)");
+    ASSERT_TRUE(r1.isNegative());
+    ASSERT_TRUE(Hybrid().isZero());
+    ASSERT_EQ (Hybrid(5), Hybrid(10, 2));
+
+    // -INT64_MIN doesn't fit in 64 bits
+    Hybrid r2(LLONG_MIN, -1);
+    ASSERT_TRUE(r2.isBig());
+    ASSERT_EQ (r2.toString(), "(9223372036854775808 / 1)");
+    Hybrid r3(LLONG_MIN, 2);
+    ASSERT_TRUE(r3.isSmall());
+    ASSERT_EQ (r3.toString(), "(-4611686018427387904 / 1)");
+
+    ASSERT_THROW(Hybrid(1, 0), Arkulib::Exceptions::DivideByZeroException);
+}
+
+TEST (ArkulibHybridRational, SmallOperations) {
+    Hybrid r1(1, 2);
+    Hybrid r2(1, 3);
+
+    ASSERT_EQ (r1 + r2, Hybrid(5, 6));
+    ASSERT_EQ (r1 - r2, Hybrid(1, 6));
+    ASSERT_EQ (r1 * r2, Hybrid(1, 6));
+    ASSERT_EQ (r1 / r2, Hybrid(3, 2));
+    ASSERT_EQ (-r1, Hybrid(-1, 2));
+    ASSERT_EQ (1 + r1, Hybrid(3, 2));
+    ASSERT_TRUE((r1 + r2).isSmall());
+    ASSERT_THROW(r1 / Hybrid::Zero(), Arkulib::Exceptions::DivideByZeroException);
+}
+
+TEST (ArkulibHybridRational, PromoteThenDemote) {
+    Hybrid r1(LLONG_MAX);
+    r1 += 1;
+    ASSERT_TRUE(r1.isBig());
+    ASSERT_EQ (r1.toString(), "(9223372036854775808 / 1)");
+
+    r1 -= 1;
+    ASSERT_TRUE(r1.isSmall());
+    ASSERT_EQ (r1, Hybrid(LLONG_MAX));
+
+    // The product overflows, the division cancels it
+    Hybrid r2(1LL << 40, 3);
+    Hybrid r3(1LL << 40, 5);
+    Hybrid product = r2 * r3;
+    ASSERT_TRUE(product.isBig());
+    ASSERT_EQ (product.getNumerator(), Arkulib::BigInt(1LL << 40) * Arkulib::BigInt(1LL << 40));
+
+    Hybrid quotient = product / Hybrid(1LL << 40);
+    ASSERT_TRUE(quotient.isSmall());
+    ASSERT_EQ (quotient, Hybrid(1LL << 40, 15));
+}
+
+TEST (ArkulibHybridRational, MinimumFromKernels) {
+    // The 64-bit kernels can give INT64_MIN: it must be stored like the constructed value
+    const Hybrid product = Hybrid(-(1LL << 62), 1) * Hybrid(2, 1);
+    ASSERT_TRUE(product.isBig());
+    ASSERT_EQ (product, Hybrid(LLONG_MIN, 1));
+    ASSERT_FALSE(product < Hybrid(LLONG_MIN, 1));
+    ASSERT_FALSE(product > Hybrid(LLONG_MIN, 1));
+
+    ASSERT_EQ (Hybrid(-(1LL << 62), 1) - Hybrid(1LL << 62, 1), Hybrid(LLONG_MIN));
+    ASSERT_EQ (Hybrid(LLONG_MIN, 3) * Hybrid(3, 1), Hybrid(LLONG_MIN));
+}
+
+TEST (ArkulibHybridRational, MatchesBigRational) {
+    // The denominators of the harmonic sum leave 64 bits around n = 46
+    Hybrid sum;
+    Arkulib::Rational<Arkulib::BigInt> expected;
+    for (int k = 1; k <= 60; ++k) {
+        sum += Hybrid(1, k);
+        expected += Arkulib::Rational<Arkulib::BigInt>(1, k);
+    }
+    ASSERT_TRUE(sum.isBig());
+    ASSERT_EQ (sum.toBigRational(), expected);
+
+    // Going back down the sum demotes it
+    for (int k = 60; k >= 2; --k) sum -= Hybrid(1, k);
+    ASSERT_TRUE(sum.isSmall());
+    ASSERT_EQ (sum, Hybrid::One());
+}
+
+TEST (ArkulibHybridRational, Comparison) {
+    Hybrid small(LLONG_MAX - 1, LLONG_MAX);
+    Hybrid big = Hybrid(LLONG_MAX) * Hybrid(LLONG_MAX);
+
+    ASSERT_TRUE(big.isBig());
+    ASSERT_LT (small, big);
+    ASSERT_GT (big, small);
+    ASSERT_NE (small, big);
+    ASSERT_LT (small, Hybrid::One());
+    ASSERT_LE (big, big);
+    ASSERT_GE (-small, -big);
+}
+
+TEST (ArkulibHybridRational, Conversion) {
+    const Arkulib::Rational<int> rational(3, 9);
+    Hybrid r1(rational);
+    ASSERT_EQ (r1, Hybrid(1, 3));
+    ASSERT_DOUBLE_EQ (r1.toRealNumber(), 1. / 3.);
+
+    Hybrid r2 = Hybrid(LLONG_MAX) * Hybrid(4);
+    ASSERT_DOUBLE_EQ (r2.toRealNumber(), 4. * static_cast<double>(LLONG_MAX));
+
+    Hybrid copy = r2;
+    ASSERT_TRUE(copy.isBig());
+    ASSERT_EQ (copy, r2);
+}
@@ -0,0 +1,115 @@
+#include <climits>
+#include <cmath>
+#include <random>
+#include <vector>
+#include <gtest/gtest.h>
+#include "../../include/ERational.hpp"
+#include "../../include/Parallel.hpp"
+
+namespace {
+    std::vector<Arkulib::Rational<long long>> randomRationals(const std::size_t count) {
+        std::mt19937 generator(11);
+        std::uniform_int_distribution<int> numerators(-1000, 1000), denominators(1, 24);
+        std::vector<Arkulib::Rational<long long>> rationals;
+        rationals.reserve(count);
+        for (std::size_t i = 0; i < count; ++i) rationals.emplace_back(numerators(generator), denominators(generator));
+        return rationals;
+    }
+}
+
+TEST (ArkulibParallel, Sum) {
+    const std::vector<Arkulib::Rational<long long>> rationals = randomRationals(50000);
+    const Arkulib::Rational<long long> expected = Arkulib::sum(rationals);
+    for (const std::size_t threadCount: {1, 2, 3, 8}) {
+        ASSERT_EQ (Arkulib::Parallel::sum(rationals, {threadCount, 1000}), expected);
+    }
+    ASSERT_EQ (Arkulib::Parallel::sum(rationals), expected);
+    ASSERT_TRUE(Arkulib::Parallel::sum(std::vector<Arkulib::Rational<int>>()).isZero());
+
+    // The partial sums of the chunks overflow int, the total doesn't
+    const std::vector<Arkulib::Rational<int>> large = {{INT_MAX, 1}, {INT_MAX, 1}, {-INT_MAX, 1}, {-INT_MAX, 1}, {1, 2}};
+    ASSERT_EQ (Arkulib::Parallel::sum(large, {2, 2}), Arkulib::Rational<int>(1, 2));
+}
+
+TEST (ArkulibParallel, SumOfBigChunks) {
+    // The partial sums of the first two chunks overflow the wide type: both chunks go on with BigInt before the merge
+    const int primes[] = {1000000007, 1000000009, 1000000021, 1000000033, 1000000087, 1000000093, 1000000097, 1000000103};
+    std::vector<Arkulib::Rational<int>> values;
+    for (const int prime: primes) values.emplace_back(1, prime);
+    for (const int prime: primes) values.emplace_back(-1, prime);
+    values.emplace_back(1, 2);
+
+    ASSERT_EQ (Arkulib::sum(values), Arkulib::Rational<int>(1, 2));
+    for (const std::size_t threadCount: {1, 2, 3}) {
+        ASSERT_EQ (Arkulib::Parallel::sum(values, {threadCount, 8}), Arkulib::Rational<int>(1, 2));
+    }
+}
+
+TEST (ArkulibParallel, Reduce) {
+    const std::vector<Arkulib::Rational<long long>> rationals = randomRationals(10000);
+    const auto maximum = [](const Arkulib::Rational<long long> &a, const Arkulib::Rational<long long> &b) { return a < b ? b : a; };
+    const Arkulib::Rational<long long> expected = *std::max_element(rationals.begin(), rationals.end());
+    for (const std::size_t threadCount: {1, 4}) {
+        ASSERT_EQ (Arkulib::Parallel::reduce(rationals.begin(), rationals.end(), rationals[0], maximum, {threadCount, 100}), expected);
+    }
+
+    // The exception of the first failing chunk reaches the caller
+    const std::vector<Arkulib::Rational<int>> overflowing(1000, Arkulib::Rational<int>(INT_MAX / 2 + 1));
+    ASSERT_THROW(Arkulib::Parallel::reduce(overflowing.begin(), overflowing.end(), Arkulib::Rational<int>(), std::plus<>(), {4, 10}),
+                 Arkulib::Exceptions::NumberTooLargeException);
+}
+
+TEST (ArkulibParallel, ThreadErrors) {
+    // The errors raised in the worker threads reach the status of the calling thread
+    using Flagged = Arkulib::Rational<int, Arkulib::Policies::Canonical, Arkulib::Policies::StatusFlag>;
+    const std::vector<Flagged> overflowing(1000, Flagged(INT_MAX / 2 + 1));
+    for (const std::size_t threadCount: {1, 4}) {
+        Arkulib::Policies::StatusFlag::clear();
+        (void) Arkulib::Parallel::reduce(overflowing.begin(), overflowing.end(), Flagged(), std::plus<>(), {threadCount, 10});
+        ASSERT_TRUE (Arkulib::Policies::StatusFlag::status() == Arkulib::ArkulibError::NumberTooLarge);
+    }
+
+    Arkulib::Policies::StatusFlag::clear();
+    std::vector<Flagged> inverses(overflowing.size());
+    const std::vector<Flagged> zeros(100);
+    Arkulib::Parallel::transform(zeros.begin(), zeros.end(), inverses.begin(), [](const Flagged &r) { return Flagged(1) / r; }, {4, 10});
+    ASSERT_TRUE (Arkulib::Policies::StatusFlag::status() == Arkulib::ArkulibError::DivideByZero);
+
+    // The first error of the calling thread is kept
+    Arkulib::Parallel::transform(overflowing.begin(), overflowing.end(), inverses.begin(), [](const Flagged &r) { return r + r; }, {4, 10});
+    ASSERT_TRUE (Arkulib::Policies::StatusFlag::status() == Arkulib::ArkulibError::DivideByZero);
+    Arkulib::Policies::StatusFlag::clear();
+
+    // The statistics of the approximations are merged
+    using Approximated = Arkulib::Rational<int, Arkulib::Policies::Canonical, Arkulib::Policies::Approximate<>>;
+    const std::vector<Approximated> thirds(64, Approximated(INT_MAX / 3, 7));
+    Arkulib::Policies::Approximate<>::resetStats();
+    std::vector<Approximated> squares(thirds.size());
+    Arkulib::Parallel::transform(thirds.begin(), thirds.end(), squares.begin(), [](const Approximated &r) { return r * r; }, {4, 4});
+    ASSERT_EQ (Arkulib::Policies::Approximate<>::stats().count, thirds.size());
+    Arkulib::Policies::Approximate<>::resetStats();
+}
+
+TEST (ArkulibParallel, DeterministicERational) {
+    std::mt19937 generator(5);
+    std::uniform_int_distribution<int> numerators(-1000, 1000), denominators(1, 50);
+    std::vector<Arkulib::ERational<>> values;
+    for (int i = 0; i < 128; ++i) values.emplace_back(numerators(generator), denominators(generator));
+    values[7] = Arkulib::ERational<>(0, 5);
+
+    // The rounding of ERational depends on the order of the additions: it's the same for every thread count
+    const double expected = Arkulib::Parallel::sum(values, {1, 4}).toRealNumber();
+    ASSERT_NEAR (expected, Arkulib::Parallel::sum(values, {1, 128}).toRealNumber(), 1e-6 * std::abs(expected));
+    for (const std::size_t threadCount: {2, 5, 16}) {
+        ASSERT_EQ (Arkulib::Parallel::sum(values, {threadCount, 4}).toRealNumber(), expected);
+    }
+}
+
+TEST (ArkulibParallel, Transform) {
+    const std::vector<Arkulib::Rational<long long>> rationals = randomRationals(5000);
+    std::vector<Arkulib::Rational<long long>> squares(rationals.size());
+    const auto end = Arkulib::Parallel::transform(rationals.begin(), rationals.end(), squares.begin(),
+                                                  [](const Arkulib::Rational<long long> &r) { return r * r; }, {4, 128});
+    ASSERT_EQ (end, squares.end());
+    for (std::size_t i = 0; i < rationals.size(); ++i) ASSERT_EQ (squares[i], rationals[i] * rationals[i]);
+}
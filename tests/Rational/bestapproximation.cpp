@@ -0,0 +1,87 @@
+#include <climits>
+#include <cmath>
+#include <random>
+#include <gtest/gtest.h>
+#include "../../include/BigInt.hpp"
+#include "../../include/Rational.hpp"
+
+TEST (ArkulibBestApproximation, KnownValues) {
+    ASSERT_EQ (Arkulib::Rational<int>::bestApproximation(M_PI, 10), Arkulib::Rational<int>(22, 7));
+    ASSERT_EQ (Arkulib::Rational<int>::bestApproximation(M_PI, 1000), Arkulib::Rational<int>(355, 113));
+    ASSERT_EQ (Arkulib::Rational<int>::bestApproximation(-M_PI, 1000), Arkulib::Rational<int>(-355, 113));
+    ASSERT_EQ (Arkulib::Rational<long long int>::bestApproximation(M_PI, 100000), Arkulib::Rational<long long int>(312689, 99532));
+    ASSERT_EQ (Arkulib::Rational<int>::bestApproximation(0.1, 1000), Arkulib::Rational<int>(1, 10));
+    ASSERT_EQ (Arkulib::Rational<int>::bestApproximation(0.333, 100), Arkulib::Rational<int>(1, 3));
+    ASSERT_EQ (Arkulib::Rational<int>::bestApproximation(2.0, 1), Arkulib::Rational<int>(2));
+    ASSERT_EQ (Arkulib::Rational<int>::bestApproximation(0., 5), Arkulib::Rational<int>::Zero());
+
+    // The fromFloatingPoint threshold turned this value into 0
+    ASSERT_EQ (Arkulib::Rational<int>::bestApproximation(0.001, 5000), Arkulib::Rational<int>(1, 1000));
+    ASSERT_EQ (Arkulib::Rational<int>::bestApproximation(1e-300, INT_MAX), Arkulib::Rational<int>::Zero());
+    ASSERT_EQ (Arkulib::Rational<int>::bestApproximation(1.5e-10, INT_MAX), Arkulib::Rational<int>::Zero());
+    ASSERT_EQ (Arkulib::Rational<int>::bestApproximation(3e-10, INT_MAX), Arkulib::Rational<int>(1, INT_MAX));
+    ASSERT_EQ (Arkulib::Rational<int>::bestApproximation(1e-9, INT_MAX), Arkulib::Rational<int>(1, 1000000000));
+
+    // Large enough denominator budget: the exact value
+    ASSERT_EQ (Arkulib::Rational<long long int>::bestApproximation(0.1, LLONG_MAX), Arkulib::Rational<long long int>(0.1, Arkulib::Exact));
+}
+
+TEST (ArkulibBestApproximation, Ties) {
+    // 0.125 is between 0 / 1 and 1 / 4 with a budget of 4: the smaller denominator wins
+    ASSERT_EQ (Arkulib::Rational<int>::bestApproximation(0.125, 4), Arkulib::Rational<int>::Zero());
+    ASSERT_EQ (Arkulib::Rational<int>::bestApproximation(0.25, 2), Arkulib::Rational<int>::Zero());
+    ASSERT_EQ (Arkulib::Rational<int>::bestApproximation(0.375, 4), Arkulib::Rational<int>(1, 3));
+}
+
+TEST (ArkulibBestApproximation, Errors) {
+    EXPECT_THROW(static_cast<void>(Arkulib::Rational<int>::bestApproximation(0.5, 0)), Arkulib::Exceptions::DivideByZeroException);
+    EXPECT_THROW(static_cast<void>(Arkulib::Rational<int>::bestApproximation(1e10, 100)), Arkulib::Exceptions::NumberTooLargeException);
+    EXPECT_THROW(static_cast<void>(Arkulib::Rational<int>::bestApproximation(NAN, 100)), Arkulib::Exceptions::NumberTooLargeException);
+
+    // Just below 2^31: saturated to INT_MAX
+    ASSERT_EQ (Arkulib::Rational<int>::bestApproximation(2147483647.4, 100), Arkulib::Rational<int>(INT_MAX));
+}
+
+TEST (ArkulibBestApproximation, MatchesBruteForce) {
+    using BigRational = Arkulib::Rational<Arkulib::BigInt>;
+    std::mt19937_64 generator(3);
+    std::uniform_real_distribution<double> distribution(-5., 5.);
+
+    for (int i = 0; i < 200; ++i) {
+        const double value = distribution(generator);
+        const int maxDenominator = 1 + static_cast<int>(generator() % 60);
+        const BigRational exact(value, Arkulib::Exact);
+
+        // Closest p / q for every q, the smallest q on a tie
+        BigRational best;
+        BigRational bestDistance(-1);
+        for (int q = 1; q <= maxDenominator; ++q) {
+            const long long p = std::llround(value * q);
+            for (long long candidate = p - 1; candidate <= p + 1; ++candidate) {
+                const BigRational distance = (exact - BigRational(candidate, q)).abs();
+                if (bestDistance.isNegative() || distance < bestDistance) {
+                    best = BigRational(candidate, q);
+                    bestDistance = distance;
+                }
+            }
+        }
+
+        const auto result = Arkulib::Rational<int>::bestApproximation(value, maxDenominator);
+        ASSERT_EQ (BigRational(result.getNumerator(), result.getDenominator()), best) << value << " " << maxDenominator;
+        ASSERT_EQ (BigRational::bestApproximation(value, maxDenominator), best);
+    }
+}
+
+TEST (ArkulibBestApproximation, LimitDenominator) {
+    Arkulib::Rational<int> r1(314159, 100000);
+    ASSERT_EQ (r1.limitDenominator(10), Arkulib::Rational<int>(22, 7));
+    ASSERT_EQ (r1.limitDenominator(1000), Arkulib::Rational<int>(355, 113));
+    ASSERT_EQ (r1.limitDenominator(100000), r1);
+    ASSERT_EQ ((-r1).limitDenominator(10), Arkulib::Rational<int>(-22, 7));
+
+    Arkulib::Rational<Arkulib::BigInt> r2(Arkulib::BigInt("314159265358979323846"), Arkulib::BigInt("100000000000000000000"));
+    ASSERT_EQ (r2.limitDenominator(Arkulib::BigInt(30000)), Arkulib::Rational<Arkulib::BigInt>(94053, 29938));
+
+    Arkulib::Rational<int, Arkulib::Policies::Lazy> r3(20, 40, false);
+    ASSERT_EQ (r3.limitDenominator(100).getDenominator(), 2);
+}
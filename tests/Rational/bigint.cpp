@@ -0,0 +1,67 @@
+#include <climits>
+#include <gtest/gtest.h>
+#include "../../include/BigInt.hpp"
+#include "../../include/Rational.hpp"
+
+using BigRational = Arkulib::Rational<Arkulib::BigInt>;
+
+#if defined(__cpp_concepts)
+static_assert(Arkulib::Tools::RationalInteger<Arkulib::BigInt>);
+static_assert(Arkulib::Tools::RationalInteger<long long int>);
+static_assert(!Arkulib::Tools::RationalInteger<double>);
+#endif
+
+TEST (ArkulibBigRational, HarmonicSum) {
+    BigRational sum;
+    for (int k = 1; k <= 100; ++k) sum += BigRational(1, k);
+
+    ASSERT_EQ (sum.getNumerator().toString(), "14466636279520351160221518043104131447711");
+    ASSERT_EQ (sum.getDenominator().toString(), "2788815009188499086581352357412492142272");
+}
+
+TEST (ArkulibBigRational, BeyondLongLong) {
+    const BigRational r1(LLONG_MAX, 3);
+    const BigRational r2(LLONG_MIN, 7);
+
+    // These products throw with Rational<long long int>
+    ASSERT_EQ ((r1 * r2).toString(), "(-12152941675747802265231468545869611008 / 3)");
+    ASSERT_EQ ((r1 * r2) / r2, r1);
+    ASSERT_EQ (r1 - r1, BigRational::Zero());
+}
+
+TEST (ArkulibBigRational, Comparison) {
+    const BigRational r1(Arkulib::BigInt("100000000000000000000000000001"), Arkulib::BigInt("100000000000000000000000000000"));
+    const BigRational r2(Arkulib::BigInt("100000000000000000000000000002"), Arkulib::BigInt("100000000000000000000000000001"));
+
+    // (n + 1) / n > (n + 2) / (n + 1): the difference is 1e-58
+    ASSERT_GT (r1, r2);
+    ASSERT_GT (r2, BigRational::One());
+    ASSERT_TRUE(BigRational(-4, 6) == BigRational(2, -3));
+}
+
+TEST (ArkulibBigRational, Conversion) {
+    ASSERT_FLOAT_EQ (BigRational(1, 4).toRealNumber(), 0.25f);
+    ASSERT_EQ (BigRational(Arkulib::BigInt(7)).toString(), "(7 / 1)");
+    Arkulib::Rational<int> small(3, 9);
+    ASSERT_EQ (BigRational(small), BigRational(1, 3));
+    EXPECT_THROW(BigRational(1, 0), Arkulib::Exceptions::DivideByZeroException);
+}
+
+TEST (ArkulibBigRational, LazyPolicy) {
+    using LazyBigRational = Arkulib::Rational<Arkulib::BigInt, Arkulib::Policies::Lazy>;
+    const LazyBigRational r1(2, 4);
+
+    ASSERT_EQ (r1.getNumerator(), 2);
+    ASSERT_TRUE(r1 + r1 == LazyBigRational(1, 1));
+}
+
+TEST (ArkulibBigRational, ExactFromNonRational) {
+    // The smallest subnormal double is 2^-1074
+    BigRational r1(4.9e-324, Arkulib::Exact);
+    ASSERT_EQ (r1.getNumerator(), Arkulib::BigInt(1));
+    ASSERT_EQ (r1.getDenominator().bitLength(), 1075U);
+
+    BigRational r2(-1e300, Arkulib::Exact);
+    ASSERT_EQ (r2.getDenominator(), Arkulib::BigInt(1));
+    ASSERT_EQ (r2.toRealNumber<double>(), -1e300);
+}
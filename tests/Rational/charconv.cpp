@@ -0,0 +1,101 @@
+#include <climits>
+#include <gtest/gtest.h>
+#include "../../include/BigInt.hpp"
+#include "../../include/Rational.hpp"
+
+namespace {
+    template<typename RationalType>
+    std::string toChars(const RationalType &value) {
+        char buffer[128];
+        const std::to_chars_result result = value.toChars(buffer, buffer + sizeof(buffer));
+        EXPECT_TRUE (result.ec == std::errc());
+        return std::string(buffer, result.ptr);
+    }
+
+    template<typename RationalType>
+    RationalType fromChars(const std::string &text, const std::size_t expectedLength) {
+        RationalType value;
+        const std::from_chars_result result = RationalType::fromChars(text.data(), text.data() + text.size(), value);
+        EXPECT_TRUE (result.ec == std::errc()) << text;
+        EXPECT_EQ (static_cast<std::size_t>(result.ptr - text.data()), expectedLength) << text;
+        return value;
+    }
+}
+
+TEST (ArkulibCharconv, ToChars) {
+    using R = Arkulib::Rational<int>;
+    EXPECT_EQ (toChars(R(6, -4)), "-3/2");
+    EXPECT_EQ (toChars(R(7)), "7/1");
+    EXPECT_EQ (toChars(R(INT_MIN, 1)), "-2147483648/1");
+    EXPECT_EQ (toChars(Arkulib::Rational<int, Arkulib::Policies::Lazy>(2, 4)), "1/2");
+    EXPECT_EQ (toChars(Arkulib::Rational<Arkulib::Tools::Int128>(Arkulib::Tools::Int128(1) << 100, 3)), "1267650600228229401496703205376/3");
+    EXPECT_EQ (toChars(Arkulib::Rational<Arkulib::BigInt>(Arkulib::BigInt("-123456789012345678901234567891"), 2)), "-123456789012345678901234567891/2");
+
+    char buffer[4];
+    EXPECT_TRUE (R(-3, 2).toChars(buffer, buffer + 4).ec == std::errc());
+    EXPECT_TRUE (R(-13, 2).toChars(buffer, buffer + 4).ec == std::errc::value_too_large);
+    EXPECT_TRUE (R(-3, 20).toChars(buffer, buffer + 4).ec == std::errc::value_too_large);
+}
+
+TEST (ArkulibCharconv, ToString) {
+    EXPECT_EQ (Arkulib::Rational<int>(6, -4).toString(), "(-3 / 2)");
+    EXPECT_EQ (Arkulib::Rational<long long>(LLONG_MIN, 1).toString(), "(-9223372036854775808 / 1)");
+    EXPECT_EQ (Arkulib::Rational<Arkulib::BigInt>(2, 6).toString(), "(1 / 3)");
+}
+
+TEST (ArkulibCharconv, FromChars) {
+    using R = Arkulib::Rational<int>;
+    EXPECT_EQ (fromChars<R>("3/4", 3), R(3, 4));
+    EXPECT_EQ (fromChars<R>("-6/8 rest", 4), R(-3, 4));
+    EXPECT_EQ (fromChars<R>("(-3 / 4)", 8), R(-3, 4));
+    EXPECT_EQ (fromChars<R>("(3/-4)", 6), R(-3, 4));
+    EXPECT_EQ (fromChars<R>("3 / 4", 5), R(3, 4));
+    EXPECT_EQ (fromChars<R>("42", 2), R(42));
+    EXPECT_EQ (fromChars<R>("42 43", 2), R(42));
+    EXPECT_EQ (fromChars<R>("3.125", 5), R(25, 8));
+    EXPECT_EQ (fromChars<R>("-0.5", 4), R(-1, 2));
+    EXPECT_EQ (fromChars<R>(".25", 3), R(1, 4));
+    EXPECT_EQ (fromChars<R>("1.5/3", 5), R(1, 2));
+    EXPECT_EQ (fromChars<R>("-2147483648", 11), R(INT_MIN, 1));
+    EXPECT_EQ (fromChars<R>("-2147483648/-2", 14), R(1073741824));
+    EXPECT_EQ (fromChars<R>("-2147483648/-2147483648", 23), R(1));
+    EXPECT_EQ (fromChars<R>("2/-2147483648", 13), R(-1, 1073741824));
+    EXPECT_EQ (fromChars<R>("1/-2147483647", 13).getDenominator(), INT_MAX);
+    EXPECT_EQ (fromChars<Arkulib::Rational<Arkulib::BigInt>>("123456789012345678901234567890/10", 33),
+               Arkulib::Rational<Arkulib::BigInt>(Arkulib::BigInt("12345678901234567890123456789"), 1));
+
+    for (const R value: {R(-3, 2), R(0), R(INT_MAX, 7), R(INT_MIN + 1, INT_MAX)}) {
+        const std::string text = toChars(value);
+        EXPECT_EQ (fromChars<R>(text, text.size()), value);
+        EXPECT_EQ (fromChars<R>(value.toString(), value.toString().size()), value);
+    }
+}
+
+TEST (ArkulibCharconv, FromCharsErrors) {
+    using R = Arkulib::Rational<int>;
+    const auto parse = [](const std::string &text, R &value) {
+        return R::fromChars(text.data(), text.data() + text.size(), value);
+    };
+
+    R value(5, 7);
+    for (const std::string text: {"", "-", "abc", "(3 / 4", "3/", "3/x", "1/0", "(/2)", "3/1.5"}) {
+        const std::from_chars_result result = parse(text, value);
+        EXPECT_TRUE (result.ec == std::errc::invalid_argument || (text == "3/1.5" && result.ec == std::errc())) << text;
+    }
+    EXPECT_EQ (value, R(3));
+
+    value = R(5, 7);
+    std::string text = "2147483648/3 ";
+    std::from_chars_result result = parse(text, value);
+    EXPECT_TRUE (result.ec == std::errc::result_out_of_range);
+    EXPECT_EQ (result.ptr, text.data() + 12);
+    EXPECT_TRUE (parse("0.0000000001", value).ec == std::errc::result_out_of_range);
+
+    // The opposites of -2147483648 don't fit in int
+    text = "-2147483648/-1";
+    result = parse(text, value);
+    EXPECT_TRUE (result.ec == std::errc::result_out_of_range);
+    EXPECT_EQ (result.ptr, text.data() + text.size());
+    EXPECT_TRUE (parse("1/-2147483648", value).ec == std::errc::result_out_of_range);
+    EXPECT_EQ (value, R(5, 7));
+}
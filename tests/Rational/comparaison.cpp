@@ -1,3 +1,5 @@
+#include <algorithm>
+#include <vector>
 #include <climits>
 #include <gtest/gtest.h>
 #include "../../include/Rational.hpp"
@@ -78,4 +80,54 @@ TEST (ArkulibComparaison, SuperiorOrEqual) {
 
     ASSERT_TRUE(r1 >= r2);
     ASSERT_TRUE(r1 == r2);
-}
\ No newline at end of file
+}
+
+TEST (ArkulibComparaison, ExactForCloseValues) {
+    // Both are equal to 1.0f once converted to float
+    Arkulib::Rational r1(16777217, 16777216);
+    Arkulib::Rational r2(16777218, 16777217);
+
+    ASSERT_TRUE(r2 < r1);
+    ASSERT_TRUE(r1 > r2);
+    ASSERT_FALSE(r1 <= r2);
+    ASSERT_TRUE(r2 <= r1);
+}
+
+TEST (ArkulibComparaison, ExactForLongLong) {
+    Arkulib::Rational<long long int> r1(LLONG_MAX, LLONG_MAX - 1);
+    Arkulib::Rational<long long int> r2(LLONG_MAX - 1, LLONG_MAX - 2);
+
+    ASSERT_TRUE(r1 < r2);
+    ASSERT_TRUE(Arkulib::Rational<long long int>::min(r1, r2) == r1);
+}
+
+TEST (ArkulibComparaison, ContinuedFractions) {
+    using Arkulib::Tools::compareContinuedFractions;
+
+    ASSERT_EQ(-1, compareContinuedFractions(1, 3, 1, 2));
+    ASSERT_EQ(0, compareContinuedFractions(2, 4, 1, 2));
+    ASSERT_EQ(1, compareContinuedFractions(-1, 3, -1, 2));
+    ASSERT_EQ(-1, compareContinuedFractions(LLONG_MAX - 1, LLONG_MAX, LLONG_MAX, LLONG_MAX - 1));
+    ASSERT_EQ(-1, compareContinuedFractions(355, 113, 22, 7));
+}
+
+#if defined(__cpp_impl_three_way_comparison) && defined(__cpp_lib_three_way_comparison)
+TEST (ArkulibComparaison, ThreeWay) {
+    Arkulib::Rational r1(1, 3);
+    Arkulib::Rational r2(2, 6);
+    Arkulib::Rational r3(1, 2);
+
+    ASSERT_TRUE((r1 <=> r2) == 0);
+    ASSERT_TRUE((r1 <=> r3) < 0);
+    ASSERT_TRUE((r3 <=> 0) > 0);
+}
+#endif
+
+TEST (ArkulibComparaison, SortIsStrictWeakOrdering) {
+    std::vector<Arkulib::Rational<int>> rationals;
+    for (int i = 1; i < 200; ++i) rationals.emplace_back(16777216 + i, 16777216 + i - 1);
+
+    std::sort(rationals.begin(), rationals.end());
+    ASSERT_TRUE(std::is_sorted(rationals.begin(), rationals.end()));
+    ASSERT_EQ(rationals.front(), Arkulib::Rational(16777216 + 199, 16777216 + 198));
+}
@@ -0,0 +1,47 @@
+#include <gtest/gtest.h>
+#include "../../include/Rational.hpp"
+
+namespace {
+    using R = Arkulib::Rational<long long>;
+
+    constexpr R half(1, 2);
+    constexpr R third(2, 6);
+    constexpr R pi = R::Pi();
+    constexpr R formula = (half + third) * pi - half / third;
+    constexpr R fromDouble(0.75);
+    constexpr R milli(std::milli{});
+}
+
+TEST (ArkulibConstexpr, Arithmetic) {
+    static_assert(third.getNumerator() == 1 && third.getDenominator() == 3);
+    static_assert(half + third == R(5, 6));
+    static_assert(half - third == R(1, 6));
+    static_assert(half * third == R(1, 6));
+    static_assert(half / third == R(3, 2));
+    static_assert(formula == R(5, 6) * R(355, 113) - R(3, 2));
+    static_assert((-half).abs() == half);
+    static_assert(third < half && !(half < third));
+    static_assert(R::Zero().isZero() && R::One() == R(1));
+
+    EXPECT_EQ (formula, (R(1, 2) + R(1, 3)) * R::Pi() - R(1, 2) / R(1, 3));
+}
+
+TEST (ArkulibConstexpr, FromFloatingPoint) {
+    static_assert(fromDouble == R(3, 4));
+    static_assert(R(-0.125) == R(-1, 8));
+    static_assert(R(0.5, Arkulib::ExactTag{}) == half);
+
+    EXPECT_EQ (fromDouble, R(0.75));
+}
+
+TEST (ArkulibConstexpr, StdRatio) {
+    static_assert(milli == R(1, 1000));
+    static_assert(R(std::ratio<6, -4>{}) == R(-3, 2));
+    static_assert(Arkulib::Rational<int>(std::ratio_add<std::ratio<1, 3>, std::ratio<1, 6>>{}) == Arkulib::Rational<int>(1, 2));
+
+    static_assert(std::is_same_v<Arkulib::RatioOf<half>, std::ratio<1, 2>>);
+    static_assert(std::is_same_v<Arkulib::RatioOf<formula>, std::ratio<formula.getNumerator(), formula.getDenominator()>>);
+    static_assert(std::ratio_equal_v<std::ratio_multiply<Arkulib::RatioOf<third>, std::kilo>, std::ratio<1000, 3>>);
+
+    EXPECT_EQ (milli.getDenominator(), 1000);
+}
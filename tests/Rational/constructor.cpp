@@ -1,3 +1,4 @@
+#include <climits>
 #include <gtest/gtest.h>
 #include "../../include/Rational.hpp"
 
@@ -61,15 +62,10 @@ TEST (ArkulibConstructor, ConstructorsCoherency) {
 }
 
 TEST (ArkulibConstructor, UnwantedTypes) {
-    EXPECT_THROW({
-         try {
-             Arkulib::Rational<float> r1;
-         }
-         catch (const Arkulib::Exceptions::FloatTypeGivenException &e) {
-             EXPECT_STREQ("The type given to a rational must not be a floating point.", e.what());
-             throw;
-         }
-     }, Arkulib::Exceptions::FloatTypeGivenException);
+    // Rational<float> is rejected at compile time by a static_assert on this trait
+    EXPECT_FALSE (Arkulib::Tools::IntegerTraits<float>::isInteger);
+    EXPECT_FALSE (Arkulib::Tools::IntegerTraits<double>::isInteger);
+    EXPECT_TRUE (Arkulib::Tools::IntegerTraits<long long>::isInteger);
 }
 
 TEST (ArkulibConstructor, NumberTooLargeFromNonRational) {
@@ -97,4 +93,56 @@ TEST (ArkulibConstructor, NumberTooLargeFromCopy) {
              throw;
          }
     }, Arkulib::Exceptions::NumberTooLargeException);
-}
\ No newline at end of file
+}
+
+TEST (ArkulibConstructor, ExactFromNonRational) {
+    Arkulib::Rational<long long int> r1(0.1, Arkulib::Exact);
+    ASSERT_EQ (r1.getNumerator(), 3602879701896397LL);
+    ASSERT_EQ (r1.getDenominator(), 36028797018963968LL);
+    ASSERT_EQ (r1.toRealNumber<double>(), 0.1);
+
+    ASSERT_EQ (Arkulib::Rational<int>(-0.75, Arkulib::Exact), Arkulib::Rational<int>(-3, 4));
+    ASSERT_EQ (Arkulib::Rational<int>(1e9, Arkulib::Exact), Arkulib::Rational<int>(1000000000));
+    ASSERT_EQ (Arkulib::Rational<int>(0.f, Arkulib::Exact), Arkulib::Rational<int>::Zero());
+    ASSERT_EQ (Arkulib::Rational<int>(-0., Arkulib::Exact), Arkulib::Rational<int>::Zero());
+    ASSERT_EQ (Arkulib::Rational<int>(0.1f, Arkulib::Exact), Arkulib::Rational<int>(13421773, 134217728));
+    ASSERT_EQ (Arkulib::Rational<long long int>(-0.625L, Arkulib::Exact), Arkulib::Rational<long long int>(-5, 8));
+
+    // Constant time and constexpr: no continued fraction
+    static_assert(Arkulib::Rational<int>(2.5, Arkulib::Exact) == Arkulib::Rational<int>(5, 2));
+    static_assert(Arkulib::Rational<int>::fromFloatingPointExact(-0x1p-30) == Arkulib::Rational<int>(-1, 1 << 30));
+}
+
+TEST (ArkulibConstructor, ExactFromNonRationalTooLarge) {
+    // 2^31 doesn't fit in int
+    EXPECT_THROW(Arkulib::Rational<int>(0x1p31, Arkulib::Exact), Arkulib::Exceptions::NumberTooLargeException);
+    EXPECT_THROW(Arkulib::Rational<int>(0x1p-31, Arkulib::Exact), Arkulib::Exceptions::NumberTooLargeException);
+    EXPECT_THROW(Arkulib::Rational<int>(0.1, Arkulib::Exact), Arkulib::Exceptions::NumberTooLargeException);
+    EXPECT_THROW(Arkulib::Rational<long long int>(std::numeric_limits<double>::infinity(), Arkulib::Exact), Arkulib::Exceptions::NumberTooLargeException);
+    EXPECT_THROW(Arkulib::Rational<long long int>(std::nan(""), Arkulib::Exact), Arkulib::Exceptions::NumberTooLargeException);
+
+    ASSERT_EQ (Arkulib::Rational<int>(0x1p30, Arkulib::Exact), Arkulib::Rational<int>(1 << 30));
+    ASSERT_EQ (Arkulib::Rational<int>(-0x1p-30, Arkulib::Exact), Arkulib::Rational<int>(-1, 1 << 30));
+}
+
+TEST (ArkulibConstructor, MinimumDenominator) {
+    // -INT_MIN doesn't fit in int: the fraction is reduced before the signs are swapped
+    const Arkulib::Rational<int> r1(2, INT_MIN);
+    ASSERT_EQ (r1.getNumerator(), -1);
+    ASSERT_EQ (r1.getDenominator(), 1 << 30);
+    ASSERT_EQ (Arkulib::Rational<int>(INT_MIN, INT_MIN), Arkulib::Rational<int>(1));
+
+    EXPECT_THROW(Arkulib::Rational<int>(1, INT_MIN), Arkulib::Exceptions::NumberTooLargeException);
+    EXPECT_THROW(Arkulib::Rational<int>(INT_MIN, -1), Arkulib::Exceptions::NumberTooLargeException);
+    EXPECT_THROW((Arkulib::Rational<int, Arkulib::Policies::Lazy>(3, INT_MIN)), Arkulib::Exceptions::NumberTooLargeException);
+
+    Arkulib::Rational<int> r2(1, 2);
+    r2.setDenominator(-4);
+    ASSERT_EQ (r2, Arkulib::Rational<int>(-1, 4));
+
+    // The closest rational that fits with the Approximate policy
+    using ApproximateRational = Arkulib::Rational<int, Arkulib::Policies::Canonical, Arkulib::Policies::Approximate<>>;
+    const ApproximateRational r3(1, INT_MIN);
+    ASSERT_GT (r3.getDenominator(), 0);
+    ASSERT_NEAR (r3.toRealNumber<double>(), -1. / 2147483648., 1e-9);
+}
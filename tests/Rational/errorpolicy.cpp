@@ -0,0 +1,91 @@
+#include <climits>
+#include <gtest/gtest.h>
+#include "../../include/ERational.hpp"
+
+using FlagRational = Arkulib::Rational<long long int, Arkulib::Policies::Canonical, Arkulib::Policies::StatusFlag>;
+using AssertRational = Arkulib::Rational<int, Arkulib::Policies::Canonical, Arkulib::Policies::AssertOnly>;
+
+TEST (ArkulibErrorPolicy, DefaultStillThrows) {
+    ASSERT_TRUE((std::is_same_v<Arkulib::Policies::DefaultErrorPolicy, Arkulib::Policies::Throw>));
+    EXPECT_THROW(Arkulib::Rational<int>(1, 0), Arkulib::Exceptions::DivideByZeroException);
+    EXPECT_THROW(static_cast<void>(Arkulib::Rational<int>(-4, 1).sqrt()), Arkulib::Exceptions::NegativeSqrtException);
+}
+
+TEST (ArkulibErrorPolicy, NoexceptOperators) {
+    ASSERT_TRUE(noexcept(FlagRational() + FlagRational()));
+    ASSERT_TRUE(noexcept(FlagRational() / FlagRational()));
+    ASSERT_TRUE(noexcept(AssertRational() * AssertRational()));
+    ASSERT_FALSE(noexcept(Arkulib::Rational<int>() + Arkulib::Rational<int>()));
+}
+
+TEST (ArkulibErrorPolicy, StatusFlagIsSticky) {
+    Arkulib::Policies::StatusFlag::clear();
+
+    FlagRational r1(LLONG_MAX, 2);
+    FlagRational r2(3000, 2999);
+    ASSERT_EQ (r1 + r2, FlagRational::Zero());
+    ASSERT_EQ (Arkulib::Policies::StatusFlag::status(), Arkulib::ArkulibError::NumberTooLarge);
+
+    // The first error is kept
+    ASSERT_EQ (r1 / FlagRational::Zero(), FlagRational::Zero());
+    ASSERT_EQ (Arkulib::Policies::StatusFlag::status(), Arkulib::ArkulibError::NumberTooLarge);
+
+    Arkulib::Policies::StatusFlag::clear();
+    ASSERT_FALSE(Arkulib::Policies::StatusFlag::hasError());
+}
+
+TEST (ArkulibErrorPolicy, StatusFlagConstructor) {
+    Arkulib::Policies::StatusFlag::clear();
+
+    FlagRational r1(5, 0);
+    ASSERT_EQ (r1.getNumerator(), 0);
+    ASSERT_EQ (r1.getDenominator(), 1);
+    ASSERT_EQ (Arkulib::Policies::StatusFlag::status(), Arkulib::ArkulibError::DivideByZero);
+
+    Arkulib::Policies::StatusFlag::clear();
+    ASSERT_EQ (FlagRational(-1, 1).sqrt(), FlagRational::Zero());
+    ASSERT_EQ (Arkulib::Policies::StatusFlag::status(), Arkulib::ArkulibError::NegativeSqrt);
+    Arkulib::Policies::StatusFlag::clear();
+}
+
+TEST (ArkulibErrorPolicy, TryCompute) {
+    FlagRational r1(LLONG_MAX, 3);
+    FlagRational r2(1, 3);
+
+    auto success = Arkulib::tryCompute([&] { return r2 * r2 + r2; });
+    ASSERT_TRUE(success);
+    ASSERT_EQ (success.value(), FlagRational(4, 9));
+
+    auto failure = Arkulib::tryCompute([&] { return r1 * r1 + r2; });
+    ASSERT_FALSE(failure.hasValue());
+    ASSERT_EQ (failure.error(), Arkulib::ArkulibError::NumberTooLarge);
+    ASSERT_EQ (failure.valueOr(FlagRational::One()), FlagRational::One());
+
+    // tryCompute leaves the thread status untouched
+    ASSERT_FALSE(Arkulib::Policies::StatusFlag::hasError());
+}
+
+TEST (ArkulibErrorPolicy, AssertOnlyValidOperations) {
+    AssertRational r1(1, 2);
+    AssertRational r2(1, 3);
+
+    ASSERT_EQ (r1 + r2, AssertRational(5, 6));
+    ASSERT_EQ (r1 - r2, AssertRational(1, 6));
+    ASSERT_EQ (r1 * r2, AssertRational(1, 6));
+    ASSERT_EQ (r1 / r2, AssertRational(3, 2));
+}
+
+TEST (ArkulibErrorPolicy, ERationalStatusFlag) {
+    Arkulib::Policies::StatusFlag::clear();
+
+    Arkulib::ERational<double, Arkulib::Policies::StatusFlag> r1(3, 0);
+    ASSERT_EQ (r1.getNumMultiplier(), 0.);
+    ASSERT_EQ (Arkulib::Policies::StatusFlag::status(), Arkulib::ArkulibError::DivideByZero);
+
+    Arkulib::Policies::StatusFlag::clear();
+}
+
+TEST (ArkulibErrorPolicy, Messages) {
+    ASSERT_STREQ (Arkulib::toMessage(Arkulib::ArkulibError::DivideByZero), Arkulib::Exceptions::DivideByZeroException().what());
+    ASSERT_STREQ (Arkulib::toMessage(Arkulib::ArkulibError::NumberTooLarge), Arkulib::Exceptions::NumberTooLargeException().what());
+}
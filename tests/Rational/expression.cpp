@@ -0,0 +1,73 @@
+#include <climits>
+#include <random>
+#include <gtest/gtest.h>
+#include "../../include/RationalExpression.hpp"
+
+using Arkulib::Expressions::lazy;
+
+TEST (ArkulibRationalExpression, SameValueAsTheOperators) {
+    using R = Arkulib::Rational<long long>;
+    std::mt19937 generator(3);
+    std::uniform_int_distribution<long long> numerators(-1000, 1000), denominators(1, 1000);
+    for (int i = 0; i < 200; ++i) {
+        const R a(numerators(generator), denominators(generator)), b(numerators(generator), denominators(generator));
+        const R c(numerators(generator), denominators(generator)), d(numerators(generator), denominators(generator));
+        const R e(numerators(generator), denominators(generator)), f(numerators(generator) | 1, denominators(generator));
+
+        const auto [A, B, C, D, E, F] = lazy(a, b, c, d, e, f);
+        const R fused = A * B + C * D - E / F;
+        ASSERT_EQ (fused, a * b + c * d - e / f);
+        ASSERT_EQ (R(-(A - B) * c), -(a - b) * c);
+        ASSERT_EQ ((lazy(a) + b).evaluate(), a + b);
+        ASSERT_EQ (R(a / (B + c)), a / (b + c));
+    }
+}
+
+TEST (ArkulibRationalExpression, OnlyTheResultMustFit) {
+    using R = Arkulib::Rational<int>;
+    const R a(INT_MAX, 3), b(6, INT_MAX - 1);
+    ASSERT_THROW(static_cast<void>(a * a), Arkulib::Exceptions::NumberTooLargeException);
+
+    // a * a - a * a + b: the products overflow int, not long long
+    const R fused = lazy(a) * a - lazy(a) * a + b;
+    ASSERT_EQ (fused, b);
+
+    // Over __int128 too: the evaluation goes on with BigInt
+    using L = Arkulib::Rational<long long>;
+    const L big(LLONG_MAX, 7);
+    const auto [X, Y] = lazy(big, L(1, 3));
+    ASSERT_EQ (L(X * X * X * X - X * X * X * X + Y), L(1, 3));
+
+    ASSERT_THROW(static_cast<void>(L(X * X)), Arkulib::Exceptions::NumberTooLargeException);
+}
+
+TEST (ArkulibRationalExpression, Approximate) {
+    // A result that doesn't fit is approximated like the overflow of an operator
+    using Policy = Arkulib::Policies::Approximate<Arkulib::Policies::Throw>;
+    using R = Arkulib::Rational<int, Arkulib::Policies::Canonical, Policy>;
+    const R a(46341, 46343), b(1, 7);
+    Policy::resetStats();
+    ASSERT_EQ (R(lazy(a) * a), a * a);
+    ASSERT_EQ (Policy::stats().count, 2u);
+
+    const R fused = lazy(a) * a + lazy(b) * b;
+    ASSERT_NEAR (fused.toRealNumber<double>(), (46341. / 46343) * (46341. / 46343) + 1. / 49, 1e-9);
+    ASSERT_EQ (Policy::stats().count, 3u);
+
+    // From the BigInt evaluation
+    using L = Arkulib::Rational<long long, Arkulib::Policies::Canonical, Policy>;
+    const L big(LLONG_MAX, 7);
+    const L cube = lazy(big) * big * big;
+    ASSERT_EQ (cube, L(LLONG_MAX));
+    ASSERT_EQ (Policy::stats().count, 4u);
+    Policy::resetStats();
+}
+
+TEST (ArkulibRationalExpression, Errors) {
+    using R = Arkulib::Rational<int>;
+    const R a(1, 2), b(1, 3);
+    ASSERT_THROW(static_cast<void>(R(lazy(a) / (lazy(b) - b))), Arkulib::Exceptions::DivideByZeroException);
+
+    // The denominator becomes negative with a division by a negative number
+    ASSERT_EQ (R(lazy(a) / R(-1, 4)), R(-2));
+}
@@ -0,0 +1,68 @@
+#include <gtest/gtest.h>
+#include "../../include/Rational.hpp"
+
+using LazyRational = Arkulib::Rational<int, Arkulib::Policies::Lazy>;
+
+TEST (ArkulibNormalization, CanonicalIsAlwaysReduced) {
+    Arkulib::Rational r1(10, 5, false);
+    ASSERT_EQ (2, r1.getNumerator());
+    ASSERT_EQ (1, r1.getDenominator());
+
+    Arkulib::Rational r2{};
+    r2.setNumerator(2);
+    r2.setDenominator(8);
+    ASSERT_EQ (1, r2.getNumerator());
+    ASSERT_EQ (4, r2.getDenominator());
+}
+
+TEST (ArkulibNormalization, LazyConstruction) {
+    LazyRational r1(10, 4);
+    ASSERT_EQ (10, r1.getNumerator());
+    ASSERT_EQ (4, r1.getDenominator());
+
+    LazyRational r2(10, -4, true);
+    ASSERT_EQ (-5, r2.getNumerator());
+    ASSERT_EQ (2, r2.getDenominator());
+}
+
+TEST (ArkulibNormalization, LazyNormalize) {
+    LazyRational r1(12, 18);
+    r1.normalize();
+    ASSERT_EQ (2, r1.getNumerator());
+    ASSERT_EQ (3, r1.getDenominator());
+}
+
+TEST (ArkulibNormalization, LazyComparison) {
+    LazyRational r1(1, 2);
+    LazyRational r2(2, 4);
+    LazyRational r3(3, 4);
+
+    ASSERT_TRUE (r1 == r2);
+    ASSERT_TRUE (r1 != r3);
+    ASSERT_TRUE (r2.isInteger() == false);
+    ASSERT_TRUE (LazyRational(8, 4).isInteger());
+}
+
+TEST (ArkulibNormalization, LazyAccumulation) {
+    LazyRational sum{};
+    for (int i = 0; i < 20; ++i) sum += LazyRational(1, 8);
+
+    ASSERT_EQ (sum, LazyRational(5, 2));
+    ASSERT_EQ ("(5 / 2)", sum.toString());
+}
+
+TEST (ArkulibNormalization, LazyOverflowThreatReduces) {
+    // The denominators grow without reduction until they would overflow: the operation is then reduced
+    LazyRational product(1, 1);
+    for (int i = 0; i < 40; ++i) product *= LazyRational(6, 6);
+
+    ASSERT_EQ (product, LazyRational::One());
+}
+
+TEST (ArkulibNormalization, ConversionBetweenPolicies) {
+    LazyRational lazy(6, 8);
+    Arkulib::Rational<int> canonical(lazy);
+
+    ASSERT_EQ (3, canonical.getNumerator());
+    ASSERT_EQ (4, canonical.getDenominator());
+}
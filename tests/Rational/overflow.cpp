@@ -0,0 +1,85 @@
+#include <climits>
+#include <gtest/gtest.h>
+#include "../../include/Rational.hpp"
+
+TEST (ArkulibOverflow, WiderIntegerTypes) {
+    ASSERT_TRUE((std::is_same_v<Arkulib::Tools::WiderIntegerType<int>, std::int64_t>));
+    ASSERT_TRUE((std::is_same_v<Arkulib::Tools::WiderIntegerType<long long int>, Arkulib::Tools::Int128>));
+    ASSERT_FALSE(Arkulib::Tools::WiderInteger<Arkulib::Tools::Int128>::isWider);
+}
+
+TEST (ArkulibOverflow, IntermediateOverflowThenReduced) {
+    // 2^40 * 2^40 doesn't fit in a long long, but the result 1 / 2^39 does
+    Arkulib::Rational<long long int> r1(1, 1LL << 40);
+
+    ASSERT_EQ (r1 + r1, Arkulib::Rational<long long int>(1, 1LL << 39));
+    ASSERT_EQ (r1 - r1, Arkulib::Rational<long long int>::Zero());
+    ASSERT_EQ (r1 / r1, Arkulib::Rational<long long int>::One());
+}
+
+TEST (ArkulibOverflow, LongLongAddition) {
+    Arkulib::Rational<long long int> r1(LLONG_MAX, 2);
+    Arkulib::Rational<long long int> r2(3000, 2999);
+
+    EXPECT_THROW(r1 + r2, Arkulib::Exceptions::NumberTooLargeException);
+    EXPECT_THROW(r1 - (-r2), Arkulib::Exceptions::NumberTooLargeException);
+}
+
+TEST (ArkulibOverflow, LongLongMultiplication) {
+    Arkulib::Rational<long long int> r1(LLONG_MAX, 3);
+    Arkulib::Rational<long long int> r2(LLONG_MIN, 7);
+
+    EXPECT_THROW(r1 * r2, Arkulib::Exceptions::NumberTooLargeException);
+    EXPECT_THROW(r1 / r2.inverse(), Arkulib::Exceptions::NumberTooLargeException);
+}
+
+TEST (ArkulibOverflow, LongLongNoOverflow) {
+    Arkulib::Rational<long long int> r1(LLONG_MAX, 2);
+    Arkulib::Rational<long long int> r2(2, LLONG_MAX);
+
+    ASSERT_EQ (r1 * r2, Arkulib::Rational<long long int>::One());
+}
+
+TEST (ArkulibOverflow, ApproximateInsteadOfThrowing) {
+    using ApproximateRational = Arkulib::Rational<long long int, Arkulib::Policies::Canonical, Arkulib::Policies::Approximate<>>;
+    Arkulib::Policies::Approximate<>::resetStats();
+
+    ApproximateRational r1(LLONG_MAX, 2);
+    ApproximateRational r2(3000, 2999);
+    ApproximateRational result = r1 + r2;
+
+    ASSERT_NEAR (result.toRealNumber<long double>(), static_cast<long double>(LLONG_MAX) / 2 + 3000.L / 2999, 1.);
+    ASSERT_EQ (Arkulib::Policies::Approximate<>::stats().count, 1u);
+    ASSERT_LT (Arkulib::Policies::Approximate<>::stats().maxError, 1.);
+}
+
+TEST (ArkulibOverflow, ApproximateClosestInt) {
+    using ApproximateRational = Arkulib::Rational<int, Arkulib::Policies::Canonical, Arkulib::Policies::Approximate<>>;
+    Arkulib::Policies::Approximate<>::resetStats();
+
+    // 2 * INT_MAX / 3 = 1431655764.67 and INT_MAX is prime: the closest rational in int is 1431655765
+    ASSERT_EQ (ApproximateRational(INT_MAX, 3) * ApproximateRational(2, 1), ApproximateRational(1431655765, 1));
+    ASSERT_NEAR (Arkulib::Policies::Approximate<>::stats().maxError, 1. / 3, 1e-9);
+}
+
+TEST (ArkulibOverflow, ApproximateSaturates) {
+    using ApproximateRational = Arkulib::Rational<long long int, Arkulib::Policies::Canonical, Arkulib::Policies::Approximate<>>;
+    Arkulib::Policies::Approximate<>::resetStats();
+
+    ApproximateRational r1(LLONG_MAX, 1);
+    ASSERT_EQ (r1 + r1, ApproximateRational(LLONG_MAX, 1));
+    ASSERT_EQ ((-r1) - r1, ApproximateRational(-LLONG_MAX, 1));
+    ASSERT_EQ (Arkulib::Policies::Approximate<>::stats().count, 2u);
+    ASSERT_NEAR (Arkulib::Policies::Approximate<>::stats().meanError(), static_cast<double>(LLONG_MAX), 1e6);
+}
+
+TEST (ArkulibOverflow, ApproximateKeepsTheOtherErrors) {
+    using FlagRational = Arkulib::Rational<int, Arkulib::Policies::Canonical, Arkulib::Policies::Approximate<Arkulib::Policies::StatusFlag>>;
+    Arkulib::Policies::StatusFlag::clear();
+
+    ASSERT_EQ (FlagRational(1, 2) / FlagRational::Zero(), FlagRational::Zero());
+    ASSERT_EQ (Arkulib::Policies::StatusFlag::status(), Arkulib::ArkulibError::DivideByZero);
+    Arkulib::Policies::StatusFlag::clear();
+
+    EXPECT_THROW(Arkulib::Rational<int>(INT_MAX, 3) * Arkulib::Rational<int>(2, 1), Arkulib::Exceptions::NumberTooLargeException);
+}
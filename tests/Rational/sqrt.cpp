@@ -1,4 +1,7 @@
+#include <climits>
+#include <cmath>
 #include <gtest/gtest.h>
+#include "../../include/BigInt.hpp"
 #include "../../include/Rational.hpp"
 
 TEST (ArkulibSquareOperation, Rationals) {
@@ -36,4 +39,58 @@ TEST (ArkulibSquareOperation, SquareTimeSquare) {
 TEST (ArkulibSquareOperation, BigRationals) {
     Arkulib::Rational r1(6561, 2401);
     ASSERT_EQ (r1.sqrt(), Arkulib::Rational(81, 49));
-}
\ No newline at end of file
+}
+
+TEST (ArkulibSquareOperation, LazyIsReducedFirst) {
+    Arkulib::Rational<int, Arkulib::Policies::Lazy> r1(8, 18);
+    ASSERT_EQ (r1.sqrt().getNumerator(), 2);
+    ASSERT_EQ (r1.sqrt().getDenominator(), 3);
+}
+
+TEST (ArkulibSquareOperation, IrrationalRoots) {
+    for (int numerator = 1; numerator < 50; ++numerator) {
+        for (int denominator = 1; denominator < 50; ++denominator) {
+            const Arkulib::Rational r1(numerator, denominator);
+            const double expected = std::sqrt(double(numerator) / denominator);
+            ASSERT_NEAR (r1.sqrt().toRealNumber<double>(), expected, 1e-8);
+            ASSERT_LE (r1.sqrt().getDenominator(), 46340);
+        }
+    }
+    ASSERT_NEAR (Arkulib::Rational(2).sqrt().toRealNumber<double>(), std::sqrt(2.), 1e-9);
+    ASSERT_NEAR (Arkulib::Rational(INT_MAX, 3).sqrt().toRealNumber<double>(), std::sqrt(INT_MAX / 3.), 1e-4);
+}
+
+TEST (ArkulibSquareOperation, ErrorBound) {
+    const Arkulib::Rational<long long int> r1(2);
+    for (long long int inverseError = 1; inverseError <= 1000000000000LL; inverseError *= 10) {
+        const auto root = r1.sqrt(Arkulib::Rational<long long int>(1, inverseError));
+        const long double error = std::sqrt(2.L) - (long double) root.getNumerator() / root.getDenominator();
+        ASSERT_GE (error, 0.L);
+        ASSERT_LT (error, 1.L / inverseError);
+    }
+    ASSERT_EQ (r1.sqrt(Arkulib::Rational<long long int>(1, 100)), Arkulib::Rational<long long int>(141, 100));
+
+    // Exact whatever the error
+    ASSERT_EQ (Arkulib::Rational<long long int>(49, 64).sqrt(Arkulib::Rational<long long int>(1, 2)), Arkulib::Rational<long long int>(7, 8));
+}
+
+TEST (ArkulibSquareOperation, Errors) {
+    ASSERT_THROW ((void) Arkulib::Rational(-4, 9).sqrt(), Arkulib::Exceptions::NegativeSqrtException);
+    ASSERT_THROW ((void) Arkulib::Rational(2).sqrt(Arkulib::Rational(0)), Arkulib::Exceptions::DivideByZeroException);
+    ASSERT_THROW ((void) Arkulib::Rational(10).sqrt(Arkulib::Rational(1, 1000000000)), Arkulib::Exceptions::NumberTooLargeException);
+}
+
+TEST (ArkulibSquareOperation, LargeIntegers) {
+    const long long int root = 3037000499LL;
+    const Arkulib::Rational<long long int> square(root * root, 9);
+    ASSERT_EQ (square.sqrt(), Arkulib::Rational<long long int>(root, 3));
+
+    const Arkulib::Rational<Arkulib::BigInt> big(Arkulib::BigInt("152415787532388367501905199875019052100"), Arkulib::BigInt(4));
+    ASSERT_EQ (big.sqrt().getNumerator().toString(), "6172839450617283945");
+    ASSERT_EQ (big.sqrt().getDenominator().toString(), "1");
+
+    const auto two = Arkulib::Rational<Arkulib::BigInt>(2).sqrt();
+    // 1414213562373095048 / 10^18, reduced
+    ASSERT_EQ (two.getNumerator().toString(), "176776695296636881");
+    ASSERT_EQ (two.getDenominator().toString(), "125000000000000000");
+}
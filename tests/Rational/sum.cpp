@@ -0,0 +1,88 @@
+#include <array>
+#include <climits>
+#include <random>
+#include <vector>
+#include <gtest/gtest.h>
+#include "../../include/Algorithms.hpp"
+
+TEST (ArkulibRationalSum, Sum) {
+    const std::vector<Arkulib::Rational<int>> values = {{1, 2}, {1, 3}, {1, 6}, {-5, 4}};
+    ASSERT_EQ (Arkulib::sum(values), Arkulib::Rational<int>(-1, 4));
+    ASSERT_EQ (Arkulib::sum(values.begin(), values.begin() + 3), Arkulib::Rational<int>(1));
+    ASSERT_TRUE(Arkulib::sum(std::vector<Arkulib::Rational<int>>()).isZero());
+
+    const std::array<Arkulib::Rational<long long>, 3> array = {{{1, 256}, {3, 256}, {1, 128}}};
+    ASSERT_EQ (Arkulib::sum(array), Arkulib::Rational<long long>(3, 128));
+}
+
+TEST (ArkulibRationalSum, OnlyTheResultMustFit) {
+    // A fold with operator+= throws at the second element
+    const std::vector<Arkulib::Rational<int>> values = {{INT_MAX, 1}, {INT_MAX, 1}, {-INT_MAX, 1}, {-INT_MAX, 1}, {1, 3}};
+    ASSERT_THROW(values[0] + values[1], Arkulib::Exceptions::NumberTooLargeException);
+    ASSERT_EQ (Arkulib::sum(values), Arkulib::Rational<int>(1, 3));
+
+    const std::vector<Arkulib::Rational<int>> tooLarge = {{INT_MAX, 1}, {INT_MAX, 1}};
+    ASSERT_THROW(Arkulib::sum(tooLarge), Arkulib::Exceptions::NumberTooLargeException);
+
+    // The common denominator of these terms overflows 128 bits: the sum goes on with BigInt
+    const long long p1 = (1LL << 61) - 1, p2 = (1LL << 61) - 3, p3 = (1LL << 61) - 5;
+    const std::vector<Arkulib::Rational<long long>> large = {
+            {1, p1}, {1, p2}, {1, p3}, {1, 2}, {-1, p1}, {-1, p2}, {-1, p3}
+    };
+    ASSERT_EQ (Arkulib::sum(large), Arkulib::Rational<long long>(1, 2));
+}
+
+TEST (ArkulibRationalSum, SameAsFold) {
+    std::mt19937 generator(7);
+    std::uniform_int_distribution<int> numerators(-1000, 1000), denominators(1, 40);
+    std::vector<Arkulib::Rational<long long>> values;
+    Arkulib::Rational<Arkulib::BigInt> expected;
+    for (int i = 0; i < 200; ++i) {
+        values.emplace_back(numerators(generator), denominators(generator));
+        expected += Arkulib::Rational<Arkulib::BigInt>(values.back().getNumerator(), values.back().getDenominator());
+    }
+    const Arkulib::Rational<long long> result = Arkulib::sum(values);
+    ASSERT_EQ (Arkulib::BigInt(result.getNumerator()), expected.getNumerator());
+    ASSERT_EQ (Arkulib::BigInt(result.getDenominator()), expected.getDenominator());
+
+    std::vector<Arkulib::Rational<Arkulib::BigInt>> bigValues(3, Arkulib::Rational<Arkulib::BigInt>(1, 3));
+    ASSERT_EQ (Arkulib::sum(bigValues), Arkulib::Rational<Arkulib::BigInt>(1));
+}
+
+TEST (ArkulibRationalSum, Dot) {
+    const std::vector<Arkulib::Rational<int>> a = {{1, 2}, {2, 3}, {INT_MAX, 1}};
+    const std::vector<Arkulib::Rational<int>> b = {{4, 1}, {3, 4}, {0, 1}};
+    ASSERT_EQ (Arkulib::dot(a, b), Arkulib::Rational<int>(5, 2));
+
+    // INT_MAX * INT_MAX - INT_MAX * (INT_MAX - 1) = INT_MAX
+    const std::vector<Arkulib::Rational<int>> c = {{INT_MAX, 1}, {INT_MAX, 1}};
+    const std::vector<Arkulib::Rational<int>> d = {{INT_MAX, 1}, {1 - INT_MAX, 1}};
+    ASSERT_EQ (Arkulib::dot(c, d), Arkulib::Rational<int>(INT_MAX));
+
+    ASSERT_THROW(Arkulib::dot(a, c), Arkulib::Exceptions::InvalidAccessArgument);
+
+#if defined(__cpp_lib_span)
+    ASSERT_EQ (Arkulib::sum(std::span<const Arkulib::Rational<int>>(a.data(), 2)), Arkulib::Rational<int>(7, 6));
+    ASSERT_EQ (Arkulib::dot(std::span<const Arkulib::Rational<int>>(a), std::span<const Arkulib::Rational<int>>(b)), Arkulib::Rational<int>(5, 2));
+#endif
+}
+
+TEST (ArkulibRationalSum, Approximate) {
+    // A result that doesn't fit is approximated like the overflows of operator+
+    using R = Arkulib::Rational<int, Arkulib::Policies::Canonical, Arkulib::Policies::Approximate<Arkulib::Policies::Throw>>;
+    const std::vector<R> values = {{1, INT_MAX}, {1, INT_MAX - 1}, {2, 3}};
+    const R fold = values[0] + values[1] + values[2];
+
+    Arkulib::Policies::Approximate<Arkulib::Policies::Throw>::resetStats();
+    ASSERT_EQ (Arkulib::sum(values), fold);
+    ASSERT_EQ (Arkulib::Policies::Approximate<Arkulib::Policies::Throw>::stats().count, 1u);
+
+    const std::vector<R> large = {{INT_MAX, 1}, {INT_MAX, 1}, {-1, 3}};
+    ASSERT_EQ (Arkulib::sum(large), R(INT_MAX));
+    ASSERT_EQ (Arkulib::sum(std::vector<R>{{-INT_MAX, 1}, {-INT_MAX, 1}}), R(-INT_MAX));
+
+    const std::vector<R> ones(3, R(1));
+    ASSERT_EQ (Arkulib::dot(ones, values), fold);
+    ASSERT_EQ (Arkulib::Policies::Approximate<Arkulib::Policies::Throw>::stats().count, 4u);
+    Arkulib::Policies::Approximate<Arkulib::Policies::Throw>::resetStats();
+}
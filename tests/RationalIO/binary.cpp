@@ -0,0 +1,122 @@
+#include <climits>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <sstream>
+#include <gtest/gtest.h>
+#include "../../include/RationalIO.hpp"
+
+namespace {
+    using R = Arkulib::Rational<long long>;
+
+    std::vector<R> randomRationals(const std::size_t count) {
+        std::mt19937 generator(5);
+        std::uniform_int_distribution<long long> numerators(LLONG_MIN / 2, LLONG_MAX / 2), denominators(1, 1000);
+        std::vector<R> rationals;
+        for (std::size_t i = 0; i < count; ++i) rationals.emplace_back(numerators(generator), denominators(generator));
+        return rationals;
+    }
+
+    template<typename RationalType>
+    std::string encode(const std::vector<RationalType> &values, const Arkulib::IO::BinaryOptions &options) {
+        std::ostringstream stream;
+        Arkulib::IO::BinaryWriter writer(stream, options);
+        writer.write(values.begin(), values.end());
+        writer.flush();
+        return stream.str();
+    }
+}
+
+TEST (ArkulibBinaryIO, RoundTrip) {
+    auto values = randomRationals(1000);
+    values.emplace_back(LLONG_MIN, 1);
+    values.emplace_back(LLONG_MAX, LLONG_MAX - 1);
+    for (const bool isDelta: {false, true}) {
+        const std::string data = encode(values, {64, isDelta});
+        const Arkulib::IO::BinaryView<R> view(data.data(), data.size());
+        EXPECT_TRUE (view.status() == std::errc());
+        EXPECT_EQ (view.isDelta(), isDelta);
+        EXPECT_EQ (view.size(), values.size());
+        EXPECT_EQ (view.blockCount(), (values.size() + 63) / 64);
+        EXPECT_EQ (std::vector<R>(view.begin(), view.end()), values);
+    }
+}
+
+TEST (ArkulibBinaryIO, DeltaEncodingOfSortedColumns) {
+    // 1/48000 s frames, not reduced: after the first value (6 bytes), the deltas take one byte each
+    using Lazy = Arkulib::Rational<long long, Arkulib::Policies::Lazy>;
+    std::vector<Lazy> frames;
+    for (long long i = 0; i < 4096; ++i) frames.emplace_back(1000000 + i, 48000, false);
+    const std::string plain = encode(frames, {4096, false}), delta = encode(frames, {4096, true});
+    EXPECT_EQ (delta.size(), Arkulib::IO::BINARY_HEADER_SIZE + Arkulib::IO::BINARY_BLOCK_HEADER_SIZE + 6 + 2 * (frames.size() - 1));
+    EXPECT_LT (delta.size() * 2, plain.size());
+
+    const Arkulib::IO::BinaryView<Lazy> view(delta.data(), delta.size());
+    std::size_t index = 0;
+    for (const auto &value: view) EXPECT_EQ (value.getNumerator(), 1000000 + static_cast<long long>(index++));
+    EXPECT_EQ (index, frames.size());
+}
+
+TEST (ArkulibBinaryIO, RandomAccess) {
+    const auto values = randomRationals(1000);
+    const std::string data = encode(values, {100, true});
+    const Arkulib::IO::BinaryView<R> view(data.data(), data.size());
+    for (const std::size_t index: {0, 1, 99, 100, 555, 999}) EXPECT_EQ (view.at(index), values[index]);
+    EXPECT_EQ (*view.blockBegin(3), values[300]);
+    EXPECT_EQ (view.blockBegin(3).index(), 300U);
+    EXPECT_TRUE (view.blockBegin(10) == view.end());
+    ASSERT_THROW (static_cast<void>(view.at(1000)), Arkulib::Exceptions::InvalidAccessArgument);
+}
+
+TEST (ArkulibBinaryIO, NumberTooLarge) {
+    const std::string data = encode(std::vector<R>{R(1, 2), R(LLONG_MAX, 3), R(-4, 5)}, {});
+    using Small = Arkulib::Rational<int, Arkulib::Policies::Canonical, Arkulib::Policies::StatusFlag>;
+    Arkulib::Policies::StatusFlag::clear();
+    const Arkulib::IO::BinaryView<Small> view(data.data(), data.size());
+    EXPECT_EQ (std::vector<Small>(view.begin(), view.end()), (std::vector<Small>{Small(1, 2), Small(), Small(-4, 5)}));
+    EXPECT_EQ (Arkulib::Policies::StatusFlag::status(), Arkulib::ArkulibError::NumberTooLarge);
+    Arkulib::Policies::StatusFlag::clear();
+
+    const Arkulib::IO::BinaryView<Arkulib::Rational<int>> throwing(data.data(), data.size());
+    ASSERT_THROW (static_cast<void>(throwing.at(1)), Arkulib::Exceptions::NumberTooLargeException);
+}
+
+TEST (ArkulibBinaryIO, MalformedData) {
+    const std::string data = encode(randomRationals(10), {4, false});
+
+    const Arkulib::IO::BinaryView<R> notTheFormat("ARKX\1\0\0\0", 8);
+    EXPECT_TRUE (notTheFormat.status() == std::errc::invalid_argument);
+    EXPECT_TRUE (notTheFormat.empty());
+
+    std::string otherVersion = data;
+    otherVersion[4] = 2;
+    EXPECT_TRUE (Arkulib::IO::BinaryView<R>(otherVersion.data(), otherVersion.size()).status() == std::errc::not_supported);
+
+    // The complete blocks before a truncation are kept
+    const Arkulib::IO::BinaryView<R> truncated(data.data(), data.size() - 1);
+    EXPECT_TRUE (truncated.status() == std::errc::invalid_argument);
+    EXPECT_EQ (truncated.size(), 8U);
+}
+
+#ifdef ARKULIB_HAS_MMAP
+TEST (ArkulibBinaryIO, MappedFile) {
+    const auto values = randomRationals(5000);
+    const std::string path = (std::filesystem::temp_directory_path() / "arkulib_binary_test.arkr").string();
+    {
+        std::ofstream file(path, std::ios::binary);
+        Arkulib::IO::BinaryWriter writer(file, {256, true});
+        writer.write(values.begin(), values.end());
+    }
+
+    {
+        const Arkulib::IO::MappedFile file(path);
+        ASSERT_TRUE (file.status() == std::errc());
+        const Arkulib::IO::BinaryView<R> view(file);
+        EXPECT_EQ (std::vector<R>(view.begin(), view.end()), values);
+    }
+    std::remove(path.c_str());
+
+    EXPECT_TRUE (Arkulib::IO::MappedFile(path).status() == std::errc::no_such_file_or_directory);
+}
+#endif
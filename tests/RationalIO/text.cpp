@@ -0,0 +1,81 @@
+#include <random>
+#include <sstream>
+#include <gtest/gtest.h>
+#include "../../include/BigInt.hpp"
+#include "../../include/RationalIO.hpp"
+
+namespace {
+    std::vector<Arkulib::Rational<long long>> randomRationals(const std::size_t count) {
+        std::mt19937 generator(11);
+        std::uniform_int_distribution<long long> numerators(-1000000000000LL, 1000000000000LL), denominators(1, 1000000);
+        std::vector<Arkulib::Rational<long long>> rationals;
+        for (std::size_t i = 0; i < count; ++i) rationals.emplace_back(numerators(generator), denominators(generator));
+        return rationals;
+    }
+}
+
+TEST (ArkulibTextIO, RoundTrip) {
+    const auto rationals = randomRationals(5000);
+    for (const std::size_t bufferSize: {std::size_t(64), std::size_t(100), Arkulib::IO::DEFAULT_BUFFER_SIZE}) {
+        std::stringstream stream;
+        {
+            Arkulib::IO::TextWriter writer(stream, bufferSize);
+            writer.write(rationals.begin(), rationals.end());
+        }
+
+        Arkulib::IO::TextReader reader(stream, bufferSize);
+        EXPECT_EQ (reader.readAll<Arkulib::Rational<long long>>(), rationals);
+        EXPECT_TRUE (reader.status() == std::errc());
+    }
+}
+
+TEST (ArkulibTextIO, Format) {
+    std::ostringstream stream;
+    Arkulib::IO::TextWriter writer(stream, 16, ' ');
+    writer.write(Arkulib::Rational<int>(6, -4));
+    writer.write(Arkulib::Rational<int>(5));
+    EXPECT_EQ (stream.str(), "");
+    writer.flush();
+    EXPECT_EQ (stream.str(), "-3/2 5/1 ");
+}
+
+TEST (ArkulibTextIO, MixedInput) {
+    using R = Arkulib::Rational<int>;
+    std::istringstream stream("1/2, (3 / 4)\r\n  7\t-0.125\n\n(-1/3)\n");
+    Arkulib::IO::TextReader reader(stream, 8);
+    EXPECT_EQ (reader.readAll<R>(), (std::vector<R>{R(1, 2), R(3, 4), R(7), R(-1, 8), R(-1, 3)}));
+    EXPECT_TRUE (reader.status() == std::errc());
+}
+
+TEST (ArkulibTextIO, MalformedInput) {
+    using R = Arkulib::Rational<int>;
+    std::istringstream stream("1/2 3/0 5/6");
+    Arkulib::IO::TextReader reader(stream);
+    R value;
+    EXPECT_TRUE (reader.read(value));
+    EXPECT_FALSE (reader.read(value));
+    EXPECT_TRUE (reader.status() == std::errc::invalid_argument);
+    EXPECT_FALSE (reader.read(value));
+    EXPECT_EQ (value, R(1, 2));
+
+    std::istringstream signs("1/-2 -2147483648/-1");
+    Arkulib::IO::TextReader signReader(signs);
+    EXPECT_TRUE (signReader.read(value));
+    EXPECT_EQ (value, R(-1, 2));
+    EXPECT_FALSE (signReader.read(value));
+    EXPECT_TRUE (signReader.status() == std::errc::result_out_of_range);
+}
+
+TEST (ArkulibTextIO, LargeValues) {
+    using R = Arkulib::Rational<Arkulib::BigInt>;
+    const R large(Arkulib::BigInt("-1234567890123456789012345678901234567890123456789012345678901"), 2);
+    std::stringstream stream;
+    {
+        // The value doesn't fit in the buffer of the writer, which grows
+        Arkulib::IO::TextWriter writer(stream, 8);
+        writer.write(large);
+        writer.write(R(3));
+    }
+    Arkulib::IO::TextReader reader(stream, 256);
+    EXPECT_EQ (reader.readAll<R>(), (std::vector<R>{large, R(3)}));
+}
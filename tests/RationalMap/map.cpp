@@ -0,0 +1,94 @@
+#include <random>
+#include <unordered_map>
+#include <unordered_set>
+#include <gtest/gtest.h>
+#include "../../include/RationalMap.hpp"
+
+namespace {
+    using R = Arkulib::Rational<int>;
+    using Lazy = Arkulib::Rational<int, Arkulib::Policies::Lazy>;
+}
+
+TEST (ArkulibRationalHash, ReducedForm) {
+    EXPECT_EQ (std::hash<Lazy>()(Lazy(2, 4)), std::hash<Lazy>()(Lazy(1, 2)));
+    EXPECT_EQ (std::hash<Lazy>()(Lazy(-3, 6)), std::hash<R>()(R(-1, 2)));
+    EXPECT_NE (std::hash<R>()(R(1, 2)), std::hash<R>()(R(2, 1)));
+    EXPECT_NE (std::hash<R>()(R(1, 2)), std::hash<R>()(R(-1, 2)));
+
+    using Big = Arkulib::Rational<Arkulib::BigInt>;
+    EXPECT_EQ (std::hash<Big>()(Big(Arkulib::BigInt(6), Arkulib::BigInt(4))), std::hash<Big>()(Big(3, 2)));
+    EXPECT_EQ (std::hash<Arkulib::BigInt>()(Arkulib::BigInt("123456789012345678901234567890")),
+               std::hash<Arkulib::BigInt>()(Arkulib::BigInt("123456789012345678901234567890")));
+
+    std::unordered_set<Lazy> set{Lazy(2, 4), Lazy(1, 2), Lazy(3, 6), Lazy(1, 3)};
+    EXPECT_EQ (set.size(), 2U);
+}
+
+TEST (ArkulibRationalMap, SameAsUnorderedMap) {
+    std::mt19937 generator(17);
+    std::uniform_int_distribution<int> numerators(-50, 50), denominators(1, 50), operations(0, 3);
+    Arkulib::RationalMap<R, int> map;
+    std::unordered_map<R, int> reference;
+
+    for (int i = 0; i < 20000; ++i) {
+        const R key(numerators(generator), denominators(generator));
+        switch (operations(generator)) {
+            case 0:
+                ASSERT_EQ (map.insert(key, i).second, reference.emplace(key, i).second);
+                break;
+            case 1:
+                ASSERT_EQ (map.erase(key), reference.erase(key) == 1);
+                break;
+            case 2:
+                map[key] += 1;
+                reference[key] += 1;
+                break;
+            default:
+                const int *value = map.find(key);
+                const auto it = reference.find(key);
+                ASSERT_EQ (value != nullptr, it != reference.end());
+                if (value != nullptr) {
+                    ASSERT_EQ (*value, it->second);
+                }
+        }
+        ASSERT_EQ (map.size(), reference.size());
+    }
+
+    std::size_t count = 0;
+    map.forEach([&](const R &key, const int value) {
+        ++count;
+        EXPECT_EQ (reference.at(key), value);
+    });
+    EXPECT_EQ (count, reference.size());
+}
+
+TEST (ArkulibRationalMap, Set) {
+    Arkulib::RationalSet<Lazy> set(1000);
+    EXPECT_EQ (set.capacity(), 2048U);
+    for (int denominator = 1; denominator <= 100; ++denominator) {
+        for (int numerator = 0; numerator <= denominator; ++numerator) set.insert(Lazy(numerator, denominator));
+    }
+    // The Farey sequence of order 100 has 3045 terms
+    EXPECT_EQ (set.size(), 3045U);
+    EXPECT_TRUE (set.contains(Lazy(50, 100)));
+    EXPECT_FALSE (set.contains(Lazy(101, 100)));
+    EXPECT_FALSE (set.insert(Lazy(2, 4)));
+    EXPECT_TRUE (set.erase(Lazy(1, 2)));
+    EXPECT_FALSE (set.contains(Lazy(2, 4)));
+
+    set.forEach([](const Lazy &key) { EXPECT_EQ (key, key.simplify()); });
+    set.clear();
+    EXPECT_TRUE (set.empty());
+    EXPECT_FALSE (set.contains(Lazy(1, 3)));
+}
+
+TEST (ArkulibRationalMap, BigIntKeys) {
+    using Big = Arkulib::Rational<Arkulib::BigInt>;
+    Arkulib::RationalMap<Big, std::string> map;
+    const Big large(Arkulib::BigInt("123456789012345678901234567890"), Arkulib::BigInt(7));
+    map[large] = "large";
+    map[Big(1, 2)] = "half";
+    EXPECT_EQ (*map.find(large), "large");
+    EXPECT_EQ (*map.find(Big(Arkulib::BigInt(2), Arkulib::BigInt(4))), "half");
+    EXPECT_EQ (map.find(Big(1, 3)), nullptr);
+}
@@ -0,0 +1,165 @@
+#include <random>
+#include <gtest/gtest.h>
+#include "../../include/RationalMatrix.hpp"
+
+namespace {
+    template<typename IntType>
+    Arkulib::RationalMatrix<IntType> hilbert(const std::size_t size) {
+        Arkulib::RationalMatrix<IntType> matrix(size, size);
+        for (std::size_t i = 0; i < size; ++i) {
+            for (std::size_t j = 0; j < size; ++j) matrix(i, j) = {IntType(1), IntType(i + j + 1)};
+        }
+        return matrix;
+    }
+
+    Arkulib::RationalMatrix<long long> randomMatrix(const std::size_t rows, const std::size_t columns, const unsigned seed) {
+        std::mt19937 generator(seed);
+        std::uniform_int_distribution<long long> numerators(-9, 9), denominators(1, 4);
+        Arkulib::RationalMatrix<long long> matrix(rows, columns);
+        for (std::size_t i = 0; i < rows; ++i) {
+            for (std::size_t j = 0; j < columns; ++j) matrix(i, j) = {numerators(generator), denominators(generator)};
+        }
+        return matrix;
+    }
+}
+
+TEST (ArkulibRationalMatrix, Accessors) {
+    using Matrix = Arkulib::RationalMatrix<int>;
+    using R = Matrix::RationalType;
+    const Matrix matrix({{R(1), R(2), R(3)}, {R(1, 2), R(5), R(6)}});
+    ASSERT_EQ (matrix.rowCount(), 2U);
+    ASSERT_EQ (matrix.columnCount(), 3U);
+    ASSERT_FALSE(matrix.isSquare());
+    ASSERT_EQ (matrix(1, 0), R(1, 2));
+    ASSERT_EQ (matrix.at(0, 2), R(3));
+    ASSERT_THROW(static_cast<void>(matrix.at(2, 0)), Arkulib::Exceptions::InvalidAccessArgument);
+    ASSERT_THROW(Matrix({{R(1), R(2)}, {R(3)}}), Arkulib::Exceptions::InvalidAccessArgument);
+    ASSERT_EQ (matrix.transpose().transpose(), matrix);
+    ASSERT_EQ (matrix.transpose()(2, 1), R(6));
+}
+
+TEST (ArkulibRationalMatrix, Operators) {
+    using Matrix = Arkulib::RationalMatrix<int>;
+    using R = Matrix::RationalType;
+    const Matrix a({{R(1), R(2)}, {R(3), R(4)}}), b({{R(1, 2), R(0)}, {R(0), R(1, 3)}});
+    ASSERT_EQ (a + b, Matrix({{R(3, 2), R(2)}, {R(3), R(13, 3)}}));
+    ASSERT_EQ (a - a, Matrix(2, 2));
+    ASSERT_EQ (a * b, Matrix({{R(1, 2), R(2, 3)}, {R(3, 2), R(4, 3)}}));
+    ASSERT_EQ (a * Matrix::Identity(2), a);
+    ASSERT_THROW(a * Matrix(3, 1), Arkulib::Exceptions::InvalidAccessArgument);
+
+    // Larger than a block
+    const Arkulib::RationalMatrix<long long> c = randomMatrix(40, 35, 1), d = randomMatrix(35, 37, 2);
+    const Arkulib::RationalMatrix<long long> product = c * d;
+    for (std::size_t i = 0; i < 40; i += 13) {
+        for (std::size_t j = 0; j < 37; j += 9) {
+            Arkulib::Rational<long long> expected;
+            for (std::size_t k = 0; k < 35; ++k) expected += c(i, k) * d(k, j);
+            ASSERT_EQ (product(i, j), expected);
+        }
+    }
+}
+
+TEST (ArkulibRationalMatrix, Determinant) {
+    using Matrix = Arkulib::RationalMatrix<long long>;
+    using R = Matrix::RationalType;
+    ASSERT_EQ (Matrix({{R(2), R(1)}, {R(1), R(3)}}).determinant(), R(5));
+    ASSERT_EQ (Matrix({{R(0), R(1)}, {R(1), R(0)}}).determinant(), R(-1));
+    ASSERT_EQ (Matrix({{R(1), R(2)}, {R(2), R(4)}}).determinant(), R(0));
+    ASSERT_EQ (Matrix().determinant(), R(1));
+    ASSERT_THROW(static_cast<void>(Matrix(2, 3).determinant()), Arkulib::Exceptions::InvalidAccessArgument);
+
+    // det(H4) = 1 / 6048000
+    ASSERT_EQ (hilbert<long long>(4).determinant(), R(1, 6048000));
+    ASSERT_EQ (hilbert<long long>(4).determinantGaussian(), R(1, 6048000));
+
+    for (unsigned seed = 0; seed < 5; ++seed) {
+        const Matrix matrix = randomMatrix(4, 4, seed);
+        ASSERT_EQ (matrix.determinant(), matrix.determinantGaussian());
+    }
+}
+
+TEST (ArkulibRationalMatrix, Rank) {
+    using Matrix = Arkulib::RationalMatrix<int>;
+    using R = Matrix::RationalType;
+    ASSERT_EQ (Matrix({{R(1), R(2), R(3)}, {R(2), R(4), R(6)}, {R(1), R(0), R(1)}}).rank(), 2U);
+    ASSERT_EQ (Matrix({{R(0), R(0), R(1)}, {R(0), R(0), R(2)}}).rank(), 1U);
+    ASSERT_EQ (Matrix(3, 3).rank(), 0U);
+    ASSERT_EQ (Matrix::Identity(5).rank(), 5U);
+    ASSERT_EQ (hilbert<int>(6).rank(), 6U);
+}
+
+TEST (ArkulibRationalMatrix, SolveAndInverse) {
+    using Matrix = Arkulib::RationalMatrix<long long>;
+    using R = Matrix::RationalType;
+    const Matrix a({{R(2), R(1), R(-1)}, {R(-3), R(-1), R(2)}, {R(-2), R(1), R(2)}}), b({{R(8)}, {R(-11)}, {R(-3)}});
+    ASSERT_EQ (a.solve(b), Matrix({{R(2)}, {R(3)}, {R(-1)}}));
+    ASSERT_EQ (a.solveGaussian(b), Matrix({{R(2)}, {R(3)}, {R(-1)}}));
+    ASSERT_EQ (a * a.inverse(), Matrix::Identity(3));
+
+    // The inverse of the Hilbert matrix has integer entries
+    const Matrix inverse = hilbert<long long>(5).inverse();
+    ASSERT_EQ (inverse(0, 0), R(25));
+    ASSERT_EQ (inverse(4, 4), R(44100));
+    ASSERT_EQ (hilbert<long long>(5) * inverse, Matrix::Identity(5));
+
+    for (unsigned seed = 0; seed < 5; ++seed) {
+        const Matrix matrix = randomMatrix(4, 4, seed), rightHandSide = randomMatrix(4, 2, seed + 100);
+        ASSERT_EQ (matrix.solve(rightHandSide), matrix.solveGaussian(rightHandSide));
+    }
+
+    const Matrix singular({{R(1), R(2)}, {R(2), R(4)}});
+    ASSERT_THROW(static_cast<void>(singular.solve(Matrix({{R(1)}, {R(1)}}))), Arkulib::Exceptions::DivideByZeroException);
+    ASSERT_THROW(static_cast<void>(singular.solveGaussian(Matrix({{R(1)}, {R(1)}}))), Arkulib::Exceptions::DivideByZeroException);
+    ASSERT_THROW(static_cast<void>(a.solve(Matrix(2, 1))), Arkulib::Exceptions::InvalidAccessArgument);
+}
+
+TEST (ArkulibRationalMatrix, LargeSystemWithBigInt) {
+    // The minors of a 30x30 system overflow long long: the entries are BigInt, the elimination stays exact
+    using Matrix = Arkulib::RationalMatrix<Arkulib::BigInt>;
+    std::mt19937 generator(7);
+    std::uniform_int_distribution<int> numerators(-50, 50), denominators(1, 9);
+    Matrix matrix(30, 30), rightHandSide(30, 1);
+    for (std::size_t i = 0; i < 30; ++i) {
+        for (std::size_t j = 0; j < 30; ++j) matrix(i, j) = {Arkulib::BigInt(numerators(generator)), Arkulib::BigInt(denominators(generator))};
+        rightHandSide(i, 0) = {Arkulib::BigInt(numerators(generator)), Arkulib::BigInt(1)};
+    }
+    ASSERT_EQ (matrix * matrix.solve(rightHandSide), rightHandSide);
+    ASSERT_EQ (matrix.rank(), 30U);
+}
+
+TEST (ArkulibRationalMatrix, SolveModular) {
+    using Matrix = Arkulib::RationalMatrix<long long>;
+    using R = Matrix::RationalType;
+    const Matrix a({{R(2), R(1), R(-1)}, {R(-3), R(-1), R(2)}, {R(-2), R(1), R(2)}}), b({{R(8)}, {R(-11)}, {R(-3)}});
+    ASSERT_EQ (a.solveModular(b), Matrix({{R(2)}, {R(3)}, {R(-1)}}));
+    ASSERT_EQ (hilbert<long long>(6).solveModular(Matrix::Identity(6)), hilbert<long long>(6).inverse());
+
+    for (unsigned seed = 0; seed < 5; ++seed) {
+        const Matrix matrix = randomMatrix(5, 5, seed), rightHandSide = randomMatrix(5, 2, seed + 100);
+        ASSERT_EQ (matrix.solveModular(rightHandSide, {3}), matrix.solve(rightHandSide));
+    }
+
+    const Matrix singular({{R(1), R(2), R(3)}, {R(2), R(4), R(6)}, {R(1), R(0), R(1)}});
+    ASSERT_THROW(static_cast<void>(singular.solveModular(Matrix(3, 1))), Arkulib::Exceptions::DivideByZeroException);
+    ASSERT_THROW(static_cast<void>(a.solveModular(Matrix(2, 1))), Arkulib::Exceptions::InvalidAccessArgument);
+
+    // No system to solve
+    const Matrix empty = a.solveModular(Matrix(3, 0));
+    ASSERT_EQ (empty.rowCount(), 3u);
+    ASSERT_EQ (empty.columnCount(), 0u);
+}
+
+TEST (ArkulibRationalMatrix, SolveModularLargeSystem) {
+    using Matrix = Arkulib::RationalMatrix<Arkulib::BigInt>;
+    std::mt19937 generator(11);
+    std::uniform_int_distribution<int> numerators(-1000, 1000), denominators(1, 20);
+    Matrix matrix(40, 40), rightHandSide(40, 1);
+    for (std::size_t i = 0; i < 40; ++i) {
+        for (std::size_t j = 0; j < 40; ++j) matrix(i, j) = {Arkulib::BigInt(numerators(generator)), Arkulib::BigInt(denominators(generator))};
+        rightHandSide(i, 0) = {Arkulib::BigInt(numerators(generator)), Arkulib::BigInt(denominators(generator))};
+    }
+    const Matrix solution = matrix.solveModular(rightHandSide, {2});
+    ASSERT_EQ (matrix * solution, rightHandSide);
+    ASSERT_EQ (solution, matrix.solve(rightHandSide));
+}
@@ -0,0 +1,127 @@
+#include <climits>
+#include <random>
+#include <sstream>
+#include <gtest/gtest.h>
+#include "../../include/RationalPolynomial.hpp"
+
+namespace {
+    using Polynomial = Arkulib::RationalPolynomial<long long>;
+    using R = Polynomial::RationalType;
+
+    Polynomial randomPolynomial(const std::size_t degree, const unsigned seed) {
+        std::mt19937 generator(seed);
+        std::uniform_int_distribution<long long> numerators(-30, 30), denominators(1, 12);
+        std::vector<R> coefficients;
+        for (std::size_t i = 0; i <= degree; ++i) coefficients.emplace_back(numerators(generator), denominators(generator));
+        coefficients.back() = R(1, 7);
+        return Polynomial(coefficients);
+    }
+
+    // The product with Rational operators, to compare
+    Polynomial naiveProduct(const Polynomial &a, const Polynomial &b) {
+        std::vector<R> coefficients(a.degree() + b.degree() + 1);
+        for (std::size_t i = 0; i <= a.degree(); ++i) {
+            for (std::size_t j = 0; j <= b.degree(); ++j) coefficients[i + j] += a.coefficient(i) * b.coefficient(j);
+        }
+        return Polynomial(coefficients);
+    }
+}
+
+TEST (ArkulibRationalPolynomial, Accessors) {
+    Polynomial polynomial({R(1), R(0), R(1, 2), R(0)});
+    ASSERT_EQ (polynomial.degree(), 2U);
+    ASSERT_EQ (polynomial.coefficient(2), R(1, 2));
+    ASSERT_EQ (polynomial.coefficient(10), R(0));
+    ASSERT_TRUE(Polynomial().isZero());
+    ASSERT_TRUE(Polynomial({R(0), R(0)}).isZero());
+
+    polynomial.setCoefficient(4, R(-3, 4));
+    ASSERT_EQ (polynomial.degree(), 4U);
+    polynomial.setCoefficient(4, R(0));
+    ASSERT_EQ (polynomial.degree(), 2U);
+
+    std::ostringstream stream;
+    stream << polynomial;
+    ASSERT_EQ (stream.str(), "(1 / 2) x^2 + (1 / 1)");
+}
+
+TEST (ArkulibRationalPolynomial, Evaluate) {
+    const Polynomial polynomial({R(1), R(-2, 3), R(1, 2)});
+    ASSERT_EQ (polynomial.evaluate(R(0)), R(1));
+    // 1 - 2/3 * 3/4 + 1/2 * 9/16 = 25/32
+    ASSERT_EQ (polynomial.evaluate(R(3, 4)), R(25, 32));
+    ASSERT_EQ (polynomial.evaluate(R(-3, 4)), R(57, 32));
+    ASSERT_DOUBLE_EQ(polynomial.evaluate(0.75), 25. / 32.);
+    ASSERT_EQ (Polynomial().evaluate(R(5)), R(0));
+
+    const std::vector<R> values = polynomial.evaluate(std::vector<R>{R(0), R(3, 4)});
+    ASSERT_EQ (values, (std::vector<R>{R(1), R(25, 32)}));
+
+    // Degree 20: the same value as the Rational operators on BigInt (one gcd instead of 40)
+    using BigRational = Arkulib::Rational<Arkulib::BigInt>;
+    const Polynomial large = randomPolynomial(20, 3);
+    for (const R &x: {R(1, 2), R(-3, 2), R(1)}) {
+        const BigRational bigX(Arkulib::BigInt(x.getNumerator()), Arkulib::BigInt(x.getDenominator()));
+        BigRational expected, power(Arkulib::BigInt(1), Arkulib::BigInt(1));
+        for (std::size_t i = 0; i <= 20; ++i) {
+            expected += BigRational(Arkulib::BigInt(large.coefficient(i).getNumerator()), Arkulib::BigInt(large.coefficient(i).getDenominator())) * power;
+            power *= bigX;
+        }
+        const R value = large.evaluate(x);
+        ASSERT_EQ (Arkulib::BigInt(value.getNumerator()), expected.getNumerator());
+        ASSERT_EQ (Arkulib::BigInt(value.getDenominator()), expected.getDenominator());
+    }
+}
+
+TEST (ArkulibRationalPolynomial, EvaluateOnlyTheResultMustFit) {
+    // x^2 - LLONG_MAX at 3037000500: x^2 overflows long long, not the value
+    const Polynomial polynomial({R(-LLONG_MAX), R(0), R(1)});
+    const R x(3037000500LL);
+    ASSERT_THROW(static_cast<void>(x * x), Arkulib::Exceptions::NumberTooLargeException);
+    ASSERT_EQ (polynomial.evaluate(x), R(145474193));
+
+    // The wide type overflows too (x^5 = 2^155): the scheme goes on with BigInt, then the value doesn't fit
+    const Polynomial power5({R(0), R(0), R(0), R(0), R(0), R(1, 1LL << 60)});
+    ASSERT_EQ (power5.evaluate(R(1LL << 12)), R(1));
+    ASSERT_THROW(static_cast<void>(power5.evaluate(R(1LL << 31))), Arkulib::Exceptions::NumberTooLargeException);
+}
+
+TEST (ArkulibRationalPolynomial, Approximate) {
+    // The coefficients and the values that don't fit are approximated like the overflows of the operators
+    using Policy = Arkulib::Policies::Approximate<Arkulib::Policies::Throw>;
+    using ApproximatePolynomial = Arkulib::RationalPolynomial<int, Policy>;
+    using A = ApproximatePolynomial::RationalType;
+    const A x(46341, 46343);
+    const ApproximatePolynomial square({A(0), A(0), A(1)}), linear({A(0), x});
+    Policy::resetStats();
+
+    ASSERT_EQ (square.evaluate(x), x * x);
+    ASSERT_EQ ((linear * linear).coefficient(2), x * x);
+    ASSERT_EQ (Policy::stats().count, 4u);
+    Policy::resetStats();
+}
+
+TEST (ArkulibRationalPolynomial, EvaluateBatch) {
+    const Polynomial polynomial = randomPolynomial(12, 5);
+    std::vector<double> points;
+    for (int i = 0; i < 1000; ++i) points.push_back(-1. + i / 500.);
+    const std::vector<double> values = polynomial.evaluate(points);
+    ASSERT_EQ (values.size(), points.size());
+    for (std::size_t i = 0; i < points.size(); i += 37) ASSERT_DOUBLE_EQ(values[i], polynomial.evaluate(points[i]));
+    ASSERT_NEAR (polynomial.evaluate(0.5), polynomial.evaluate(R(1, 2)).toRealNumber<double>(), 1e-12);
+}
+
+TEST (ArkulibRationalPolynomial, Operators) {
+    const Polynomial a({R(1), R(1, 2)}), b({R(-1), R(1, 2), R(1, 3)});
+    ASSERT_EQ (a + b, Polynomial({R(0), R(1), R(1, 3)}));
+    ASSERT_EQ (a - a, Polynomial());
+    ASSERT_EQ (a * b, Polynomial({R(-1), R(0), R(7, 12), R(1, 6)}));
+    ASSERT_EQ (a * Polynomial(), Polynomial());
+
+    // Large enough for Karatsuba, with different degrees
+    for (unsigned seed = 0; seed < 3; ++seed) {
+        const Polynomial c = randomPolynomial(40 + seed, seed), d = randomPolynomial(25, seed + 10);
+        ASSERT_EQ (c * d, naiveProduct(c, d));
+        ASSERT_EQ ((c * d).evaluate(R(-1)), c.evaluate(R(-1)) * d.evaluate(R(-1)));
+    }
+}
@@ -0,0 +1,157 @@
+#include <climits>
+#include <random>
+#include <vector>
+#include <gtest/gtest.h>
+#include "../../include/RationalVector.hpp"
+
+using Vector = Arkulib::RationalVector<int>;
+using Level = Arkulib::Tools::Simd::Level;
+
+namespace {
+    const std::vector<Level> levels = {Level::Scalar, Level::Sse41, Level::Avx2, Level::Avx512};
+
+    // Small values, then values near the limits of int which overflow often
+    Vector randomVector(const std::size_t size, const unsigned seed, const int bound) {
+        std::mt19937 generator(seed);
+        std::uniform_int_distribution<int> numerators(-bound, bound);
+        std::uniform_int_distribution<int> denominators(1, bound);
+        Vector vector;
+        for (std::size_t i = 0; i < size; ++i) vector.push_back(numerators(generator), denominators(generator));
+        return vector;
+    }
+
+    // Every lane must be the result of Rational<int>, or be in the mask if Rational<int> throws
+    template<typename VectorOperation, typename RationalOperation>
+    void compareWithRational(VectorOperation vectorOperation, RationalOperation rationalOperation) {
+        for (const int bound: {1000, 1 << 20, INT_MAX}) {
+            const Vector a = randomVector(203, 1, bound);
+            const Vector b = randomVector(203, 2, bound);
+            for (const Level level: levels) {
+                Arkulib::Tools::Simd::setLevel(level);
+                Vector result;
+                const Arkulib::LaneMask overflow = vectorOperation(a, b, result);
+                ASSERT_EQ (result.size(), a.size());
+                for (std::size_t lane = 0; lane < a.size(); ++lane) {
+                    try {
+                        const Arkulib::Rational<int> expected = rationalOperation(a.get(lane), b.get(lane));
+                        ASSERT_FALSE(overflow.test(lane)) << "lane " << lane << " bound " << bound;
+                        ASSERT_EQ (result.get(lane), expected) << "lane " << lane << " bound " << bound;
+                        ASSERT_GT (result.denominators()[lane], 0);
+                    } catch (const Arkulib::Exceptions::NumberTooLargeException &) {
+                        ASSERT_TRUE(overflow.test(lane)) << "lane " << lane << " bound " << bound;
+                    }
+                }
+            }
+        }
+        Arkulib::Tools::Simd::setLevel(Arkulib::Tools::Simd::detectLevel());
+    }
+}
+
+TEST (ArkulibRationalVector, Accessors) {
+    Vector vector;
+    vector.push_back(6, -4);
+    vector.push_back(Arkulib::Rational<int>(1, 3));
+    ASSERT_EQ (vector.size(), 2);
+    ASSERT_EQ (vector.get(0), Arkulib::Rational<int>(-3, 2));
+    ASSERT_EQ (vector.denominators()[0], 4);
+    ASSERT_EQ (vector.get(1), Arkulib::Rational<int>(1, 3));
+    ASSERT_EQ (reinterpret_cast<std::uintptr_t>(vector.numerators().data()) % 64, 0);
+
+    vector.set(1, 5);
+    ASSERT_EQ (vector.get(1), Arkulib::Rational<int>(5));
+    ASSERT_THROW(vector.push_back(1, 0), Arkulib::Exceptions::DivideByZeroException);
+    ASSERT_THROW(vector.set(0, INT_MIN, -1), Arkulib::Exceptions::NumberTooLargeException);
+
+    vector.resize(4);
+    ASSERT_TRUE(vector.get(3).isZero());
+}
+
+TEST (ArkulibRationalVector, Add) {
+    compareWithRational(Vector::add, [](auto a, auto b) { return a + b; });
+}
+
+TEST (ArkulibRationalVector, Subtract) {
+    compareWithRational(Vector::subtract, [](auto a, auto b) { return a - b; });
+}
+
+TEST (ArkulibRationalVector, Multiply) {
+    compareWithRational(Vector::multiply, [](auto a, auto b) { return a * b; });
+}
+
+TEST (ArkulibRationalVector, Divide) {
+    compareWithRational(Vector::divide, [](auto a, auto b) { return a / b; });
+
+    Vector a, b, result;
+    a.push_back(1, 2);
+    a.push_back(3, 4);
+    b.push_back(0);
+    b.push_back(-3, 5);
+    const Arkulib::LaneMask mask = Vector::divide(a, b, result);
+    ASSERT_TRUE(mask.test(0));
+    ASSERT_FALSE(mask.test(1));
+    ASSERT_EQ (mask.count(), 1);
+    ASSERT_EQ (result.get(1), Arkulib::Rational<int>(-5, 4));
+    ASSERT_GT (result.denominators()[1], 0);
+    ASSERT_THROW(a / b, Arkulib::Exceptions::DivideByZeroException);
+}
+
+TEST (ArkulibRationalVector, Compare) {
+    const Vector a = randomVector(131, 3, INT_MAX);
+    Vector b = randomVector(131, 4, INT_MAX);
+    for (std::size_t lane = 0; lane < b.size(); lane += 5) b.set(lane, a.get(lane));
+    b.set(1, a.numerators()[1] / 2 * 2, a.denominators()[1] / 2 * 2);
+
+    for (const Level level: levels) {
+        Arkulib::Tools::Simd::setLevel(level);
+        const Arkulib::LaneMask less = Vector::less(a, b);
+        const Arkulib::LaneMask equal = Vector::equal(a, b);
+        for (std::size_t lane = 0; lane < a.size(); ++lane) {
+            ASSERT_EQ (less.test(lane), a.get(lane) < b.get(lane)) << "lane " << lane;
+            ASSERT_EQ (equal.test(lane), a.get(lane) == b.get(lane)) << "lane " << lane;
+        }
+    }
+    Arkulib::Tools::Simd::setLevel(Arkulib::Tools::Simd::detectLevel());
+}
+
+TEST (ArkulibRationalVector, SimplifyAndConvert) {
+    Vector vector;
+    vector.push_back(2, 4);
+    vector.push_back(-9, 6);
+    vector.push_back(0, 7);
+    vector.push_back(7, 1);
+    vector.push_back(1, 3);
+    vector.simplify();
+    ASSERT_EQ (vector.numerators()[0], 1);
+    ASSERT_EQ (vector.denominators()[0], 2);
+    ASSERT_EQ (vector.numerators()[1], -3);
+    ASSERT_EQ (vector.denominators()[2], 1);
+
+    for (const Level level: levels) {
+        Arkulib::Tools::Simd::setLevel(level);
+        const std::vector<double> reals = vector.toRealNumber();
+        ASSERT_EQ (reals.size(), vector.size());
+        for (std::size_t lane = 0; lane < vector.size(); ++lane) ASSERT_DOUBLE_EQ (reals[lane], vector.get(lane).toRealNumber<double>());
+    }
+    Arkulib::Tools::Simd::setLevel(Arkulib::Tools::Simd::detectLevel());
+}
+
+TEST (ArkulibRationalVector, Operators) {
+    Vector a, b;
+    a.push_back(1, 2);
+    b.push_back(1, 3);
+    ASSERT_EQ ((a + b).get(0), Arkulib::Rational<int>(5, 6));
+    ASSERT_EQ ((a - b).get(0), Arkulib::Rational<int>(1, 6));
+    ASSERT_EQ ((a * b).get(0), Arkulib::Rational<int>(1, 6));
+    ASSERT_EQ ((a / b).get(0), Arkulib::Rational<int>(3, 2));
+    a += b;
+    ASSERT_EQ (a.get(0), Arkulib::Rational<int>(5, 6));
+
+    Vector large;
+    large.push_back(INT_MAX);
+    ASSERT_THROW(large * large, Arkulib::Exceptions::NumberTooLargeException);
+
+    // The 64-bit lanes use the scalar kernels
+    Arkulib::RationalVector<long long> wide;
+    wide.push_back(LLONG_MAX, 2);
+    ASSERT_EQ ((wide + wide).get(0), Arkulib::Rational<long long>(LLONG_MAX));
+}
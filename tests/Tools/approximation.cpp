@@ -0,0 +1,47 @@
+#include <cstdint>
+#include <gtest/gtest.h>
+#include "../../include/Tools/Approximation.hpp"
+
+TEST (ArkulibApproximation, BoundedDenominator) {
+    std::uint64_t numerator = 0, denominator = 0;
+    const std::uint64_t PI_NUMERATOR = 3141592653589793ULL;
+    const std::uint64_t PI_DENOMINATOR = 1000000000000000ULL;
+
+    Arkulib::Tools::boundedBestApproximation<std::uint64_t>(PI_NUMERATOR, PI_DENOMINATOR, 1000000, 113, numerator, denominator);
+    ASSERT_EQ(355u, numerator);
+    ASSERT_EQ(113u, denominator);
+
+    // A semiconvergent beats the convergent 22 / 7
+    Arkulib::Tools::boundedBestApproximation<std::uint64_t>(PI_NUMERATOR, PI_DENOMINATOR, 1000000, 100, numerator, denominator);
+    ASSERT_EQ(311u, numerator);
+    ASSERT_EQ(99u, denominator);
+}
+
+TEST (ArkulibApproximation, ExactWhenInTheBounds) {
+    std::uint32_t numerator = 0, denominator = 0;
+
+    Arkulib::Tools::boundedBestApproximation<std::uint32_t>(3, 4, 10, 10, numerator, denominator);
+    ASSERT_EQ(3u, numerator);
+    ASSERT_EQ(4u, denominator);
+}
+
+TEST (ArkulibApproximation, Saturation) {
+    std::uint32_t numerator = 0, denominator = 0;
+
+    Arkulib::Tools::boundedBestApproximation<std::uint32_t>(10, 1, 5, 5, numerator, denominator);
+    ASSERT_EQ(5u, numerator);
+    ASSERT_EQ(1u, denominator);
+
+    Arkulib::Tools::boundedBestApproximation<std::uint32_t>(1, 1000, 10, 10, numerator, denominator);
+    ASSERT_EQ(0u, numerator);
+    ASSERT_EQ(1u, denominator);
+}
+
+TEST (ArkulibApproximation, TieKeepsTheSmallerDenominator) {
+    std::uint32_t numerator = 0, denominator = 0;
+
+    // 0 / 1 and 1 / 2 are both at 1 / 4 of 1 / 4
+    Arkulib::Tools::boundedBestApproximation<std::uint32_t>(1, 4, 10, 2, numerator, denominator);
+    ASSERT_EQ(0u, numerator);
+    ASSERT_EQ(1u, denominator);
+}
@@ -0,0 +1,56 @@
+#include <climits>
+#include <numeric>
+#include <random>
+#include <gtest/gtest.h>
+#include "../../include/Tools/Gcd.hpp"
+
+TEST (ArkulibGcd, Classic) {
+    ASSERT_EQ(6, Arkulib::Tools::gcd(12, 18));
+    ASSERT_EQ(6, Arkulib::Tools::gcd(-12, 18));
+    ASSERT_EQ(5, Arkulib::Tools::gcd(0, -5));
+    ASSERT_EQ(0, Arkulib::Tools::gcd(0, 0));
+    ASSERT_EQ(1, Arkulib::Tools::gcd(INT_MIN, INT_MAX));
+}
+
+TEST (ArkulibGcd, Constexpr) {
+    static_assert(Arkulib::Tools::gcd(1071, 462) == 21);
+    static_assert(Arkulib::Tools::euclideanGcd(1071, 462) == 21);
+    static_assert(Arkulib::Tools::binaryGcd(1071u, 462u) == 21u);
+}
+
+TEST (ArkulibGcd, LongLongIsNotTruncated) {
+    const long long int a = 3LL << 40;
+    const long long int b = 5LL << 41;
+    ASSERT_EQ(1LL << 40, Arkulib::Tools::gcd(a, b));
+}
+
+TEST (ArkulibGcd, BinaryMatchesStd) {
+    std::mt19937_64 generator(42);
+    for (int i = 0; i < 10000; ++i) {
+        const auto a = static_cast<long long int>(generator() >> (i % 40));
+        const auto b = static_cast<long long int>(generator() >> (i % 23));
+        ASSERT_EQ(std::gcd(a, b), Arkulib::Tools::gcd(a, b));
+    }
+}
+
+TEST (ArkulibGcd, LehmerMatchesEuclid) {
+    using Arkulib::Tools::UInt128;
+    std::mt19937_64 generator(7);
+    for (int i = 0; i < 10000; ++i) {
+        const UInt128 common = generator() >> (i % 64);
+        const UInt128 a = ((UInt128(generator()) << 64 | generator()) >> (i % 70)) | 1;
+        const UInt128 b = ((UInt128(generator()) << 64 | generator()) >> (i % 90)) | 1;
+
+        ASSERT_TRUE(Arkulib::Tools::euclideanGcd(a, b) == Arkulib::Tools::lehmerGcd(a, b));
+        if (common != 0 && a < (~UInt128(0)) / common && b < (~UInt128(0)) / common) {
+            ASSERT_TRUE(Arkulib::Tools::euclideanGcd(a * common, b * common) == Arkulib::Tools::lehmerGcd(a * common, b * common));
+        }
+    }
+}
+
+TEST (ArkulibGcd, Int128Dispatch) {
+    using Arkulib::Tools::Int128;
+    const Int128 a = -(Int128(6) << 100);
+    const Int128 b = Int128(9) << 90;
+    ASSERT_TRUE(Arkulib::Tools::gcd(a, b) == (Int128(3) << 90));
+}
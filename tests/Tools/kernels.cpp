@@ -0,0 +1,58 @@
+#include <climits>
+#include <gtest/gtest.h>
+#include "../../include/Tools/ArithmeticKernels.hpp"
+
+TEST (ArkulibKernels, HenriciAddition) {
+    int numerator = 0, denominator = 0;
+
+    // 7/12 + 5/18 = 21/36 + 10/36 = 31/36
+    ASSERT_FALSE(Arkulib::Tools::reducedAddOverflow(7, 12, 5, 18, numerator, denominator));
+    ASSERT_EQ(31, numerator);
+    ASSERT_EQ(36, denominator);
+
+    // 1/6 + 1/3 = 1/2: gcd(t, g) is cancelled too
+    ASSERT_FALSE(Arkulib::Tools::reducedAddOverflow(1, 6, 1, 3, numerator, denominator));
+    ASSERT_EQ(1, numerator);
+    ASSERT_EQ(2, denominator);
+}
+
+TEST (ArkulibKernels, HenriciSubtraction) {
+    int numerator = 0, denominator = 0;
+
+    ASSERT_FALSE(Arkulib::Tools::reducedSubtractOverflow(1, 4, 1, 4, numerator, denominator));
+    ASSERT_EQ(0, numerator);
+    ASSERT_EQ(1, denominator);
+
+    ASSERT_FALSE(Arkulib::Tools::reducedSubtractOverflow(5, 6, 1, 10, numerator, denominator));
+    ASSERT_EQ(11, numerator);
+    ASSERT_EQ(15, denominator);
+}
+
+TEST (ArkulibKernels, KnuthMultiplication) {
+    int numerator = 0, denominator = 0;
+
+    // The cross cancellation keeps the intermediates in int: (INT_MAX / 2) * (2 / INT_MAX) = 1
+    ASSERT_FALSE(Arkulib::Tools::reducedMultiplyOverflow(INT_MAX, 2, 2, INT_MAX, numerator, denominator));
+    ASSERT_EQ(1, numerator);
+    ASSERT_EQ(1, denominator);
+
+    ASSERT_TRUE(Arkulib::Tools::reducedMultiplyOverflow(INT_MAX, 2, 3, 1, numerator, denominator));
+}
+
+TEST (ArkulibKernels, KnuthDivision) {
+    int numerator = 0, denominator = 0;
+
+    ASSERT_FALSE(Arkulib::Tools::reducedDivideOverflow(4, 9, -8, 3, numerator, denominator));
+    ASSERT_EQ(-1, numerator);
+    ASSERT_EQ(6, denominator);
+}
+
+TEST (ArkulibKernels, LongChainWithoutOverflow) {
+    // prod(k / (k + 1)) = 1 / 1001: every intermediate is cancelled before the product
+    int numerator = 1, denominator = 1;
+    for (int k = 1; k <= 1000; ++k) {
+        ASSERT_FALSE(Arkulib::Tools::reducedMultiplyOverflow(numerator, denominator, k, k + 1, numerator, denominator));
+    }
+    ASSERT_EQ(1, numerator);
+    ASSERT_EQ(1001, denominator);
+}
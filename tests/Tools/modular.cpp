@@ -0,0 +1,53 @@
+#include <gtest/gtest.h>
+#include "../../include/BigInt.hpp"
+#include "../../include/Tools/Modular.hpp"
+
+#ifdef __SIZEOF_INT128__
+TEST (ArkulibModular, Montgomery) {
+    const std::uint64_t prime = (std::uint64_t(1) << 63) - 25;
+    const Arkulib::Tools::Montgomery arithmetic(prime);
+    const std::uint64_t a = 123456789012345678ULL, b = prime - 987654321ULL;
+    const auto expected = static_cast<std::uint64_t>(Arkulib::Tools::UInt128(a) * b % prime);
+    ASSERT_EQ (arithmetic.fromMontgomery(arithmetic.multiply(arithmetic.toMontgomery(a), arithmetic.toMontgomery(b))), expected);
+    ASSERT_EQ (arithmetic.fromMontgomery(arithmetic.add(arithmetic.toMontgomery(b), arithmetic.toMontgomery(987654321ULL))), 0U);
+    ASSERT_EQ (arithmetic.fromMontgomery(arithmetic.subtract(arithmetic.toMontgomery(1), arithmetic.toMontgomery(2))), prime - 1);
+
+    const std::uint64_t inverse = arithmetic.inverse(arithmetic.toMontgomery(a));
+    ASSERT_EQ (arithmetic.fromMontgomery(arithmetic.multiply(inverse, arithmetic.toMontgomery(a))), 1U);
+}
+
+TEST (ArkulibModular, Primes) {
+    ASSERT_TRUE(Arkulib::Tools::isPrime(2));
+    ASSERT_TRUE(Arkulib::Tools::isPrime(97));
+    ASSERT_FALSE(Arkulib::Tools::isPrime(1));
+    ASSERT_FALSE(Arkulib::Tools::isPrime(561)); // Carmichael number
+    ASSERT_FALSE(Arkulib::Tools::isPrime(3215031751ULL)); // Strong pseudoprime to the bases 2, 3, 5 and 7
+    ASSERT_TRUE(Arkulib::Tools::isPrime((std::uint64_t(1) << 61) - 1));
+    ASSERT_FALSE(Arkulib::Tools::isPrime((std::uint64_t(1) << 61) + 1));
+
+    ASSERT_EQ (Arkulib::Tools::previousPrime(std::uint64_t(1) << 63), (std::uint64_t(1) << 63) - 25);
+    ASSERT_EQ (Arkulib::Tools::previousPrime(100), 97U);
+    ASSERT_EQ (Arkulib::Tools::previousPrime(97), 89U);
+    ASSERT_EQ (Arkulib::Tools::previousPrime(3), 2U);
+}
+#endif
+
+TEST (ArkulibModular, RationalReconstruction) {
+    // -3/7 modulo 10007: 7^-1 = 7148, -3 * 7148 mod 10007 = 8577
+    long long numerator = 0, denominator = 0;
+    ASSERT_TRUE(Arkulib::Tools::rationalReconstruction(8577LL, 10007LL, 70LL, numerator, denominator));
+    ASSERT_EQ (numerator, -3);
+    ASSERT_EQ (denominator, 7);
+    ASSERT_TRUE(Arkulib::Tools::rationalReconstruction(42LL, 10007LL, 70LL, numerator, denominator));
+    ASSERT_EQ (numerator, 42);
+    ASSERT_EQ (denominator, 1);
+
+    // With BigInt, and a residue given by BigInt::residue
+    const Arkulib::BigInt modulus = Arkulib::BigInt((std::uint64_t(1) << 63) - 25) * Arkulib::BigInt((std::uint64_t(1) << 63) - 165);
+    const Arkulib::BigInt value("-123456789123456789");
+    ASSERT_EQ (value.residue(1000), 211U);
+    Arkulib::BigInt bigNumerator, bigDenominator;
+    ASSERT_TRUE(Arkulib::Tools::rationalReconstruction((value % modulus + modulus) % modulus, modulus, Arkulib::BigInt(1LL << 62), bigNumerator, bigDenominator));
+    ASSERT_EQ (bigNumerator, value);
+    ASSERT_EQ (bigDenominator, Arkulib::BigInt(1));
+}
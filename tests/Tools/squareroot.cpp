@@ -0,0 +1,52 @@
+#include <climits>
+#include <cmath>
+#include <random>
+#include <gtest/gtest.h>
+#include "../../include/BigInt.hpp"
+#include "../../include/Tools/SquareRoot.hpp"
+
+TEST (ArkulibSquareRoot, SmallValues) {
+    for (int value = 0; value < 10000; ++value) {
+        const int root = Arkulib::Tools::isqrt(value);
+        ASSERT_LE (root * root, value);
+        ASSERT_GT ((root + 1) * (root + 1), value);
+    }
+    ASSERT_EQ (Arkulib::Tools::isqrt(INT_MAX), 46340);
+    ASSERT_EQ (Arkulib::Tools::isqrt(LLONG_MAX), 3037000499LL);
+}
+
+TEST (ArkulibSquareRoot, Constexpr) {
+    static_assert(Arkulib::Tools::isqrt(1000000) == 1000);
+    static_assert(Arkulib::Tools::isqrt(999999) == 999);
+}
+
+TEST (ArkulibSquareRoot, RandomLongLong) {
+    std::mt19937_64 generator(42);
+    std::uniform_int_distribution<long long int> values(0, LLONG_MAX);
+    for (int i = 0; i < 10000; ++i) {
+        const long long int value = values(generator);
+        const auto root = static_cast<unsigned long long>(Arkulib::Tools::isqrt(value));
+        ASSERT_LE (root * root, static_cast<unsigned long long>(value));
+        ASSERT_GT ((root + 1) * (root + 1), static_cast<unsigned long long>(value));
+    }
+}
+
+TEST (ArkulibSquareRoot, PerfectSquare) {
+    int root = 0;
+    for (int value = 0; value < 10000; ++value) {
+        const int expected = static_cast<int>(std::sqrt(value));
+        ASSERT_EQ (Arkulib::Tools::isPerfectSquare(value, root), expected * expected == value);
+        if (expected * expected == value) {
+            ASSERT_EQ (root, expected);
+        }
+    }
+}
+
+TEST (ArkulibSquareRoot, BigInt) {
+    const Arkulib::BigInt value("12345678901234567890123456789012345678901234567890");
+    Arkulib::BigInt root;
+    ASSERT_TRUE (Arkulib::Tools::isPerfectSquare(value * value, root));
+    ASSERT_EQ (root, value);
+    ASSERT_FALSE (Arkulib::Tools::isPerfectSquare(value * value + Arkulib::BigInt(1), root));
+    ASSERT_EQ (Arkulib::Tools::isqrt(value * value - Arkulib::BigInt(1)), value - Arkulib::BigInt(1));
+}